@@ -0,0 +1,1358 @@
+/**
+ * @file Bench.cpp
+ * @date 17.10.2026
+ * @author Christian Hülsmann (christian_huelsmann@gmx.de)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <codecvt>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <locale>
+#include <new>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../src/HashedString.hpp"
+#include "../src/MultiMatcher.hpp"
+#include "../src/String.hpp"
+#include "../src/StringParallel.hpp"
+#include "../src/StringUtf.hpp"
+#if STRING_POSIX_IO
+#include "../src/StringFile.hpp"
+#endif
+
+// Count of calls to operator new[], which is used by String to allocate its dynamic buffer
+static size_t g_arrayAllocations = 0;
+// Count of bytes allocated by operator new[]
+static size_t g_arrayAllocatedBytes = 0;
+
+/**
+ * @struct BenchRecord
+ * Result of a benchmark written to the JSON report.
+ */
+struct BenchRecord
+{
+	// Name of the benchmark and the measured operation
+	std::string benchmark;
+	// Distribution of the string lengths or size the operation was measured for
+	std::string input;
+	// Measured string class
+	std::string type;
+	// Measured value
+	double value;
+	// Unit of the value
+	const char* unit;
+};
+
+// Results recorded by the benchmarks for the JSON report
+static std::vector<BenchRecord> g_records;
+
+/**
+ * Replacement of the global operator new[] counting the allocations done by String.
+ * @param	size	Size of the memory block to allocate in bytes
+ * @return		Pointer to the allocated memory block
+ */
+void* operator new[](size_t size)
+{
+	g_arrayAllocations++;
+	g_arrayAllocatedBytes += size;
+	void* memory = malloc(size ? size : 1);
+	if (!memory)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+/**
+ * Replacement of the global operator delete[] matching the replaced operator new[].
+ * @param	memory	Pointer to the memory block to deallocate
+ */
+void operator delete[](void* memory) noexcept
+{
+	free(memory);
+}
+
+/**
+ * Measures the time a function takes to execute.
+ * @param	function	Function to measure
+ * @return			Elapsed time in milliseconds
+ */
+template<class TFunction>
+static double measure(TFunction function)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Measures the shortest time of several runs of a function, which is less disturbed by other processes than a single
+ * run.
+ * @param	runs		Count of runs
+ * @param	function	Function to measure
+ * @return			Shortest elapsed time in milliseconds
+ */
+template<class TFunction>
+static double measureBest(size_t runs, TFunction function)
+{
+	double best = measure(function);
+	for (size_t i = 1; i < runs; i++)
+	{
+		double time = measure(function);
+		best = time < best ? time : best;
+	}
+	return best;
+}
+
+/**
+ * Records a result for the JSON report.
+ * @param	benchmark	Name of the benchmark and the measured operation
+ * @param	input		Distribution of the string lengths or size the operation was measured for
+ * @param	type		Measured string class
+ * @param	value		Measured value
+ * @param	unit		Unit of the value
+ */
+static void record(const char* benchmark, const std::string& input, const char* type, double value, const char* unit)
+{
+	BenchRecord result = { benchmark, input, type, value, unit };
+	g_records.push_back(result);
+}
+
+/**
+ * Writes the recorded results and the configuration of String to a JSON file.
+ * @param	path	Path of the file to write
+ * @return		true if the file was written, otherwise false
+ */
+static bool writeJson(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		return false;
+	}
+	fprintf(file, "{\n  \"kernels\": \"%s\",\n  \"layout\": \"%s\",\n  \"growthFactor\": %g,\n  \"ssoCapacity\": %zu,\n  \"results\": [",
+		StringKernels<char>::implementation(), STRING_COMPACT_LAYOUT ? "compact" : "default", static_cast<double>(STRING_BUFFER_GROWTH_FACTOR),
+		AString::ssoCapacity());
+	for (size_t i = 0; i < g_records.size(); i++)
+	{
+		const BenchRecord& result = g_records[i];
+		fprintf(file, "%s\n    { \"benchmark\": \"%s\", \"input\": \"%s\", \"type\": \"%s\", \"value\": %.6g, \"unit\": \"%s\" }", i ? "," : "",
+			result.benchmark.c_str(), result.input.c_str(), result.type.c_str(), result.value, result.unit);
+	}
+	fprintf(file, "\n  ]\n}\n");
+	return 0 == fclose(file);
+}
+
+/**
+ * Generates deterministic pseudo random numbers.
+ * @param	state	State of the generator, updated by the call
+ * @return		Pseudo random number
+ */
+static size_t nextRandom(size_t& state)
+{
+	state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return static_cast<size_t>(state >> 33);
+}
+
+/**
+ * Benchmarks the memory layout of AString using a large index of short keys. Run StringBench and
+ * StringBenchCompact to compare the default and the compact layout.
+ */
+static void BenchLayout()
+{
+	const size_t keyCount = 2000000;
+
+	// Generate keys of 4 to 30 characters, most of them short
+	std::vector<char> text;
+	std::vector<size_t> lengths;
+	size_t state = 42;
+	for (size_t i = 0; i < keyCount; i++)
+	{
+		size_t length = 4 + nextRandom(state) % (nextRandom(state) % 8 ? 19 : 27);
+		for (size_t j = 0; j < length; j++)
+		{
+			text.push_back(static_cast<char>('a' + nextRandom(state) % 26));
+		}
+		text.push_back(0);
+		lengths.push_back(length);
+	}
+
+	std::vector<AString> keys;
+	keys.reserve(keyCount);
+	size_t allocations = g_arrayAllocations;
+	size_t allocatedBytes = g_arrayAllocatedBytes;
+	double buildTime = measure([&]()
+	{
+		const char* key = text.data();
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			keys.push_back(AString(key, 0, lengths[i]));
+			key += lengths[i] + 1;
+		}
+	});
+	allocations = g_arrayAllocations - allocations;
+	allocatedBytes = g_arrayAllocatedBytes - allocatedBytes;
+
+	double sortTime = measure([&]()
+	{
+		std::sort(keys.begin(), keys.end(), [](const AString& lhs, const AString& rhs)
+		{
+			return lhs.compare(rhs.c_str()) < 0;
+		});
+	});
+
+	size_t matches = 0;
+	AString probe(keys[keyCount / 2]);
+	double scanTime = measure([&]()
+	{
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			matches += keys[i] == probe;
+		}
+	});
+
+	printf("layout: %s\n", STRING_COMPACT_LAYOUT ? "compact" : "default");
+	printf("  sizeof(AString)            %10zu bytes\n", sizeof(AString));
+	printf("  sizeof(WString)            %10zu bytes\n", sizeof(WString));
+	printf("  AString SSO capacity       %10zu chars\n", AString::ssoCapacity());
+	printf("  keys                       %10zu\n", keyCount);
+	printf("  heap allocations           %10zu\n", allocations);
+	printf("  memory (inline + heap)     %10.1f MiB\n", (keyCount * sizeof(AString) + allocatedBytes) / 1048576.0);
+	printf("  build                      %10.3f ms\n", buildTime);
+	printf("  sort                       %10.3f ms\n", sortTime);
+	printf("  scan for equality          %10.3f ms (%zu matches)\n", scanTime, matches);
+}
+
+/**
+ * Calculates the throughput of processing a number of bytes.
+ * @param	bytes		Count of processed bytes
+ * @param	milliseconds	Time taken in milliseconds
+ * @return			Throughput in GB/s
+ */
+static double throughput(double bytes, double milliseconds)
+{
+	return milliseconds > 0.0 ? bytes / milliseconds / 1e6 : 0.0;
+}
+
+/**
+ * Benchmarks the scalar and the selected vectorized c-string kernels across string lengths from 1 byte to 1 MB.
+ */
+static void BenchKernels()
+{
+	typedef StringKernels<char> Kernels;
+	const double bytesPerRun = 64.0 * 1048576.0;
+	volatile size_t sink = 0;
+
+	printf("kernels: %s (GB/s)\n", Kernels::implementation());
+	printf("  %8s %10s %10s %10s %10s %10s %10s %10s\n", "bytes", "length", "length", "compare", "compare", "equal", "equal", "copy");
+	printf("  %8s %10s %10s %10s %10s %10s %10s %10s\n", "", "scalar", "simd", "scalar", "simd", "scalar", "simd", "simd");
+	for (size_t size = 1; size <= 1048576; size *= 4)
+	{
+		std::vector<char> buffer1(size + 1, 'a');
+		std::vector<char> buffer2(size + 1, 'a');
+		buffer1[size] = 0;
+		buffer2[size] = 0;
+		const char* str1 = buffer1.data();
+		const char* str2 = buffer2.data();
+		size_t runs = static_cast<size_t>(bytesPerRun / size);
+		AString target(size);
+
+		double lengthScalar = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::lengthScalar(str1 + (i & 0)); });
+		double length = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::length(str1 + (i & 0)); });
+		double compareScalar = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::mismatchScalar(str1, str2 + (i & 0)); });
+		double compare = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::mismatch(str1, str2 + (i & 0)); });
+		double equalScalar = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::equalScalar(str1, str2 + (i & 0), size); });
+		double equal = measure([&]() { for (size_t i = 0; i < runs; i++) sink += Kernels::equal(str1, str2 + (i & 0), size); });
+		double copy = measure([&]() { for (size_t i = 0; i < runs; i++) { target.copy(str1 + (i & 0)); sink += target.length(); } });
+
+		double bytes = static_cast<double>(runs) * size;
+		printf("  %8zu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", size,
+			throughput(bytes, lengthScalar), throughput(bytes, length),
+			throughput(bytes, compareScalar), throughput(bytes, compare),
+			throughput(bytes, equalScalar), throughput(bytes, equal), throughput(bytes, copy));
+	}
+}
+
+/**
+ * Simulates a request handler building temporary strings from fragments and dropping them at the end.
+ * @param	strings		Vector to collect the strings of the request in, cleared afterwards
+ * @param	fragments	Fragments to build the strings from
+ * @param	fragmentCount	Count of fragments
+ * @return			Total length of the built strings
+ */
+template<class TString>
+static size_t handleRequest(std::vector<TString>& strings, const char* const* fragments, size_t fragmentCount)
+{
+	size_t total = 0;
+	for (size_t i = 0; i < 1000; i++)
+	{
+		TString line(fragments[i % fragmentCount]);
+		line += fragments[(i + 1) % fragmentCount];
+		line += fragments[(i + 3) % fragmentCount];
+		total += line.length();
+		strings.push_back(std::move(line));
+	}
+	strings.clear();
+	return total;
+}
+
+/**
+ * Runs request handlers on multiple threads using a String type.
+ * @param	threadCount	Count of threads
+ * @param	requests	Count of requests per thread
+ * @param	useArena	true to allocate from a per-thread arena reset after every request
+ * @return			Elapsed time in milliseconds
+ */
+template<class TString>
+static double runRequests(size_t threadCount, size_t requests, bool useArena)
+{
+	static const char* const fragments[] =
+	{
+		"GET /index.html",
+		" HTTP/1.1 200 OK ",
+		"host=backend-17.example.org ",
+		"user-agent=Mozilla/5.0 (X11; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/118.0 ",
+		"x",
+		"content-type=application/json; charset=utf-8 ",
+		"path=/api/v2/customers/12345/orders?page=3&limit=100&sort=created_at ",
+		"status=ok "
+	};
+	const size_t fragmentCount = sizeof(fragments) / sizeof(fragments[0]);
+
+	return measure([&]()
+	{
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < threadCount; t++)
+		{
+			threads.push_back(std::thread([&]()
+			{
+				std::vector<TString> strings;
+				strings.reserve(1000);
+				StringArena arena;
+				StringArena::Scope scope(arena);
+				for (size_t r = 0; r < requests; r++)
+				{
+					handleRequest(strings, fragments, fragmentCount);
+					if (useArena)
+					{
+						arena.reset();
+					}
+				}
+			}));
+		}
+		for (size_t t = 0; t < threadCount; t++)
+		{
+			threads[t].join();
+		}
+	});
+}
+
+/**
+ * Benchmarks the default, pool and arena allocators on request handlers building temporary strings.
+ */
+static void BenchAllocators()
+{
+	const size_t requests = 500;
+	size_t maxThreads = std::thread::hardware_concurrency();
+	if (maxThreads < 4)
+	{
+		maxThreads = 4;
+	}
+
+	printf("allocators: %zu requests of 1000 strings per thread (ms)\n", requests);
+	printf("  %8s %10s %10s %10s\n", "threads", "default", "pool", "arena");
+	for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+	{
+		double defaultTime = runRequests<String<char> >(threadCount, requests, false);
+		double poolTime = runRequests<String<char, StringPoolAllocator<char> > >(threadCount, requests, false);
+		double arenaTime = runRequests<String<char, StringArenaAllocator<char> > >(threadCount, requests, true);
+		printf("  %8zu %10.3f %10.3f %10.3f\n", threadCount, defaultTime, poolTime, arenaTime);
+	}
+}
+
+/**
+ * Builds a log of random lines.
+ * @param	size	Minimum length of the log in characters
+ * @return		Log
+ */
+static AString makeLog(size_t size)
+{
+	static const char* const lines[] =
+	{
+		"2026-10-17 12:00:01.123 INFO  [worker-3] request GET /api/v2/customers/12345/orders done in 12 ms\n",
+		"2026-10-17 12:00:01.456 WARN  [worker-7] slow response from backend-17.example.org after 950 ms\n",
+		"2026-10-17 12:00:02.789 ERROR [worker-1] timeout talking to backend-4.example.org, retrying\n",
+		"2026-10-17 12:00:03.012 DEBUG [worker-5] cache hit for key customer:12345:orders:page:3\n"
+	};
+	const size_t lineCount = sizeof(lines) / sizeof(lines[0]);
+	AString log(size + 200);
+	size_t state = 5;
+	while (log.length() < size)
+	{
+		log += lines[nextRandom(state) % lineCount];
+	}
+	return log;
+}
+
+/**
+ * @struct BenchString
+ * Adapter giving String and std::string the same interface in the benchmarks comparing them.
+ */
+template<class TString>
+struct BenchString;
+
+template<>
+struct BenchString<AString>
+{
+	static const char* name() { return "String"; }
+	static AString create(const AStringView& str) { return AString(str); }
+	static void append(AString& target, const AStringView& str) { target.append(str); }
+	static int compare(const AString& lhs, const AString& rhs) { return lhs.compare(AStringView(rhs)); }
+};
+
+template<>
+struct BenchString<std::string>
+{
+	static const char* name() { return "std::string"; }
+	static std::string create(const AStringView& str) { return std::string(str.data(), str.length()); }
+	static void append(std::string& target, const AStringView& str) { target.append(str.data(), str.length()); }
+	static int compare(const std::string& lhs, const std::string& rhs) { return lhs.compare(rhs); }
+};
+
+/**
+ * Benchmarks the basic operations of a string class on samples of a length distribution.
+ * @param	distribution	Name of the length distribution
+ * @param	samples		Views of the samples
+ * @param	times		Time per string of construct, copy, append, equal, compare and churn in nanoseconds
+ */
+template<class TString>
+static void BenchCoreForType(const char* distribution, const std::vector<AStringView>& samples, double* times)
+{
+	typedef BenchString<TString> Adapter;
+	const size_t runs = 5;
+	double count = static_cast<double>(samples.size());
+	volatile size_t sink = 0;
+	std::vector<TString> strings;
+	strings.reserve(samples.size());
+	for (size_t i = 0; i < samples.size(); i++)
+	{
+		strings.push_back(Adapter::create(samples[i]));
+	}
+	std::vector<TString> copies(strings);
+
+	// Construct from characters and destroy
+	times[0] = measureBest(runs, [&]()
+	{
+		for (size_t i = 0; i < samples.size(); i++)
+		{
+			TString str(Adapter::create(samples[i]));
+			sink += str.length();
+		}
+	});
+	// Copy construct
+	times[1] = measureBest(runs, [&]()
+	{
+		for (size_t i = 0; i < strings.size(); i++)
+		{
+			TString str(strings[i]);
+			sink += str.length();
+		}
+	});
+	// Build by appending the words of the sample, so the buffer grows like in a formatter
+	times[2] = measureBest(runs, [&]()
+	{
+		for (size_t i = 0; i < samples.size(); i++)
+		{
+			TString str;
+			samples[i].split(' ', [&](const AStringView& word)
+			{
+				Adapter::append(str, word);
+				Adapter::append(str, AStringView(" ", 1));
+			});
+			sink += str.length();
+		}
+	});
+	// Compare equal strings in different buffers and neighbouring strings for their order
+	times[3] = measureBest(runs, [&]()
+	{
+		for (size_t i = 0; i < strings.size(); i++)
+		{
+			sink += strings[i] == copies[i];
+		}
+	});
+	times[4] = measureBest(runs, [&]()
+	{
+		for (size_t i = 1; i < strings.size(); i++)
+		{
+			sink += Adapter::compare(strings[i - 1], strings[i]) < 0;
+		}
+	});
+	// Churn a vector like a queue of messages, erasing from the front moves the strings
+	times[5] = measureBest(runs, [&]()
+	{
+		std::vector<TString> queue;
+		for (size_t i = 0; i < strings.size(); i++)
+		{
+			queue.push_back(strings[i]);
+			if (queue.size() == 64)
+			{
+				queue.erase(queue.begin(), queue.begin() + 32);
+			}
+		}
+		sink += queue.size();
+	});
+
+	const char* const operations[] = { "core/construct", "core/copy", "core/append", "core/equal", "core/compare", "core/churn" };
+	for (size_t i = 0; i < 6; i++)
+	{
+		times[i] *= 1e6 / count;
+		record(operations[i], distribution, Adapter::name(), times[i], "ns");
+	}
+}
+
+/**
+ * Benchmarks construction, copying, appending, comparison and churning a vector of AString against std::string on
+ * length distributions taken from a log: single words mostly fit the SSO buffer, lines and records of four lines are
+ * stored on the heap.
+ */
+static void BenchCore()
+{
+	AString log = makeLog(8 * 1048576);
+	std::vector<AStringView> lines;
+	AStringView(log).split('\n', [&](const AStringView& line)
+	{
+		if (line.length())
+		{
+			lines.push_back(line);
+		}
+	});
+	std::vector<AStringView> distributions[3];
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		lines[i].split(' ', [&](const AStringView& word)
+		{
+			distributions[0].push_back(word);
+		});
+		distributions[1].push_back(lines[i]);
+		if (i % 4 == 3)
+		{
+			distributions[2].push_back(AStringView(lines[i - 3].data(), lines[i].data() + lines[i].length() - lines[i - 3].data()));
+		}
+	}
+	const char* const names[] = { "words", "lines", "records" };
+
+	printf("core: String vs std::string (ns per string)\n");
+	printf("  %8s %8s %10s %10s %10s %10s %10s %10s %10s\n", "input", "length", "type", "construct", "copy", "append", "equal", "compare", "churn");
+	for (size_t i = 0; i < 3; i++)
+	{
+		size_t characters = 0;
+		for (size_t j = 0; j < distributions[i].size(); j++)
+		{
+			characters += distributions[i][j].length();
+		}
+		double times[2][6];
+		BenchCoreForType<AString>(names[i], distributions[i], times[0]);
+		BenchCoreForType<std::string>(names[i], distributions[i], times[1]);
+		for (size_t type = 0; type < 2; type++)
+		{
+			printf("  %8s %8.1f %10s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", names[i], static_cast<double>(characters) / distributions[i].size(),
+				type ? "std" : "String", times[type][0], times[type][1], times[type][2], times[type][3], times[type][4], times[type][5]);
+		}
+	}
+}
+
+/**
+ * Benchmarks appending 8 characters at a time up to different lengths, which shows the growth curve of the buffer.
+ * Run StringBench and StringBenchGrowth2 to compare the growth factors 1.5 and 2.
+ */
+static void BenchGrowth()
+{
+	const double bytesPerSize = 64.0 * 1048576.0;
+	const char piece[] = "12345678";
+	volatile size_t sink = 0;
+
+	printf("growth: factor %g (ns per appended character, allocations per string)\n", static_cast<double>(STRING_BUFFER_GROWTH_FACTOR));
+	printf("  %8s %10s %10s %12s\n", "length", "String", "std", "allocations");
+	for (size_t size = 16; size <= 4194304; size *= 4)
+	{
+		size_t strings = static_cast<size_t>(bytesPerSize / size);
+		size_t allocations = g_arrayAllocations;
+		double time = measure([&]()
+		{
+			for (size_t i = 0; i < strings; i++)
+			{
+				AString str;
+				for (size_t length = 0; length < size; length += 8)
+				{
+					str.append(piece, 0, 8);
+				}
+				sink += str.length();
+			}
+		});
+		allocations = g_arrayAllocations - allocations;
+		double stdTime = measure([&]()
+		{
+			for (size_t i = 0; i < strings; i++)
+			{
+				std::string str;
+				for (size_t length = 0; length < size; length += 8)
+				{
+					str.append(piece, 8);
+				}
+				sink += str.length();
+			}
+		});
+
+		double characters = static_cast<double>(strings) * size;
+		char input[32];
+		snprintf(input, sizeof(input), "%zu", size);
+		record("growth/append", input, "String", time * 1e6 / characters, "ns");
+		record("growth/append", input, "std::string", stdTime * 1e6 / characters, "ns");
+		record("growth/allocations", input, "String", static_cast<double>(allocations) / strings, "allocations");
+		printf("  %8zu %10.3f %10.3f %12.1f\n", size, time * 1e6 / characters, stdTime * 1e6 / characters, static_cast<double>(allocations) / strings);
+	}
+}
+
+/**
+ * Benchmarks the search of needles of different lengths in a log, which does not contain them, against strstr and
+ * std::string::find.
+ */
+static void BenchSearch()
+{
+	AString log = makeLog(32 * 1048576 - 200);
+	std::string stdLog(log.c_str());
+	volatile size_t sink = 0;
+
+	// The needles share prefixes and suffixes with the log but never occur
+	static const char* const needles[] =
+	{
+		"ERRX",
+		"backend-17.example.net",
+		"request GET /api/v2/customers/12345/orders failed",
+		"2026-10-17 12:00:02.789 ERROR [worker-1] timeout talking to backend-4.example.org, giving up after 5 retries"
+	};
+
+	printf("search: %zu MB log (GB/s)\n", log.length() / 1048576);
+	printf("  %8s %10s %10s %10s %10s %10s\n", "needle", "strstr", "std", "filter", "String", "algorithm");
+	for (size_t i = 0; i < sizeof(needles) / sizeof(needles[0]); i++)
+	{
+		const char* needle = needles[i];
+		size_t needleLength = strlen(needle);
+		ASearcher searcher(needle);
+
+		double strstrTime = measure([&]() { sink += strstr(log.c_str(), needle) ? 1 : 0; });
+		double stdTime = measure([&]() { sink += stdLog.find(needle); });
+		double filterTime = measure([&]() { sink += StringKernels<char>::find(log.c_str(), log.length(), needle, needleLength); });
+		double stringTime = measure([&]() { sink += log.find(needle); });
+
+		double bytes = static_cast<double>(log.length());
+		printf("  %8zu %10.2f %10.2f %10.2f %10.2f %10s\n", needleLength, throughput(bytes, strstrTime), throughput(bytes, stdTime),
+			throughput(bytes, filterTime), throughput(bytes, stringTime), searcher.algorithm());
+	}
+}
+
+/**
+ * Benchmarks matching growing sets of keywords in a log using MultiMatcher against searching every keyword on its
+ * own using a reused Searcher.
+ */
+static void BenchMultiMatcher()
+{
+	AString log = makeLog(4 * 1048576);
+	static const char* const words[] = { "worker", "backend", "timeout", "orders", "customer", "response", "cache", "retry" };
+	const size_t wordCount = sizeof(words) / sizeof(words[0]);
+	volatile size_t sink = 0;
+
+	printf("multimatcher: %zu MB log (GB/s)\n", log.length() / 1048576);
+	printf("  %8s %10s %10s %10s %10s\n", "keywords", "states", "matcher", "naive", "matches");
+	for (size_t keywordCount = 10; keywordCount <= 1000; keywordCount *= 10)
+	{
+		// Keywords are variations of words occurring in the log, some of them occur as well
+		std::vector<AString> keywords;
+		size_t state = 9;
+		for (size_t i = 0; i < keywordCount; i++)
+		{
+			AString keyword(words[i % wordCount]);
+			if (i >= wordCount)
+			{
+				char suffix[] = { '-', static_cast<char>('0' + nextRandom(state) % 10), static_cast<char>('a' + nextRandom(state) % 26), 0 };
+				keyword += suffix;
+			}
+			keywords.push_back(std::move(keyword));
+		}
+		std::vector<ASearcher> searchers;
+		for (size_t i = 0; i < keywordCount; i++)
+		{
+			searchers.push_back(ASearcher(keywords[i]));
+		}
+
+		AMultiMatcher matcher(keywords.begin(), keywords.end());
+		size_t matches = 0;
+		size_t naiveMatches = 0;
+		double matcherTime = measure([&]() { matches = matcher.count(log); });
+		double naiveTime = measure([&]()
+		{
+			for (size_t i = 0; i < keywordCount; i++)
+			{
+				for (size_t pos = searchers[i].find(log); AString::NOT_FOUND != pos; pos = searchers[i].find(log, pos + 1))
+				{
+					naiveMatches++;
+				}
+			}
+		});
+		sink += matches + naiveMatches;
+
+		double bytes = static_cast<double>(log.length());
+		printf("  %8zu %10zu %10.2f %10.2f %10s\n", keywordCount, matcher.stateCount(), throughput(bytes, matcherTime),
+			throughput(bytes, naiveTime), matches == naiveMatches ? "equal" : "DIFFERENT");
+	}
+}
+
+/**
+ * Looks up keys in a hash map in a scattered order.
+ * @param	map	Map to search
+ * @param	keys	Keys to look up, their count must be a power of 2
+ * @return		Count of keys found
+ */
+template<class TMap, class TKey>
+static size_t lookup(const TMap& map, const std::vector<TKey>& keys)
+{
+	size_t found = 0;
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		found += map.count(keys[(i * 40503) & (keys.size() - 1)]);
+	}
+	return found;
+}
+
+/**
+ * Benchmarks the lookup of keys of different lengths in std::unordered_map using std::string, AString and
+ * AHashedString as keys, half of the lookups miss. Also compares the throughput of hashing a long string.
+ */
+static void BenchHash()
+{
+	const size_t keyCount = 65536;
+	const size_t passes = 16;
+	const size_t lengths[] = { 8, 24, 64, 256 };
+	volatile size_t sink = 0;
+
+	printf("hash: %zu keys, half of the lookups miss (million lookups/s)\n", keyCount);
+	printf("  %8s %10s %10s %10s\n", "length", "std", "String", "hashed");
+	for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		// Keys share a prefix like the fields of a schema, misses differ from a key by a single character
+		std::vector<std::string> stdKeys;
+		size_t state = 13;
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			std::string key(std::string("customer.orders.").substr(0, lengths[l] / 2));
+			while (key.length() < lengths[l])
+			{
+				key += static_cast<char>('a' + nextRandom(state) % 26);
+			}
+			if (i & 1)
+			{
+				key[key.length() / 2] = 'X';
+			}
+			stdKeys.push_back(key);
+		}
+
+		std::vector<AString> keys;
+		std::vector<AHashedString> hashedKeys;
+		std::unordered_map<std::string, int> stdMap;
+		std::unordered_map<AString, int> stringMap;
+		std::unordered_map<AHashedString, int> hashedMap;
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			keys.push_back(AString(stdKeys[i].c_str()));
+			hashedKeys.push_back(AHashedString(AStringView(stdKeys[i].c_str())));
+			if (!(i & 1))
+			{
+				stdMap[stdKeys[i]] = static_cast<int>(i);
+				stringMap[keys[i]] = static_cast<int>(i);
+				hashedMap[hashedKeys[i]] = static_cast<int>(i);
+			}
+		}
+
+		double stdTime = measure([&]() { for (size_t p = 0; p < passes; p++) sink += lookup(stdMap, stdKeys); });
+		double stringTime = measure([&]() { for (size_t p = 0; p < passes; p++) sink += lookup(stringMap, keys); });
+		double hashedTime = measure([&]() { for (size_t p = 0; p < passes; p++) sink += lookup(hashedMap, hashedKeys); });
+
+		double lookups = static_cast<double>(keyCount * passes) / 1000.0;
+		printf("  %8zu %10.2f %10.2f %10.2f\n", lengths[l], lookups / stdTime, lookups / stringTime, lookups / hashedTime);
+	}
+
+	AString log = makeLog(32 * 1048576 - 200);
+	std::string stdLog(log.c_str());
+	double stdTime = measure([&]() { sink += std::hash<std::string>()(stdLog); });
+	double stringTime = measure([&]() { sink += log.hash(); });
+	double bytes = static_cast<double>(log.length());
+	printf("  %zu MB string (GB/s): std %.2f String %.2f\n", log.length() / 1048576, throughput(bytes, stdTime), throughput(bytes, stringTime));
+}
+
+/**
+ * Benchmarks the conversion of a log with some non-ASCII characters and of many short fields between UTF-8 and
+ * WString using StringUtf against std::wstring_convert, as well as validating and counting code points.
+ */
+static void BenchUtf()
+{
+	// Every line of the log gets a non-ASCII character
+	AString log = makeLog(16 * 1048576);
+	AString utf8(log.length() + log.count("\n"));
+	for (size_t start = 0, end; AString::NOT_FOUND != (end = log.find('\n', start)); start = end + 1)
+	{
+		utf8.append(AStringView(log).substr(start, end - start));
+		utf8 += "\xE2\x82\xAC\n";
+	}
+	std::wstring_convert<std::codecvt_utf8<wchar_t> > converter;
+	std::string stdUtf8(utf8.c_str());
+	std::wstring stdWide = converter.from_bytes(stdUtf8);
+	volatile size_t sink = 0;
+
+	// The targets are reused like in an ingestion layer, so they are converted to once before measuring
+	WString wide;
+	AString back;
+	StringUtf::fromUtf8(utf8, wide);
+	StringUtf::toUtf8(wide, back);
+
+	printf("utf: %zu MB log (GB/s of UTF-8)\n", utf8.length() / 1048576);
+	printf("  %12s %10s %10s\n", "operation", "std", "StringUtf");
+	double bytes = static_cast<double>(utf8.length());
+	double stdTime = measure([&]() { sink += converter.from_bytes(stdUtf8).length(); });
+	double time = measure([&]() { sink += StringUtf::fromUtf8(utf8, wide) ? wide.length() : 0; });
+	printf("  %12s %10.2f %10.2f\n", "to wide", throughput(bytes, stdTime), throughput(bytes, time));
+	stdTime = measure([&]() { sink += converter.to_bytes(stdWide).length(); });
+	time = measure([&]() { sink += StringUtf::toUtf8(wide, back) ? back.length() : 0; });
+	printf("  %12s %10.2f %10.2f\n", "to UTF-8", throughput(bytes, stdTime), throughput(bytes, time));
+	time = measure([&]() { sink += StringUtf::validate(utf8) ? 1 : 0; });
+	printf("  %12s %10s %10.2f\n", "validate", "-", throughput(bytes, time));
+	time = measure([&]() { sink += StringUtf::countCodePoints(utf8); });
+	printf("  %12s %10s %10.2f\n", "count", "-", throughput(bytes, time));
+
+	// Short fields are converted into a reused target
+	std::vector<WString> fields;
+	std::vector<std::wstring> stdFields;
+	size_t fieldBytes = 0;
+	size_t state = 17;
+	for (size_t i = 0; i < 262144; i++)
+	{
+		size_t start = nextRandom(state) % (wide.length() - 64);
+		WString field(WStringView(wide).substr(start, 8 + nextRandom(state) % 40));
+		stdFields.push_back(std::wstring(field.c_str()));
+		fields.push_back(std::move(field));
+		fieldBytes += fields.back().length();
+	}
+	stdTime = measure([&]() { for (size_t i = 0; i < stdFields.size(); i++) sink += converter.to_bytes(stdFields[i]).length(); });
+	time = measure([&]() { for (size_t i = 0; i < fields.size(); i++) sink += StringUtf::toUtf8(fields[i], back) ? back.length() : 0; });
+	printf("  %12s %10.2f %10.2f (million fields/s)\n", "fields", fields.size() / stdTime / 1000.0, fields.size() / time / 1000.0);
+	sink += fieldBytes;
+}
+
+/**
+ * Measures building strings from pieces and prints one row of the concatenation benchmark.
+ * @param	name		Name of the row, the count of pieces per string
+ * @param	rounds		Count of strings to build
+ * @param	append		Function building a string using a sequence of append calls and returning its length
+ * @param	plus		Function building a string using operator+ and returning its length
+ * @param	concat		Function building a string using String::concat and returning its length
+ */
+template<class TAppend, class TPlus, class TConcat>
+static void BenchConcatRow(const char* name, size_t rounds, TAppend append, TPlus plus, TConcat concat)
+{
+	volatile size_t sink = 0;
+	size_t allocations[3];
+	double times[3];
+	allocations[0] = g_arrayAllocations;
+	times[0] = measure([&]() { for (size_t i = 0; i < rounds; i++) sink += append(); });
+	allocations[0] = g_arrayAllocations - allocations[0];
+	allocations[1] = g_arrayAllocations;
+	times[1] = measure([&]() { for (size_t i = 0; i < rounds; i++) sink += plus(); });
+	allocations[1] = g_arrayAllocations - allocations[1];
+	allocations[2] = g_arrayAllocations;
+	times[2] = measure([&]() { for (size_t i = 0; i < rounds; i++) sink += concat(); });
+	allocations[2] = g_arrayAllocations - allocations[2];
+
+	printf("  %8s %10.1f %10.1f %10.1f %10.2f %10.2f %10.2f\n", name, times[0] * 1e6 / rounds, times[1] * 1e6 / rounds,
+		times[2] * 1e6 / rounds, static_cast<double>(allocations[0]) / rounds, static_cast<double>(allocations[1]) / rounds,
+		static_cast<double>(allocations[2]) / rounds);
+}
+
+/**
+ * Benchmarks building strings from 2 to 16 pieces using a sequence of append calls, which may grow the buffer on
+ * every step, against the lazy operator+ and String::concat, which allocate once for the combined length.
+ */
+static void BenchConcat()
+{
+	const size_t rounds = 1000000;
+
+	// Pieces of 4 to 20 characters
+	std::vector<AString> pieces;
+	size_t state = 5;
+	for (size_t i = 0; i < 16; i++)
+	{
+		AString piece;
+		for (size_t length = 4 + nextRandom(state) % 17; length > 0; length--)
+		{
+			char c[2] = { static_cast<char>('a' + nextRandom(state) % 26), 0 };
+			piece += c;
+		}
+		pieces.push_back(std::move(piece));
+	}
+	const AString* p = pieces.data();
+
+	printf("concat: strings of 4 to 20 character pieces (ns and allocations per string)\n");
+	printf("  %8s %10s %10s %10s %10s %10s %10s\n", "pieces", "append", "operator+", "concat", "allocs", "allocs", "allocs");
+	BenchConcatRow("2", rounds,
+		[&]() { AString str(p[0]); str += p[1]; return str.length(); },
+		[&]() { AString str = p[0] + p[1]; return str.length(); },
+		[&]() { return AString::concat(p[0], p[1]).length(); });
+	BenchConcatRow("4", rounds,
+		[&]() { AString str(p[0]); str += p[1]; str += p[2]; str += p[3]; return str.length(); },
+		[&]() { AString str = p[0] + p[1] + p[2] + p[3]; return str.length(); },
+		[&]() { return AString::concat(p[0], p[1], p[2], p[3]).length(); });
+	BenchConcatRow("8", rounds,
+		[&]() { AString str(p[0]); for (size_t i = 1; i < 8; i++) str += p[i]; return str.length(); },
+		[&]() { AString str = p[0] + p[1] + p[2] + p[3] + p[4] + p[5] + p[6] + p[7]; return str.length(); },
+		[&]() { return AString::concat(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]).length(); });
+	BenchConcatRow("16", rounds,
+		[&]() { AString str(p[0]); for (size_t i = 1; i < 16; i++) str += p[i]; return str.length(); },
+		[&]()
+		{
+			AString str = p[0] + p[1] + p[2] + p[3] + p[4] + p[5] + p[6] + p[7] + p[8] + p[9] + p[10] + p[11] + p[12] +
+				p[13] + p[14] + p[15];
+			return str.length();
+		},
+		[&]()
+		{
+			return AString::concat(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9], p[10], p[11], p[12],
+				p[13], p[14], p[15]).length();
+		});
+
+	// Mixed pieces like a log line, the append sequence formats the number separately
+	BenchConcatRow("mixed", rounds,
+		[&]()
+		{
+			char number[24];
+			snprintf(number, sizeof(number), "%zu", rounds);
+			AString str(p[0]); str += ": "; str += p[1]; str += " ["; str += number; str += "] "; str += p[2];
+			return str.length();
+		},
+		[&]() { AString str = p[0] + ": " + p[1] + " [" + rounds + "] " + p[2]; return str.length(); },
+		[&]() { return AString::concat(p[0], ": ", p[1], " [", rounds, "] ", p[2]).length(); });
+}
+
+/**
+ * Benchmarks formatting and parsing random integers and doubles with String against snprintf, strtoll and strtod.
+ * The numbers are appended to a reused buffer, so String writes them directly into its spare capacity.
+ */
+static void BenchNumber()
+{
+	const size_t count = 1000000;
+	std::vector<int64_t> integers;
+	std::vector<double> doubles;
+	size_t state = 23;
+	for (size_t i = 0; i < count; i++)
+	{
+		// Integers of all lengths and doubles with many digits
+		uint64_t high = nextRandom(state);
+		uint64_t bits = high << 32 ^ nextRandom(state);
+		integers.push_back(static_cast<int64_t>(bits) >> (nextRandom(state) % 64));
+		double numerator = static_cast<double>(nextRandom(state));
+		doubles.push_back(numerator / static_cast<double>(1 + nextRandom(state) % 100000));
+	}
+	volatile size_t sink = 0;
+	char buffer[64];
+
+	printf("number: %zu random numbers (ns per number)\n", count);
+	printf("  %12s %10s %10s\n", "operation", "libc", "String");
+	AString text(count * 32);
+	double libcTime = measure([&]() { for (size_t i = 0; i < count; i++) sink += snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(integers[i])); });
+	double time = measure([&]() { text.setLength(0); for (size_t i = 0; i < count; i++) { text.appendInt(integers[i]); text += " "; } });
+	printf("  %12s %10.1f %10.1f\n", "format int", libcTime * 1e6 / count, time * 1e6 / count);
+	std::vector<AStringView> integerTexts;
+	AStringView(text).split(' ', [&](const AStringView& token) { integerTexts.push_back(token); });
+	integerTexts.pop_back();
+
+	// The shortest representation is compared to %.17g, which always round trips but is not the shortest
+	AString doubleText(count * 32);
+	libcTime = measure([&]() { for (size_t i = 0; i < count; i++) sink += snprintf(buffer, sizeof(buffer), "%.17g", doubles[i]); });
+	time = measure([&]() { doubleText.setLength(0); for (size_t i = 0; i < count; i++) { doubleText.appendDouble(doubles[i]); doubleText += " "; } });
+	printf("  %12s %10.1f %10.1f\n", "format double", libcTime * 1e6 / count, time * 1e6 / count);
+	std::vector<AStringView> doubleTexts;
+	AStringView(doubleText).split(' ', [&](const AStringView& token) { doubleTexts.push_back(token); });
+	doubleTexts.pop_back();
+
+	// strtoll and strtod need terminated strings, so the views are copied to a buffer first for both
+	int64_t integer;
+	libcTime = measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(buffer, integerTexts[i].data(), integerTexts[i].length());
+			buffer[integerTexts[i].length()] = 0;
+			sink += static_cast<size_t>(strtoll(buffer, nullptr, 10));
+		}
+	});
+	time = measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(buffer, integerTexts[i].data(), integerTexts[i].length());
+			sink += AStringView(buffer, integerTexts[i].length()).parseInt(integer) ? static_cast<size_t>(integer) : 0;
+		}
+	});
+	printf("  %12s %10.1f %10.1f\n", "parse int", libcTime * 1e6 / count, time * 1e6 / count);
+	double number;
+	libcTime = measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(buffer, doubleTexts[i].data(), doubleTexts[i].length());
+			buffer[doubleTexts[i].length()] = 0;
+			sink += strtod(buffer, nullptr) > 1.0;
+		}
+	});
+	time = measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(buffer, doubleTexts[i].data(), doubleTexts[i].length());
+			sink += AStringView(buffer, doubleTexts[i].length()).parseDouble(number) && number > 1.0;
+		}
+	});
+	printf("  %12s %10.1f %10.1f\n", "parse double", libcTime * 1e6 / count, time * 1e6 / count);
+
+	// A log line with a string, an integer and a double
+	AString line(64);
+	libcTime = measure([&]()
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			sink += snprintf(buffer, sizeof(buffer), "%s=%lld (%.17g)", "key", static_cast<long long>(i), doubles[i]);
+		}
+	});
+	time = measure([&]() { for (size_t i = 0; i < count; i++) sink += line.format("{}={} ({})", "key", i, doubles[i]) ? line.length() : 0; });
+	printf("  %12s %10.1f %10.1f\n", "format line", libcTime * 1e6 / count, time * 1e6 / count);
+}
+
+/**
+ * Benchmarks reading a log file from the page cache as a whole and line by line using String::readFile, MappedString
+ * and StringLineReader against std::ifstream, std::getline and copying std::string into AString.
+ */
+static void BenchFile()
+{
+#if STRING_POSIX_IO
+	// The log is written once, so it is read from the page cache
+	AString log = makeLog(256 * 1048576);
+	char path[] = "/tmp/StringBenchXXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0 || !log.writeTo(fd))
+	{
+		printf("file: could not write %s\n", path);
+		return;
+	}
+	close(fd);
+	double bytes = static_cast<double>(log.length());
+	volatile size_t sink = 0;
+
+	printf("file: %zu MB log (GB/s)\n", log.length() / 1048576);
+	printf("  %12s %10s %10s %10s\n", "operation", "std", "String", "mapped");
+	AString content;
+	double stdTime = measure([&]()
+	{
+		std::ifstream file(path, std::ios::binary);
+		std::string str((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		content.copy(str.c_str(), 0, str.length());
+		sink += content.length();
+	});
+	double time = measure([&]() { sink += content.readFile(path) ? content.length() : 0; });
+	double mappedTime = measure([&]()
+	{
+		MappedString mapped;
+		sink += mapped.open(path) ? AStringView(mapped).count("\n") : 0;
+	});
+	printf("  %12s %10.2f %10.2f %10.2f\n", "whole file", throughput(bytes, stdTime), throughput(bytes, time), throughput(bytes, mappedTime));
+
+	// Lines are counted with their lengths, the mapped file is split in place
+	stdTime = measure([&]()
+	{
+		std::ifstream file(path, std::ios::binary);
+		std::string line;
+		while (std::getline(file, line))
+		{
+			sink += line.length();
+		}
+	});
+	time = measure([&]()
+	{
+		StringLineReader reader;
+		reader.open(path);
+		AStringView line;
+		while (reader.next(line))
+		{
+			sink += line.length();
+		}
+	});
+	mappedTime = measure([&]()
+	{
+		MappedString mapped;
+		mapped.open(path);
+		AStringView(mapped).split('\n', [&](const AStringView& line) { sink += line.length(); });
+	});
+	printf("  %12s %10.2f %10.2f %10.2f\n", "lines", throughput(bytes, stdTime), throughput(bytes, time), throughput(bytes, mappedTime));
+	AString line;
+	size_t allocations = g_arrayAllocations;
+	time = measure([&]()
+	{
+		StringLineReader reader;
+		reader.open(path);
+		while (reader.next(line))
+		{
+			sink += line.length();
+		}
+	});
+	printf("  %12s %10s %10.2f %10s (%zu allocations)\n", "line copies", "-", throughput(bytes, time), "-", g_arrayAllocations - allocations);
+	unlink(path);
+#endif
+}
+
+/**
+ * Benchmarks replaceAll and the case conversion on a log against rebuilding the string from pieces, std::string and
+ * the scalar kernel, and sanitizing log messages in a reused String against std::string temporaries.
+ */
+static void BenchEditing()
+{
+	AString log = makeLog(32 * 1048576);
+	double bytes = static_cast<double>(log.length());
+	volatile size_t sink = 0;
+
+	printf("editing: %zu MB log (GB/s)\n", log.length() / 1048576);
+	printf("  %12s %10s %10s %10s\n", "replaceAll", "std", "rebuild", "in place");
+	const char* const rows[][3] = { { "shorter", "worker-", "w" }, { "equal", "backend", "BACKEND" }, { "longer", " ms", " milliseconds" } };
+	for (size_t row = 0; row < 3; row++)
+	{
+		AStringView needle(rows[row][1]);
+		AStringView replacement(rows[row][2]);
+		std::string stdLog(log.c_str(), log.length());
+		double stdTime = measure([&]()
+		{
+			std::string result;
+			size_t pos = 0;
+			for (size_t found = stdLog.find(rows[row][1]); found != std::string::npos; found = stdLog.find(rows[row][1], pos))
+			{
+				result.append(stdLog, pos, found - pos);
+				result.append(rows[row][2]);
+				pos = found + needle.length();
+			}
+			result.append(stdLog, pos, std::string::npos);
+			sink += result.length();
+		});
+		double rebuildTime = measure([&]()
+		{
+			AString result;
+			size_t pos = 0;
+			for (size_t found = log.find(needle); found != AString::NOT_FOUND; found = log.find(needle, pos))
+			{
+				result.append(AStringView(log).substr(pos, found - pos));
+				result.append(replacement);
+				pos = found + needle.length();
+			}
+			result.append(AStringView(log).substr(pos));
+			sink += result.length();
+		});
+		AString edited(log.length() * 2);
+		edited.copy(AStringView(log));
+		double time = measure([&]() { sink += edited.replaceAll(needle, replacement); });
+		printf("  %12s %10.2f %10.2f %10.2f\n", rows[row][0], throughput(bytes, stdTime), throughput(bytes, rebuildTime), throughput(bytes, time));
+	}
+
+	printf("  %12s %10s %10s %10s\n", "case", "std", "scalar", "simd");
+	std::string stdLog(log.c_str(), log.length());
+	double stdTime = measure([&]() { std::transform(stdLog.begin(), stdLog.end(), stdLog.begin(), ::toupper); });
+	double scalarTime = measure([&]() { StringKernels<char>::convertCaseScalar(log.data(), log.length(), 'a'); });
+	double time = measure([&]() { log.toLower(); });
+	printf("  %12s %10.2f %10.2f %10.2f\n", "convert", throughput(bytes, stdTime), throughput(bytes, scalarTime), throughput(bytes, time));
+
+	// Trim, mask passwords and lower the case of every line, counting the allocations of String
+	std::vector<AStringView> lines;
+	log.replaceAll("cache hit for key", "password=secret");
+	AStringView(log).split('\n', [&](const AStringView& line) { lines.push_back(line); });
+	stdTime = measure([&]()
+	{
+		for (size_t i = 0; i < lines.size(); i++)
+		{
+			std::string message(lines[i].data(), lines[i].length());
+			size_t begin = message.find_first_not_of(" \t\r\n");
+			std::string trimmed = begin == std::string::npos ? std::string() : message.substr(begin, message.find_last_not_of(" \t\r\n") - begin + 1);
+			for (size_t found = trimmed.find("password=secret"); found != std::string::npos; found = trimmed.find("password=secret", found))
+			{
+				trimmed.replace(found, 15, "password=******");
+			}
+			std::string lower(trimmed);
+			std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+			sink += lower.length();
+		}
+	});
+	AString message(static_cast<size_t>(256));
+	size_t allocations = g_arrayAllocations;
+	time = measure([&]()
+	{
+		for (size_t i = 0; i < lines.size(); i++)
+		{
+			message.copy(lines[i]);
+			message.trim();
+			message.replaceAll("password=secret", "password=******");
+			message.toLower();
+			sink += message.length();
+		}
+	});
+	printf("  %12s %10.2f %10s %10.2f (%zu allocations for %zu lines)\n", "sanitize", throughput(bytes, stdTime), "-", throughput(bytes, time),
+		g_arrayAllocations - allocations, lines.size());
+}
+
+/**
+ * Benchmarks the parallel algorithms on a 1 GB log with pools of 1 thread up to the count of hardware threads. The
+ * replacement swaps words of equal length back and forth, so the log keeps its length.
+ */
+static void BenchParallel()
+{
+	AString log = makeLog(1024 * 1048576);
+	double bytes = static_cast<double>(log.length());
+	volatile size_t sink = 0;
+
+	// At least 2 threads show the overhead on machines with a single core
+	size_t hardwareThreads = std::thread::hardware_concurrency();
+	std::vector<size_t> threadCounts;
+	for (size_t threads = 1; threads < hardwareThreads || threads <= 2; threads *= 2)
+	{
+		threadCounts.push_back(threads);
+	}
+	if (hardwareThreads > threadCounts.back())
+	{
+		threadCounts.push_back(hardwareThreads);
+	}
+
+	printf("parallel: %zu MB log, threads (GB/s)\n", log.length() / 1048576);
+	printf("  %12s", "operation");
+	for (size_t i = 0; i < threadCounts.size(); i++)
+	{
+		printf(" %8zu", threadCounts[i]);
+	}
+	printf("\n");
+	const char* const operations[] = { "find", "count", "replaceAll", "toUpper", "splitLines", "hash lines" };
+	std::vector<std::vector<double> > results(threadCounts.size());
+	std::vector<AStringView> lines;
+	for (size_t i = 0; i < threadCounts.size(); i++)
+	{
+		StringThreadPool pool(threadCounts[i]);
+		std::vector<double>& result = results[i];
+		result.push_back(measure([&]() { sink += StringParallel::find(AStringView(log), AStringView("backend-99"), pool); }));
+		result.push_back(measure([&]() { sink += StringParallel::count(AStringView(log), AStringView("backend"), pool); }));
+		result.push_back(measure([&]()
+		{
+			sink += StringParallel::replaceAll(log, i % 2 ? AStringView("thread") : AStringView("worker"), i % 2 ? AStringView("worker") : AStringView("thread"), pool);
+		}));
+		result.push_back(measure([&]() { StringParallel::toUpper(log, pool); }));
+		StringParallel::toLower(log, pool);
+		result.push_back(measure([&]() { StringParallel::splitLines(AStringView(log), lines, pool); }));
+		std::vector<size_t> hashes(lines.size());
+		double time = measure([&]() { StringParallel::hash(lines.data(), lines.size(), hashes.data(), pool); });
+		result.push_back(time);
+		sink += hashes[0];
+	}
+	for (size_t operation = 0; operation < sizeof(operations) / sizeof(operations[0]); operation++)
+	{
+		printf("  %12s", operations[operation]);
+		for (size_t i = 0; i < threadCounts.size(); i++)
+		{
+			printf(" %8.2f", throughput(bytes, results[i][operation]));
+		}
+		printf("\n");
+	}
+}
+
+/**
+ * Entry point for the benchmark application. Runs the benchmarks named on the command line or all of them, e.g.
+ * StringBench core growth --json results.json.
+ * @param	argc	Count of command line parameters
+ * @param	argv	Command line parameters, the names of the benchmarks and --json followed by the path of a file
+ *			receiving the recorded results
+ * @return			Return code of the application
+ */
+int main(int argc, char* argv[])
+{
+	static const struct
+	{
+		const char* name;
+		void (*function)();
+	} benchmarks[] =
+	{
+		{ "layout", BenchLayout },
+		{ "core", BenchCore },
+		{ "growth", BenchGrowth },
+		{ "kernels", BenchKernels },
+		{ "allocators", BenchAllocators },
+		{ "search", BenchSearch },
+		{ "multimatcher", BenchMultiMatcher },
+		{ "hash", BenchHash },
+		{ "utf", BenchUtf },
+		{ "concat", BenchConcat },
+		{ "number", BenchNumber },
+		{ "file", BenchFile },
+		{ "editing", BenchEditing },
+		{ "parallel", BenchParallel }
+	};
+	const size_t benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+	const char* jsonPath = 0;
+	std::vector<const char*> names;
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(argv[i], "--json") && i + 1 < argc)
+		{
+			jsonPath = argv[++i];
+		}
+		else
+		{
+			names.push_back(argv[i]);
+		}
+	}
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		bool known = false;
+		for (size_t j = 0; j < benchmarkCount; j++)
+		{
+			known = known || 0 == strcmp(names[i], benchmarks[j].name);
+		}
+		if (!known)
+		{
+			fprintf(stderr, "Unknown benchmark %s\n", names[i]);
+			return 1;
+		}
+	}
+
+	for (size_t i = 0; i < benchmarkCount; i++)
+	{
+		bool selected = names.empty();
+		for (size_t j = 0; j < names.size(); j++)
+		{
+			selected = selected || 0 == strcmp(names[j], benchmarks[i].name);
+		}
+		if (selected)
+		{
+			benchmarks[i].function();
+		}
+	}
+
+	if (jsonPath && !writeJson(jsonPath))
+	{
+		fprintf(stderr, "Could not write %s\n", jsonPath);
+		return 1;
+	}
+	return 0;
+}
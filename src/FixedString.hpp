@@ -0,0 +1,819 @@
+/**
+ * @file FixedString.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef FIXEDSTRING_HPP
+#define FIXEDSTRING_HPP
+
+
+// For size_t
+#include <cstddef>
+// For uint64_t
+#include <cstdint>
+// For std::make_unsigned
+#include <type_traits>
+// For hashing in constant expressions
+#include "StringHash.hpp"
+// For concatenating FixedStrings with Strings at runtime
+#include "StringConcat.hpp"
+#include "String.hpp"
+
+
+/**
+ * @struct FixedIndices
+ * Sequence of indices, which is expanded to initialize the characters of a FixedString one by one.
+ */
+template<size_t... I>
+struct FixedIndices
+{
+};
+
+/**
+ * @struct FixedIndicesJoin
+ * Appends a sequence of indices behind another one, shifted by the length of the first one.
+ */
+template<class TFirst, class TSecond>
+struct FixedIndicesJoin;
+
+template<size_t... I, size_t... J>
+struct FixedIndicesJoin<FixedIndices<I...>, FixedIndices<J...> >
+{
+	typedef FixedIndices<I..., (sizeof...(I) + J)...> Type;
+};
+
+/**
+ * @struct MakeFixedIndices
+ * Creates the sequence of the indices from 0 to N - 1 by joining two halves, so the depth of the template recursion
+ * only grows logarithmically with N.
+ */
+template<size_t N>
+struct MakeFixedIndices
+{
+	typedef typename FixedIndicesJoin<typename MakeFixedIndices<N / 2>::Type, typename MakeFixedIndices<N - N / 2>::Type>::Type Type;
+};
+
+template<>
+struct MakeFixedIndices<0>
+{
+	typedef FixedIndices<> Type;
+};
+
+template<>
+struct MakeFixedIndices<1>
+{
+	typedef FixedIndices<0> Type;
+};
+
+/**
+ * @struct FixedLength
+ * Sums up the lengths of FixedStrings.
+ */
+template<size_t... N>
+struct FixedLength;
+
+template<>
+struct FixedLength<>
+{
+	static const size_t value = 0;
+};
+
+template<size_t FIRST, size_t... REST>
+struct FixedLength<FIRST, REST...>
+{
+	static const size_t value = FIRST + FixedLength<REST...>::value;
+};
+
+/**
+ * @class FixedString
+ * Immutable string of N characters, which is a literal type usable in constant expressions. Length, comparison, hash
+ * and concatenation are calculated at compile time when used in a constant expression, the hash equals the one of
+ * StringView::hash. Converting to a StringView takes O(1) and a String is created from the view, which copies the known
+ * length without scanning for the terminating 0. Functions working on the characters recurse by halving the range, so
+ * the recursion depth of constant expressions only grows logarithmically with the length. Instances are created from
+ * string literals using makeFixedString.
+ */
+template<class TChar, size_t N>
+class FixedString
+{
+private:
+	template<class, size_t>
+	friend class FixedString;
+
+	// Characters including the terminating 0
+	TChar m_data[N + 1];
+
+	/**
+	 * Constructor which copies the characters of a string.
+	 * @param	str	Characters to copy, at least N
+	 */
+	template<size_t... I>
+	constexpr FixedString(const TChar* str, FixedIndices<I...>);
+
+	/**
+	 * Constructor which concatenates two strings.
+	 * @param	lhs	First string
+	 * @param	rhs	Second string
+	 */
+	template<size_t M, size_t... I>
+	constexpr FixedString(const FixedString<TChar, N - M>& lhs, const FixedString<TChar, M>& rhs, FixedIndices<I...>);
+
+	/**
+	 * Searches the first position at which the string differs from another one.
+	 * @param	other	String to compare to
+	 * @param	begin	First position to compare
+	 * @param	end	End of the positions to compare, at most the length of both strings
+	 * @return		First differing position, end if all characters are equal
+	 */
+	template<size_t M>
+	constexpr size_t mismatch(const FixedString<TChar, M>& other, size_t begin, size_t end) const;
+
+	/**
+	 * Compares the characters at a position, at which the strings differ or one of them ends.
+	 * @param	other	String to compare to
+	 * @param	index	Position returned by mismatch
+	 * @return		Negative, zero or positive like compare
+	 */
+	template<size_t M>
+	constexpr int compareAt(const FixedString<TChar, M>& other, size_t index) const;
+
+public:
+	/**
+	 * Constructor which copies a string literal.
+	 * @param	str	String literal of N characters
+	 */
+	constexpr FixedString(const TChar (&str)[N + 1]);
+
+	/**
+	 * Returns the length of the string.
+	 * @return	Count of characters
+	 */
+	constexpr size_t length() const;
+
+	/**
+	 * Returns the characters of the string.
+	 * @return	Zero-terminated characters
+	 */
+	constexpr const TChar* data() const;
+
+	/**
+	 * Returns the characters of the string.
+	 * @return	Zero-terminated characters
+	 */
+	constexpr const TChar* c_str() const;
+
+	/**
+	 * Compares the string to another one, see StringView::compare.
+	 * @param	other	String to compare to
+	 * @return		Negative, zero or positive if the string is less than, equal to or greater than other
+	 */
+	template<size_t M>
+	constexpr int compare(const FixedString<TChar, M>& other) const;
+
+	/**
+	 * Calculates the hash of the characters, which equals StringView::hash of the same characters.
+	 * @return	Hash of the characters
+	 */
+	constexpr size_t hash() const;
+
+	/**
+	 * Returns a view of the characters.
+	 * @return	View of the characters
+	 */
+	operator StringView<TChar>() const;
+
+	/**
+	 * Index operator.
+	 * @param	index	Position of the character, at most N for the terminating 0
+	 * @return		Character at the position
+	 */
+	constexpr TChar operator[](size_t index) const;
+
+	/**
+	 * Concatenation operator.
+	 * @param	other	String to append
+	 * @return		String of both strings
+	 */
+	template<size_t M>
+	constexpr FixedString<TChar, N + M> operator+(const FixedString<TChar, M>& other) const;
+
+	/**
+	 * Concatenation operator.
+	 * @param	str	String literal to append
+	 * @return		String of both strings
+	 */
+	template<size_t M>
+	constexpr FixedString<TChar, N + M - 1> operator+(const TChar (&str)[M]) const;
+
+	/**
+	 * Equal operator.
+	 * @param	other	String to compare to
+	 * @return		true if both strings are equal, otherwise false
+	 */
+	template<size_t M>
+	constexpr bool operator==(const FixedString<TChar, M>& other) const;
+
+	/**
+	 * Unequal operator.
+	 * @param	other	String to compare to
+	 * @return		true if the strings differ, otherwise false
+	 */
+	template<size_t M>
+	constexpr bool operator!=(const FixedString<TChar, M>& other) const;
+
+	/**
+	 * Less operator.
+	 * @param	other	String to compare to
+	 * @return		true if the string is less than other, otherwise false
+	 */
+	template<size_t M>
+	constexpr bool operator<(const FixedString<TChar, M>& other) const;
+};
+
+/**
+ * Creates a FixedString from a string literal.
+ * @param	str	String literal
+ * @return		FixedString of the characters without the terminating 0
+ */
+template<class TChar, size_t N>
+constexpr FixedString<TChar, N - 1> makeFixedString(const TChar (&str)[N]);
+
+/**
+ * Concatenation operator prepending a string literal.
+ * @param	lhs	String literal to prepend
+ * @param	rhs	String to append
+ * @return		String of both strings
+ */
+template<class TChar, size_t M, size_t N>
+constexpr FixedString<TChar, M - 1 + N> operator+(const TChar (&lhs)[M], const FixedString<TChar, N>& rhs);
+
+/**
+ * FixedStrings are referred to by concatenations of Strings.
+ */
+template<class TChar, size_t N>
+struct StringPieceType<TChar, FixedString<TChar, N> >
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+/**
+ * @class FixedStringTable
+ * Perfect hash table of COUNT FixedStrings of CHARACTERS characters altogether, which is calculated at compile time
+ * using makeFixedStringTable. A constexpr table is stored in the read-only data of the program, so it needs no
+ * initialization at startup. Looking up a string hashes it once using StringHash, selects one of COUNT buckets by the
+ * hash and one slot inside the bucket by the hash mixed with a seed of the bucket, then compares the string to the only
+ * key which may be stored in the slot. The seeds are searched at compile time like in the two-level scheme of Fredman,
+ * Komls and Szemerdi: the first seed spreads the keys over the buckets so the squares of their counts of keys sum up
+ * to at most 3 * COUNT, then the keys of every bucket get distinct slots among the square of their count of slots.
+ * Calculating the table takes O(COUNT log^2 COUNT) steps with a recursion depth of O(log COUNT): the keys are sorted into
+ * their buckets by a merge sort, whose merged elements are found by binary searches, and the bucket offsets are prefix
+ * sums. With the default limits of GCC this suits up to about 800 keys, more keys need a higher -ftemplate-depth.
+ */
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+class FixedStringTable
+{
+public:
+	// Count of slots, which is the bound of the sum of the squares of the counts of keys of the buckets
+	static const size_t SLOTS = 3 * COUNT;
+	// Returned by find if a string is no key
+	static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+private:
+	static_assert(COUNT > 0, "A FixedStringTable needs at least one key");
+
+	// Count of seeds tried for the buckets and for every bucket
+	static const uint64_t SEED_TRIES = 64;
+
+	/**
+	 * @struct Array
+	 * Array which can be returned by functions in constant expressions.
+	 */
+	template<class T, size_t SIZE>
+	struct Array
+	{
+		// Elements
+		T values[SIZE];
+
+		/**
+		 * Index operator.
+		 * @param	index	Index of the element
+		 * @return		Element at the index
+		 */
+		constexpr const T& operator[](size_t index) const;
+	};
+
+	/**
+	 * @struct Keys
+	 * Characters of all keys and the start of every key in them.
+	 */
+	struct Keys
+	{
+		// Characters of the keys one after the other
+		Array<TChar, CHARACTERS + 1> characters;
+		// Start of every key, followed by CHARACTERS
+		Array<size_t, COUNT + 1> offsets;
+	};
+
+	/**
+	 * @struct Buckets
+	 * Keys distributed to the buckets by the first seed.
+	 */
+	struct Buckets
+	{
+		// Seed of the hashes of the keys
+		uint64_t seed;
+		// Hashes of the keys
+		Array<uint64_t, COUNT> hashes;
+		// Indices of the keys ordered by their hashes, which orders them by their buckets
+		Array<size_t, COUNT> order;
+		// First position of every bucket in order, followed by COUNT
+		Array<size_t, COUNT + 1> starts;
+		// Count of keys of every bucket
+		Array<size_t, COUNT> counts;
+		// First slot of every bucket, followed by the count of slots of all buckets
+		Array<size_t, COUNT + 1> offsets;
+	};
+
+	/**
+	 * @struct SameSlot
+	 * Function object returning 1 for the keys of a bucket sharing the slot of one of them.
+	 */
+	struct SameSlot
+	{
+		// Keys distributed to the buckets
+		const Buckets& buckets;
+		// Index of the bucket
+		size_t index;
+		// Seed of the bucket
+		uint64_t seed;
+		// Position of the key in the order of the buckets
+		size_t position;
+
+		/**
+		 * Checks if another key shares the slot of the key.
+		 * @param	other	Position of the other key in the order of the buckets
+		 * @return		1 if the keys share their slot, otherwise 0
+		 */
+		constexpr size_t operator()(size_t other) const;
+	};
+
+	/**
+	 * @struct Collisions
+	 * Function object counting the keys of a bucket behind one of them which share its slot.
+	 */
+	struct Collisions
+	{
+		// Keys distributed to the buckets
+		const Buckets& buckets;
+		// Index of the bucket
+		size_t index;
+		// Seed of the bucket
+		uint64_t seed;
+		// End of the bucket in the order of the buckets
+		size_t end;
+
+		/**
+		 * Counts the keys behind a key which share its slot.
+		 * @param	position	Position of the key in the order of the buckets
+		 * @return			Count of keys sharing the slot
+		 */
+		constexpr size_t operator()(size_t position) const;
+	};
+
+	/**
+	 * @struct Unresolved
+	 * Function object returning 1 for buckets whose seed does not select distinct slots.
+	 */
+	struct Unresolved
+	{
+		// Keys distributed to the buckets
+		const Buckets& buckets;
+		// Seed of every bucket
+		const Array<uint64_t, COUNT>& seeds;
+
+		/**
+		 * Checks if the seed of a bucket selects distinct slots.
+		 * @param	index	Index of the bucket
+		 * @return		0 if the slots of the keys of the bucket are distinct, otherwise 1
+		 */
+		constexpr size_t operator()(size_t index) const;
+	};
+
+	// Characters of all keys
+	Array<TChar, CHARACTERS + 1> m_characters;
+	// Start of every key in m_characters, followed by CHARACTERS
+	Array<size_t, COUNT + 1> m_offsets;
+	// Seed of the hash selecting the bucket
+	uint64_t m_seed;
+	// Seed of every bucket selecting the slot
+	Array<uint64_t, COUNT> m_bucketSeeds;
+	// First slot of every bucket, followed by the count of slots of all buckets
+	Array<size_t, COUNT + 1> m_bucketOffsets;
+	// Count of slots of every bucket, the square of its count of keys
+	Array<size_t, COUNT> m_bucketSizes;
+	// Index of the key stored in every slot, COUNT for empty slots
+	Array<size_t, SLOTS> m_slots;
+	// Whether the seeds of all buckets were found
+	bool m_valid;
+
+	/**
+	 * Sums up a function of the indices of a range, which is halved for the recursion.
+	 * @param	function	Function object called with every index
+	 * @param	begin		First index
+	 * @param	end		End of the indices
+	 * @return			Sum of the results
+	 */
+	template<class TFunction>
+	static constexpr size_t sum(const TFunction& function, size_t begin, size_t end);
+
+	/**
+	 * Selects a bucket by a hash. Buckets grow with the hash, so keys ordered by their hashes are ordered by their
+	 * buckets.
+	 * @param	hash	Hash of a key
+	 * @return		Index of the bucket
+	 */
+	static constexpr size_t bucket(uint64_t hash);
+
+	/**
+	 * Selects a slot inside a bucket by a hash.
+	 * @param	hash	Hash of a key
+	 * @param	seed	Seed of the bucket
+	 * @param	size	Count of slots of the bucket
+	 * @return		Index of the slot relative to the first slot of the bucket
+	 */
+	static constexpr size_t slot(uint64_t hash, uint64_t seed, size_t size);
+
+	/**
+	 * Checks if two ranges of characters are equal.
+	 * @param	a	First characters
+	 * @param	b	Second characters
+	 * @param	begin	First position to compare
+	 * @param	end	End of the positions to compare
+	 * @return		true if all characters of the range are equal, otherwise false
+	 */
+	static constexpr bool equal(const TChar* a, const TChar* b, size_t begin, size_t end);
+
+	/**
+	 * Returns the character at a position of the concatenated keys.
+	 * @param	keys	Start of every key
+	 * @param	offsets	Start of every key in the concatenated keys, followed by CHARACTERS
+	 * @param	index	Position in the concatenated keys
+	 * @param	first	First key which may contain the position
+	 * @param	end	End of the keys which may contain the position
+	 * @return		Character at the position
+	 */
+	static constexpr TChar character(const Array<const TChar*, COUNT>& keys, const Array<size_t, COUNT + 1>& offsets,
+		size_t index, size_t first, size_t end);
+
+	/**
+	 * Concatenates the keys.
+	 * @param	keys	Start of every key
+	 * @param	offsets	Start of every key in the concatenated keys, followed by CHARACTERS
+	 * @return		Concatenated keys
+	 */
+	template<size_t... C>
+	static constexpr Keys makeKeys(const Array<const TChar*, COUNT>& keys, const Array<size_t, COUNT + 1>& offsets,
+		FixedIndices<C...>);
+
+	/**
+	 * Adds every element to the one width positions behind it, one step of scan.
+	 * @param	sums	Sums of the ranges of width elements ending at every position
+	 * @param	width	Width of the ranges
+	 * @return		Sums of the ranges of twice the width
+	 */
+	template<size_t... K>
+	static constexpr Array<size_t, COUNT> scanLevel(const Array<size_t, COUNT>& sums, size_t width, FixedIndices<K...>);
+
+	/**
+	 * Calculates the prefix sums of an array in a logarithmic count of steps.
+	 * @param	sums	Sums of the ranges of width elements ending at every position
+	 * @param	width	Width of the ranges, 1 for the elements
+	 * @return		Sum of the elements up to and including every position
+	 */
+	static constexpr Array<size_t, COUNT> scan(const Array<size_t, COUNT>& sums, size_t width);
+
+	/**
+	 * Calculates the start of every range of a sequence of ranges.
+	 * @param	sizes	Size of every range
+	 * @param	sums	Prefix sums of the sizes calculated by scan
+	 * @return		Start of every range, followed by the sum of all sizes
+	 */
+	template<size_t... K>
+	static constexpr Array<size_t, COUNT + 1> makeOffsets(const Array<size_t, COUNT>& sizes, const Array<size_t, COUNT>& sums,
+		FixedIndices<K...>);
+
+	/**
+	 * Calculates the hashes of the keys.
+	 * @param	keys	Concatenated keys
+	 * @param	seed	Seed of the hashes
+	 * @return		Hash of every key
+	 */
+	template<size_t... K>
+	static constexpr Array<uint64_t, COUNT> makeHashes(const Keys& keys, uint64_t seed, FixedIndices<K...>);
+
+	/**
+	 * Compares two keys by their hashes and their indices.
+	 * @param	hashes	Hashes of the keys
+	 * @param	a	Index of the first key
+	 * @param	b	Index of the second key
+	 * @return		true if key a is ordered before key b, otherwise false
+	 */
+	static constexpr bool before(const Array<uint64_t, COUNT>& hashes, size_t a, size_t b);
+
+	/**
+	 * Searches how many keys of the first of two ordered runs are among the first keys of both runs merged.
+	 * @param	hashes		Hashes of the keys
+	 * @param	order		Indices of the keys, the runs are ordered
+	 * @param	start		Position of the first run, the second one follows it
+	 * @param	lengthA		Length of the first run
+	 * @param	lengthB		Length of the second run
+	 * @param	position	Count of keys of the merged runs
+	 * @param	low		Lowest possible result
+	 * @param	high		Highest possible result
+	 * @return			Count of keys of the first run among the first position keys of the merged runs
+	 */
+	static constexpr size_t coRank(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order, size_t start,
+		size_t lengthA, size_t lengthB, size_t position, size_t low, size_t high);
+
+	/**
+	 * Returns the key following the first keys of two merged runs.
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys, the runs are ordered
+	 * @param	start	Position of the first run, the second one follows it
+	 * @param	lengthA	Length of the first run
+	 * @param	lengthB	Length of the second run
+	 * @param	takenA	Count of keys taken from the first run
+	 * @param	takenB	Count of keys taken from the second run
+	 * @return		Index of the next key
+	 */
+	static constexpr size_t pick(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order, size_t start,
+		size_t lengthA, size_t lengthB, size_t takenA, size_t takenB);
+
+	/**
+	 * Returns a key of two merged runs.
+	 * @param	hashes		Hashes of the keys
+	 * @param	order		Indices of the keys, the runs are ordered
+	 * @param	start		Position of the first run, the second one follows it
+	 * @param	lengthA		Length of the first run
+	 * @param	lengthB		Length of the second run
+	 * @param	position	Position in the merged runs
+	 * @return			Index of the key at the position
+	 */
+	static constexpr size_t mergeRuns(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order, size_t start,
+		size_t lengthA, size_t lengthB, size_t position);
+
+	/**
+	 * Returns a key of the runs of twice a width merged from the ordered runs of the width.
+	 * @param	hashes		Hashes of the keys
+	 * @param	order		Indices of the keys, runs of width keys are ordered
+	 * @param	width		Width of the ordered runs
+	 * @param	start		Position of the pair of runs containing the position
+	 * @param	position	Position in the merged runs
+	 * @return			Index of the key at the position
+	 */
+	static constexpr size_t mergeAt(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order, size_t width,
+		size_t start, size_t position);
+
+	/**
+	 * Merges every pair of ordered runs of a width, one step of sortKeys.
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys, runs of width keys are ordered
+	 * @param	width	Width of the ordered runs
+	 * @return		Indices of the keys, runs of twice the width are ordered
+	 */
+	template<size_t... K>
+	static constexpr Array<size_t, COUNT> mergeLevel(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+		size_t width, FixedIndices<K...>);
+
+	/**
+	 * Orders the keys by their hashes using a merge sort, each merge finds every key by a binary search.
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys, runs of width keys are ordered
+	 * @param	width	Width of the ordered runs, 1 for unordered keys
+	 * @return		Indices of the keys ordered by their hashes
+	 */
+	static constexpr Array<size_t, COUNT> sortKeys(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+		size_t width);
+
+	/**
+	 * Searches the first position of a bucket in the ordered keys.
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys ordered by their hashes
+	 * @param	index	Index of the bucket
+	 * @param	begin	First position to search
+	 * @param	end	End of the positions to search
+	 * @return		First position of a key of the bucket or a later one, end if there is none
+	 */
+	static constexpr size_t lowerBound(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order, size_t index,
+		size_t begin, size_t end);
+
+	/**
+	 * Searches the first position of every bucket in the ordered keys.
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys ordered by their hashes
+	 * @return		First position of every bucket, followed by COUNT
+	 */
+	template<size_t... B>
+	static constexpr Array<size_t, COUNT + 1> makeStarts(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+		FixedIndices<B...>);
+
+	/**
+	 * Distributes the keys to the buckets.
+	 * @param	seed	Seed of the hashes
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys ordered by their hashes
+	 * @param	starts	First position of every bucket, followed by COUNT
+	 * @return		Keys distributed to the buckets
+	 */
+	template<size_t... K>
+	static constexpr Buckets makeBuckets(uint64_t seed, const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+		const Array<size_t, COUNT + 1>& starts, FixedIndices<K...>);
+
+	/**
+	 * Distributes the keys to the buckets.
+	 * @param	seed	Seed of the hashes
+	 * @param	hashes	Hashes of the keys
+	 * @param	order	Indices of the keys ordered by their hashes
+	 * @param	starts	First position of every bucket, followed by COUNT
+	 * @param	squares	Square of the count of keys of every bucket
+	 * @return		Keys distributed to the buckets
+	 */
+	template<size_t... K>
+	static constexpr Buckets makeBuckets(uint64_t seed, const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+		const Array<size_t, COUNT + 1>& starts, const Array<size_t, COUNT>& squares, FixedIndices<K...>);
+
+	/**
+	 * Distributes the keys to the buckets by their hashes.
+	 * @param	seed	Seed of the hashes
+	 * @param	hashes	Hashes of the keys
+	 * @return		Keys distributed to the buckets
+	 */
+	template<size_t... K>
+	static constexpr Buckets distribute(uint64_t seed, const Array<uint64_t, COUNT>& hashes, FixedIndices<K...>);
+
+	/**
+	 * Distributes the keys to the buckets using a seed.
+	 * @param	keys	Concatenated keys
+	 * @param	seed	Seed of the hashes
+	 * @return		Keys distributed to the buckets
+	 */
+	static constexpr Buckets distribute(const Keys& keys, uint64_t seed);
+
+	/**
+	 * Searches the first seed for which the squares of the counts of keys of the buckets sum up to at most SLOTS.
+	 * @param	keys	Concatenated keys
+	 * @param	buckets	Keys distributed to the buckets by the first seed to try
+	 * @return		Keys distributed by the found seed, by the last tried one if there is none
+	 */
+	static constexpr Buckets searchBuckets(const Keys& keys, const Buckets& buckets);
+
+	/**
+	 * Checks if a seed selects distinct slots for the keys of a bucket.
+	 * @param	buckets	Keys distributed to the buckets
+	 * @param	bucket	Index of the bucket
+	 * @param	seed	Seed to check
+	 * @return		true if the slots are distinct, otherwise false
+	 */
+	static constexpr bool distinct(const Buckets& buckets, size_t bucket, uint64_t seed);
+
+	/**
+	 * Searches the first seed selecting distinct slots for the keys of a bucket.
+	 * @param	buckets	Keys distributed to the buckets
+	 * @param	bucket	Index of the bucket
+	 * @param	seed	First seed to try
+	 * @return		Found seed, the last tried one if there is none
+	 */
+	static constexpr uint64_t searchBucketSeed(const Buckets& buckets, size_t bucket, uint64_t seed);
+
+	/**
+	 * Searches the bucket owning a slot.
+	 * @param	offsets	First slot of every bucket
+	 * @param	index	Index of the slot
+	 * @param	begin	First bucket which may own the slot
+	 * @param	end	End of the buckets which may own the slot
+	 * @return		Last bucket starting at or before the slot
+	 */
+	static constexpr size_t lastBucket(const Array<size_t, COUNT + 1>& offsets, size_t index, size_t begin, size_t end);
+
+	/**
+	 * Searches the key of a bucket stored in a slot.
+	 * @param	buckets		Keys distributed to the buckets
+	 * @param	seeds		Seed of every bucket
+	 * @param	bucket		Index of the bucket
+	 * @param	index		Index of the slot relative to the first slot of the bucket
+	 * @param	position	Position of the first key of the bucket to check
+	 * @return			Index of the key, COUNT if the slot is empty
+	 */
+	static constexpr size_t keyInBucket(const Buckets& buckets, const Array<uint64_t, COUNT>& seeds, size_t bucket, size_t index,
+		size_t position);
+
+	/**
+	 * Searches the key stored in a slot.
+	 * @param	buckets	Keys distributed to the buckets
+	 * @param	seeds	Seed of every bucket
+	 * @param	bucket	Bucket owning the slot if any
+	 * @param	index	Index of the slot
+	 * @return		Index of the key, COUNT if the slot is empty
+	 */
+	static constexpr size_t keyInSlot(const Buckets& buckets, const Array<uint64_t, COUNT>& seeds, size_t bucket, size_t index);
+
+	/**
+	 * Constructor which calculates the table for concatenated keys.
+	 * @param	keys	Concatenated keys
+	 */
+	explicit constexpr FixedStringTable(const Keys& keys);
+
+	/**
+	 * Constructor which calculates the table for keys distributed to the buckets.
+	 * @param	keys	Concatenated keys
+	 * @param	buckets	Keys distributed to the buckets
+	 */
+	template<size_t... K>
+	constexpr FixedStringTable(const Keys& keys, const Buckets& buckets, FixedIndices<K...>);
+
+	/**
+	 * Constructor which stores the keys in their slots.
+	 * @param	keys	Concatenated keys
+	 * @param	buckets	Keys distributed to the buckets
+	 * @param	seeds	Seed of every bucket
+	 */
+	template<size_t... K, size_t... S>
+	constexpr FixedStringTable(const Keys& keys, const Buckets& buckets, const Array<uint64_t, COUNT>& seeds,
+		FixedIndices<K...>, FixedIndices<S...>);
+
+	/**
+	 * Returns the key which may be stored under a hash.
+	 * @param	hash	Hash of a string using m_seed
+	 * @return		Index of the key in the slot of the hash, COUNT if the slot is empty
+	 */
+	constexpr size_t candidate(uint64_t hash) const;
+
+	/**
+	 * Compares a key to a FixedString.
+	 * @param	index	Index of the key, COUNT for none
+	 * @param	str	String to compare
+	 * @return		index if the key equals str, otherwise NOT_FOUND
+	 */
+	template<size_t N>
+	constexpr size_t match(size_t index, const FixedString<TChar, N>& str) const;
+
+public:
+	/**
+	 * Constructor which calculates the table for keys. Use makeFixedStringTable to deduce the template parameters.
+	 * @param	keys	Distinct keys
+	 */
+	template<size_t... N>
+	explicit constexpr FixedStringTable(const FixedString<TChar, N>&... keys);
+
+	/**
+	 * Returns the count of keys.
+	 * @return	Count of keys
+	 */
+	constexpr size_t size() const;
+
+	/**
+	 * Checks if seeds for all buckets were found, which only fails if keys are not distinct. Tables which are not
+	 * valid find nothing, so they should be checked using static_assert.
+	 * @return	true if the table is valid, otherwise false
+	 */
+	constexpr bool valid() const;
+
+	/**
+	 * Returns a key.
+	 * @param	index	Index of the key in the order of the keys passed on construction
+	 * @return		View of the key
+	 */
+	StringView<TChar> key(size_t index) const;
+
+	/**
+	 * Searches a string in the keys.
+	 * @param	str	String to search
+	 * @return		Index of the key in the order of the keys passed on construction, NOT_FOUND if str is no key
+	 */
+	size_t find(const StringView<TChar>& str) const;
+
+	/**
+	 * Searches a FixedString in the keys, which may be evaluated at compile time.
+	 * @param	str	String to search
+	 * @return		Index of the key in the order of the keys passed on construction, NOT_FOUND if str is no key
+	 */
+	template<size_t N>
+	constexpr size_t find(const FixedString<TChar, N>& str) const;
+};
+
+/**
+ * Creates a perfect hash table of FixedStrings at compile time, e.g.
+ * constexpr auto methods = makeFixedStringTable(makeFixedString("GET"), makeFixedString("POST"));
+ * @param	keys	Distinct keys
+ * @return		Table of the keys
+ */
+template<class TChar, size_t... N>
+constexpr FixedStringTable<TChar, sizeof...(N), FixedLength<N...>::value> makeFixedStringTable(const FixedString<TChar, N>&... keys);
+
+
+// Include FixedString class implementation
+#include "FixedString.tpp"
+
+
+#endif // #ifndef FIXEDSTRING_HPP
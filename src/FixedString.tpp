@@ -0,0 +1,502 @@
+/**
+ * @file FixedString.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef FIXEDSTRING_HPP
+#error FIXEDSTRING_HPP undefined
+#endif
+
+template<class TChar, size_t N>
+template<size_t... I>
+constexpr FixedString<TChar, N>::FixedString(const TChar* str, FixedIndices<I...>)
+	: m_data{ str[I]..., static_cast<TChar>(0) }
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t N>
+template<size_t M, size_t... I>
+constexpr FixedString<TChar, N>::FixedString(const FixedString<TChar, N - M>& lhs, const FixedString<TChar, M>& rhs, FixedIndices<I...>)
+	: m_data{ (I < N - M ? lhs.m_data[I] : rhs.m_data[I - (N - M)])..., static_cast<TChar>(0) }
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr size_t FixedString<TChar, N>::mismatch(const FixedString<TChar, M>& other, size_t begin, size_t end) const
+{
+	return end - begin == 0 ? end :
+		end - begin == 1 ? (m_data[begin] == other.m_data[begin] ? end : begin) :
+		mismatch(other, begin, begin + (end - begin) / 2) != begin + (end - begin) / 2 ? mismatch(other, begin, begin + (end - begin) / 2) :
+		mismatch(other, begin + (end - begin) / 2, end);
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr int FixedString<TChar, N>::compareAt(const FixedString<TChar, M>& other, size_t index) const
+{
+	// Characters are ordered as unsigned values like in StringView::compare
+	return index < N && index < M ?
+		(static_cast<typename std::make_unsigned<TChar>::type>(m_data[index]) <
+		static_cast<typename std::make_unsigned<TChar>::type>(other.m_data[index]) ? -1 : 1) :
+		N == M ? 0 : (N < M ? -1 : 1);
+}
+
+template<class TChar, size_t N>
+constexpr FixedString<TChar, N>::FixedString(const TChar (&str)[N + 1])
+	: FixedString(str, typename MakeFixedIndices<N>::Type())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t N>
+constexpr size_t FixedString<TChar, N>::length() const
+{
+	return N;
+}
+
+template<class TChar, size_t N>
+constexpr const TChar* FixedString<TChar, N>::data() const
+{
+	return m_data;
+}
+
+template<class TChar, size_t N>
+constexpr const TChar* FixedString<TChar, N>::c_str() const
+{
+	return m_data;
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr int FixedString<TChar, N>::compare(const FixedString<TChar, M>& other) const
+{
+	return compareAt(other, mismatch(other, 0, N < M ? N : M));
+}
+
+template<class TChar, size_t N>
+constexpr size_t FixedString<TChar, N>::hash() const
+{
+	return static_cast<size_t>(StringHash::hashConstant(m_data, N));
+}
+
+template<class TChar, size_t N>
+FixedString<TChar, N>::operator StringView<TChar>() const
+{
+	return StringView<TChar>(m_data, N);
+}
+
+template<class TChar, size_t N>
+constexpr TChar FixedString<TChar, N>::operator[](size_t index) const
+{
+	return m_data[index];
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr FixedString<TChar, N + M> FixedString<TChar, N>::operator+(const FixedString<TChar, M>& other) const
+{
+	return FixedString<TChar, N + M>(*this, other, typename MakeFixedIndices<N + M>::Type());
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr FixedString<TChar, N + M - 1> FixedString<TChar, N>::operator+(const TChar (&str)[M]) const
+{
+	return *this + FixedString<TChar, M - 1>(str);
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr bool FixedString<TChar, N>::operator==(const FixedString<TChar, M>& other) const
+{
+	return N == M && mismatch(other, 0, N) == N;
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr bool FixedString<TChar, N>::operator!=(const FixedString<TChar, M>& other) const
+{
+	return !(*this == other);
+}
+
+template<class TChar, size_t N>
+template<size_t M>
+constexpr bool FixedString<TChar, N>::operator<(const FixedString<TChar, M>& other) const
+{
+	return compare(other) < 0;
+}
+
+template<class TChar, size_t N>
+constexpr FixedString<TChar, N - 1> makeFixedString(const TChar (&str)[N])
+{
+	return FixedString<TChar, N - 1>(str);
+}
+
+template<class TChar, size_t M, size_t N>
+constexpr FixedString<TChar, M - 1 + N> operator+(const TChar (&lhs)[M], const FixedString<TChar, N>& rhs)
+{
+	return FixedString<TChar, M - 1>(lhs) + rhs;
+}
+
+
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<class T, size_t SIZE>
+constexpr const T& FixedStringTable<TChar, COUNT, CHARACTERS>::Array<T, SIZE>::operator[](size_t index) const
+{
+	return values[index];
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::SameSlot::operator()(size_t other) const
+{
+	return slot(buckets.hashes[buckets.order[position]], seed, buckets.counts[index] * buckets.counts[index]) ==
+		slot(buckets.hashes[buckets.order[other]], seed, buckets.counts[index] * buckets.counts[index]) ? 1 : 0;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::Collisions::operator()(size_t position) const
+{
+	return sum(SameSlot{ buckets, index, seed, position }, position + 1, end);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::Unresolved::operator()(size_t index) const
+{
+	return distinct(buckets, index, seeds[index]) ? 0 : 1;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<class TFunction>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::sum(const TFunction& function, size_t begin, size_t end)
+{
+	return end <= begin ? 0 :
+		end - begin == 1 ? function(begin) :
+		sum(function, begin, begin + (end - begin) / 2) + sum(function, begin + (end - begin) / 2, end);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::bucket(uint64_t hash)
+{
+	// Scale the high half of the hash to the count of buckets without a division
+	return static_cast<size_t>(((hash >> 32) * COUNT) >> 32);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::slot(uint64_t hash, uint64_t seed, size_t size)
+{
+	// Mix the whole hash with the seed by a multiplication and scale the high half of the product to the slots
+	return static_cast<size_t>(((((hash ^ seed) * 0x9e3779b97f4a7c15ULL) >> 32) * size) >> 32);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr bool FixedStringTable<TChar, COUNT, CHARACTERS>::equal(const TChar* a, const TChar* b, size_t begin, size_t end)
+{
+	return end <= begin ? true :
+		end - begin == 1 ? a[begin] == b[begin] :
+		equal(a, b, begin, begin + (end - begin) / 2) && equal(a, b, begin + (end - begin) / 2, end);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr TChar FixedStringTable<TChar, COUNT, CHARACTERS>::character(const Array<const TChar*, COUNT>& keys,
+	const Array<size_t, COUNT + 1>& offsets, size_t index, size_t first, size_t end)
+{
+	// Search the last key starting at or before the position, which is not empty
+	return end - first == 1 ? keys[first][index - offsets[first]] :
+		offsets[first + (end - first) / 2] <= index ? character(keys, offsets, index, first + (end - first) / 2, end) :
+		character(keys, offsets, index, first, first + (end - first) / 2);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... C>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Keys FixedStringTable<TChar, COUNT, CHARACTERS>::makeKeys(
+	const Array<const TChar*, COUNT>& keys, const Array<size_t, COUNT + 1>& offsets, FixedIndices<C...>)
+{
+	return Keys{ { { character(keys, offsets, C, 0, COUNT)..., static_cast<TChar>(0) } }, offsets };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT> FixedStringTable<TChar, COUNT, CHARACTERS>::scanLevel(const Array<size_t, COUNT>& sums, size_t width,
+	FixedIndices<K...>)
+{
+	return Array<size_t, COUNT>{ { (K >= width ? sums[K] + sums[K - width] : sums[K])... } };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT> FixedStringTable<TChar, COUNT, CHARACTERS>::scan(const Array<size_t, COUNT>& sums, size_t width)
+{
+	return width >= COUNT ? sums : scan(scanLevel(sums, width, typename MakeFixedIndices<COUNT>::Type()), 2 * width);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT + 1> FixedStringTable<TChar, COUNT, CHARACTERS>::makeOffsets(const Array<size_t, COUNT>& sizes,
+	const Array<size_t, COUNT>& sums, FixedIndices<K...>)
+{
+	return Array<size_t, COUNT + 1>{ { (sums[K] - sizes[K])..., sums[COUNT - 1] } };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<uint64_t, COUNT> FixedStringTable<TChar, COUNT, CHARACTERS>::makeHashes(
+	const Keys& keys, uint64_t seed, FixedIndices<K...>)
+{
+	return Array<uint64_t, COUNT>{ { StringHash::hashConstant(keys.characters.values + keys.offsets[K],
+		keys.offsets[K + 1] - keys.offsets[K], seed)... } };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr bool FixedStringTable<TChar, COUNT, CHARACTERS>::before(const Array<uint64_t, COUNT>& hashes, size_t a, size_t b)
+{
+	return hashes[a] < hashes[b] || (hashes[a] == hashes[b] && a < b);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::coRank(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+	size_t start, size_t lengthA, size_t lengthB, size_t position, size_t low, size_t high)
+{
+	// Taking (low + high) / 2 keys of the first run is enough if its next key follows the last one taken of the second
+	return low == high ? low :
+		(low + high) / 2 >= lengthA || position == (low + high) / 2 ||
+		before(hashes, order[start + lengthA + position - (low + high) / 2 - 1], order[start + (low + high) / 2]) ?
+		coRank(hashes, order, start, lengthA, lengthB, position, low, (low + high) / 2) :
+		coRank(hashes, order, start, lengthA, lengthB, position, (low + high) / 2 + 1, high);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::pick(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+	size_t start, size_t lengthA, size_t lengthB, size_t takenA, size_t takenB)
+{
+	return takenA < lengthA && (takenB >= lengthB || before(hashes, order[start + takenA], order[start + lengthA + takenB])) ?
+		order[start + takenA] : order[start + lengthA + takenB];
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::mergeRuns(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+	size_t start, size_t lengthA, size_t lengthB, size_t position)
+{
+	return pick(hashes, order, start, lengthA, lengthB,
+		coRank(hashes, order, start, lengthA, lengthB, position, position > lengthB ? position - lengthB : 0, position < lengthA ? position : lengthA),
+		position - coRank(hashes, order, start, lengthA, lengthB, position, position > lengthB ? position - lengthB : 0, position < lengthA ? position : lengthA));
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::mergeAt(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+	size_t width, size_t start, size_t position)
+{
+	return mergeRuns(hashes, order, start, COUNT - start < width ? COUNT - start : width,
+		COUNT - start <= width ? 0 : (COUNT - start - width < width ? COUNT - start - width : width), position - start);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT> FixedStringTable<TChar, COUNT, CHARACTERS>::mergeLevel(const Array<uint64_t, COUNT>& hashes,
+	const Array<size_t, COUNT>& order, size_t width, FixedIndices<K...>)
+{
+	return Array<size_t, COUNT>{ { mergeAt(hashes, order, width, K / (2 * width) * (2 * width), K)... } };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT> FixedStringTable<TChar, COUNT, CHARACTERS>::sortKeys(const Array<uint64_t, COUNT>& hashes,
+	const Array<size_t, COUNT>& order, size_t width)
+{
+	return width >= COUNT ? order : sortKeys(hashes, mergeLevel(hashes, order, width, typename MakeFixedIndices<COUNT>::Type()), 2 * width);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::lowerBound(const Array<uint64_t, COUNT>& hashes, const Array<size_t, COUNT>& order,
+	size_t index, size_t begin, size_t end)
+{
+	return begin == end ? begin :
+		bucket(hashes[order[begin + (end - begin) / 2]]) >= index ? lowerBound(hashes, order, index, begin, begin + (end - begin) / 2) :
+		lowerBound(hashes, order, index, begin + (end - begin) / 2 + 1, end);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... B>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::template Array<size_t, COUNT + 1> FixedStringTable<TChar, COUNT, CHARACTERS>::makeStarts(const Array<uint64_t, COUNT>& hashes,
+	const Array<size_t, COUNT>& order, FixedIndices<B...>)
+{
+	return Array<size_t, COUNT + 1>{ { lowerBound(hashes, order, B, 0, COUNT)... } };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Buckets FixedStringTable<TChar, COUNT, CHARACTERS>::makeBuckets(uint64_t seed, const Array<uint64_t, COUNT>& hashes,
+	const Array<size_t, COUNT>& order, const Array<size_t, COUNT + 1>& starts, FixedIndices<K...>)
+{
+	return makeBuckets(seed, hashes, order, starts,
+		Array<size_t, COUNT>{ { ((starts[K + 1] - starts[K]) * (starts[K + 1] - starts[K]))... } }, FixedIndices<K...>());
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Buckets FixedStringTable<TChar, COUNT, CHARACTERS>::makeBuckets(uint64_t seed, const Array<uint64_t, COUNT>& hashes,
+	const Array<size_t, COUNT>& order, const Array<size_t, COUNT + 1>& starts, const Array<size_t, COUNT>& squares, FixedIndices<K...>)
+{
+	return Buckets{ seed, hashes, order, starts, { { (starts[K + 1] - starts[K])... } },
+		makeOffsets(squares, scan(squares, 1), FixedIndices<K...>()) };
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Buckets FixedStringTable<TChar, COUNT, CHARACTERS>::distribute(uint64_t seed, const Array<uint64_t, COUNT>& hashes,
+	FixedIndices<K...>)
+{
+	return makeBuckets(seed, hashes, sortKeys(hashes, Array<size_t, COUNT>{ { K... } }, 1),
+		makeStarts(hashes, sortKeys(hashes, Array<size_t, COUNT>{ { K... } }, 1), typename MakeFixedIndices<COUNT + 1>::Type()),
+		FixedIndices<K...>());
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Buckets FixedStringTable<TChar, COUNT, CHARACTERS>::distribute(const Keys& keys, uint64_t seed)
+{
+	return distribute(seed, makeHashes(keys, seed, typename MakeFixedIndices<COUNT>::Type()), typename MakeFixedIndices<COUNT>::Type());
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr typename FixedStringTable<TChar, COUNT, CHARACTERS>::Buckets FixedStringTable<TChar, COUNT, CHARACTERS>::searchBuckets(const Keys& keys, const Buckets& buckets)
+{
+	return buckets.offsets[COUNT] <= SLOTS || buckets.seed + 1 >= SEED_TRIES ? buckets :
+		searchBuckets(keys, distribute(keys, buckets.seed + 1));
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr bool FixedStringTable<TChar, COUNT, CHARACTERS>::distinct(const Buckets& buckets, size_t bucket, uint64_t seed)
+{
+	return 0 == sum(Collisions{ buckets, bucket, seed, buckets.starts[bucket] + buckets.counts[bucket] }, buckets.starts[bucket],
+		buckets.starts[bucket] + buckets.counts[bucket]);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr uint64_t FixedStringTable<TChar, COUNT, CHARACTERS>::searchBucketSeed(const Buckets& buckets, size_t bucket, uint64_t seed)
+{
+	return seed + 1 >= SEED_TRIES || distinct(buckets, bucket, seed) ? seed : searchBucketSeed(buckets, bucket, seed + 1);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::lastBucket(const Array<size_t, COUNT + 1>& offsets, size_t index, size_t begin, size_t end)
+{
+	return end - begin == 1 ? begin :
+		offsets[begin + (end - begin) / 2] <= index ? lastBucket(offsets, index, begin + (end - begin) / 2, end) :
+		lastBucket(offsets, index, begin, begin + (end - begin) / 2);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::keyInBucket(const Buckets& buckets, const Array<uint64_t, COUNT>& seeds,
+	size_t bucket, size_t index, size_t position)
+{
+	return position == buckets.starts[bucket + 1] ? COUNT :
+		slot(buckets.hashes[buckets.order[position]], seeds[bucket], buckets.counts[bucket] * buckets.counts[bucket]) == index ?
+		buckets.order[position] : keyInBucket(buckets, seeds, bucket, index, position + 1);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::keyInSlot(const Buckets& buckets, const Array<uint64_t, COUNT>& seeds,
+	size_t bucket, size_t index)
+{
+	return index < buckets.offsets[bucket + 1] ?
+		keyInBucket(buckets, seeds, bucket, index - buckets.offsets[bucket], buckets.starts[bucket]) : COUNT;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr FixedStringTable<TChar, COUNT, CHARACTERS>::FixedStringTable(const Keys& keys)
+	: FixedStringTable(keys, searchBuckets(keys, distribute(keys, 0)), typename MakeFixedIndices<COUNT>::Type())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K>
+constexpr FixedStringTable<TChar, COUNT, CHARACTERS>::FixedStringTable(const Keys& keys, const Buckets& buckets, FixedIndices<K...>)
+	: FixedStringTable(keys, buckets, Array<uint64_t, COUNT>{ { searchBucketSeed(buckets, K, 0)... } }, FixedIndices<K...>(),
+		typename MakeFixedIndices<SLOTS>::Type())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... K, size_t... S>
+constexpr FixedStringTable<TChar, COUNT, CHARACTERS>::FixedStringTable(const Keys& keys, const Buckets& buckets,
+	const Array<uint64_t, COUNT>& seeds, FixedIndices<K...>, FixedIndices<S...>)
+	: m_characters(keys.characters), m_offsets(keys.offsets), m_seed(buckets.seed), m_bucketSeeds(seeds),
+	m_bucketOffsets(buckets.offsets), m_bucketSizes{ { (buckets.counts[K] * buckets.counts[K])... } },
+	m_slots{ { keyInSlot(buckets, seeds, lastBucket(buckets.offsets, S, 0, COUNT), S)... } },
+	m_valid(buckets.offsets[COUNT] <= SLOTS && 0 == sum(Unresolved{ buckets, seeds }, 0, COUNT))
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::candidate(uint64_t hash) const
+{
+	return m_bucketSizes[bucket(hash)] ?
+		m_slots[m_bucketOffsets[bucket(hash)] + slot(hash, m_bucketSeeds[bucket(hash)], m_bucketSizes[bucket(hash)])] : COUNT;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t N>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::match(size_t index, const FixedString<TChar, N>& str) const
+{
+	return index < COUNT && m_offsets[index + 1] - m_offsets[index] == N &&
+		equal(m_characters.values + m_offsets[index], str.data(), 0, N) ? index : NOT_FOUND;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t... N>
+constexpr FixedStringTable<TChar, COUNT, CHARACTERS>::FixedStringTable(const FixedString<TChar, N>&... keys)
+	: FixedStringTable(makeKeys(Array<const TChar*, COUNT>{ { keys.data()... } },
+		makeOffsets(Array<size_t, COUNT>{ { N... } }, scan(Array<size_t, COUNT>{ { N... } }, 1), typename MakeFixedIndices<COUNT>::Type()),
+		typename MakeFixedIndices<CHARACTERS>::Type()))
+{
+	// Nothing to do yet
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::size() const
+{
+	return COUNT;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+constexpr bool FixedStringTable<TChar, COUNT, CHARACTERS>::valid() const
+{
+	return m_valid;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+StringView<TChar> FixedStringTable<TChar, COUNT, CHARACTERS>::key(size_t index) const
+{
+	return StringView<TChar>(m_characters.values + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+size_t FixedStringTable<TChar, COUNT, CHARACTERS>::find(const StringView<TChar>& str) const
+{
+	if (!m_valid)
+	{
+		return NOT_FOUND;
+	}
+
+	// Only the key stored in the slot of the hash can be equal
+	size_t index = candidate(StringHash::hash(str.data(), str.length() * sizeof(TChar), m_seed));
+	return index < COUNT && key(index) == str ? index : NOT_FOUND;
+}
+
+template<class TChar, size_t COUNT, size_t CHARACTERS>
+template<size_t N>
+constexpr size_t FixedStringTable<TChar, COUNT, CHARACTERS>::find(const FixedString<TChar, N>& str) const
+{
+	return m_valid ? match(candidate(StringHash::hashConstant(str.data(), N, m_seed)), str) : NOT_FOUND;
+}
+
+template<class TChar, size_t... N>
+constexpr FixedStringTable<TChar, sizeof...(N), FixedLength<N...>::value> makeFixedStringTable(const FixedString<TChar, N>&... keys)
+{
+	return FixedStringTable<TChar, sizeof...(N), FixedLength<N...>::value>(keys...);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file HashedString.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef HASHEDSTRING_HPP
+#define HASHEDSTRING_HPP
+
+
+// For std::hash
+#include <functional>
+#include "String.hpp"
+
+
+/**
+ * @class HashedString
+ * Immutable string caching its hash, which is calculated once on construction. Used as key of hash tables, lookups
+ * and rehashes never scan the characters again and unequal keys are mostly rejected by comparing the hashes.
+ */
+template<class TChar, class TAllocator = StringAllocator<TChar> >
+class HashedString
+{
+private:
+	// Stored string
+	String<TChar, TAllocator> m_string;
+	// Hash of the stored string
+	size_t m_hash;
+
+public:
+	/**
+	 * Default constructor for instances of the class HashedString. Constructs the empty string.
+	 */
+	HashedString();
+
+	/**
+	 * Constructor which copies a string.
+	 * @param	str	String to copy
+	 */
+	explicit HashedString(const StringView<TChar>& str);
+
+	/**
+	 * Constructor which takes over a string without copying it.
+	 * @param	str	String to take over
+	 */
+	explicit HashedString(String<TChar, TAllocator>&& str);
+
+	/**
+	 * Returns the stored string.
+	 * @return	Reference to the stored string
+	 */
+	const String<TChar, TAllocator>& str() const;
+
+	/**
+	 * Returns a pointer to the zero-terminated characters of the stored string.
+	 * @return	Pointer to the characters
+	 */
+	const TChar* c_str() const;
+
+	/**
+	 * Returns the length of the stored string.
+	 * @return	Length of the string in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Returns the cached hash of the stored string, which equals String::hash.
+	 * @return	Hash of the stored string
+	 */
+	size_t hash() const;
+
+	/**
+	 * Returns a view of the stored string.
+	 * @return	View of the characters
+	 */
+	operator StringView<TChar>() const;
+
+	/**
+	 * Equal operator. Compares the hashes before comparing the characters.
+	 * @param	other	String to compare to
+	 * @return		true if both strings are equal, otherwise false
+	 */
+	bool operator==(const HashedString<TChar, TAllocator>& other) const;
+
+	/**
+	 * Unequal operator. Compares the hashes before comparing the characters.
+	 * @param	other	String to compare to
+	 * @return		true if both strings are unequal, otherwise false
+	 */
+	bool operator!=(const HashedString<TChar, TAllocator>& other) const;
+
+	/**
+	 * Less operator. Checks if the stored string is ordered lexicographically before the one of another instance.
+	 * @param	other	String to compare to
+	 * @return		true if the string is ordered before other, otherwise false
+	 */
+	bool operator<(const HashedString<TChar, TAllocator>& other) const;
+};
+
+
+// Include HashedString class implementation
+#include "HashedString.tpp"
+
+
+/**
+ * Specialization of std::hash for HashedString, returning the cached hash.
+ */
+namespace std
+{
+	template<class TChar, class TAllocator>
+	struct hash<HashedString<TChar, TAllocator> >
+	{
+		size_t operator()(const HashedString<TChar, TAllocator>& str) const
+		{
+			return str.hash();
+		}
+	};
+}
+
+
+// Typedef of the frequently used HashedString classes
+typedef HashedString<char> AHashedString;
+typedef HashedString<wchar_t> WHashedString;
+
+
+#endif // #ifndef HASHEDSTRING_HPP
@@ -0,0 +1,78 @@
+/**
+ * @file HashedString.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef HASHEDSTRING_HPP
+#error HASHEDSTRING_HPP undefined
+#endif
+
+template<class TChar, class TAllocator>
+HashedString<TChar, TAllocator>::HashedString()
+	: m_string(), m_hash(m_string.hash())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TAllocator>
+HashedString<TChar, TAllocator>::HashedString(const StringView<TChar>& str)
+	: m_string(str), m_hash(str.hash())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TAllocator>
+HashedString<TChar, TAllocator>::HashedString(String<TChar, TAllocator>&& str)
+	: m_string(std::move(str)), m_hash(m_string.hash())
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TAllocator>
+const String<TChar, TAllocator>& HashedString<TChar, TAllocator>::str() const
+{
+	return m_string;
+}
+
+template<class TChar, class TAllocator>
+const TChar* HashedString<TChar, TAllocator>::c_str() const
+{
+	return m_string.c_str();
+}
+
+template<class TChar, class TAllocator>
+size_t HashedString<TChar, TAllocator>::length() const
+{
+	return m_string.length();
+}
+
+template<class TChar, class TAllocator>
+size_t HashedString<TChar, TAllocator>::hash() const
+{
+	return m_hash;
+}
+
+template<class TChar, class TAllocator>
+HashedString<TChar, TAllocator>::operator StringView<TChar>() const
+{
+	return StringView<TChar>(m_string);
+}
+
+template<class TChar, class TAllocator>
+bool HashedString<TChar, TAllocator>::operator==(const HashedString<TChar, TAllocator>& other) const
+{
+	return m_hash == other.m_hash && m_string == other.m_string;
+}
+
+template<class TChar, class TAllocator>
+bool HashedString<TChar, TAllocator>::operator!=(const HashedString<TChar, TAllocator>& other) const
+{
+	return !(*this == other);
+}
+
+template<class TChar, class TAllocator>
+bool HashedString<TChar, TAllocator>::operator<(const HashedString<TChar, TAllocator>& other) const
+{
+	return m_string < other.m_string;
+}
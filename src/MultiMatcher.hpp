@@ -0,0 +1,159 @@
+/**
+ * @file MultiMatcher.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef MULTIMATCHER_HPP
+#define MULTIMATCHER_HPP
+
+
+// For uint32_t
+#include <cstdint>
+// For std::length_error
+#include <stdexcept>
+// For std::vector
+#include <vector>
+#include "String.hpp"
+
+
+/**
+ * @class MultiMatcher
+ * Aho-Corasick automaton matching a set of patterns in a single pass over a string. The automaton is compiled into a
+ * flat DFA table over the bytes of the characters: every byte is mapped to one of few classes of bytes occurring in
+ * the patterns and each state is a row of one transition per class, so matching takes one table lookup per byte
+ * without following failure links. Transitions into states completing patterns are flagged, the matched patterns are
+ * only looked up for them. Stream continues matching across the chunks of a string. Empty patterns never match.
+ */
+template<class TChar>
+class MultiMatcher
+{
+private:
+	// Flag of transitions into states completing at least one pattern
+	static const uint32_t OUTPUT_FLAG = 0x80000000u;
+
+	// Class of each byte, 0 for bytes not occurring in any pattern
+	uint32_t m_byteClass[256];
+	// Count of byte classes, which is the length of a row of the table
+	uint32_t m_classCount;
+	// Transitions of all states, each one the offset of the row of the target state, possibly flagged by OUTPUT_FLAG
+	std::vector<uint32_t> m_table;
+	// Position of the first pattern completed by each state in m_outputs, followed by the end of the last state
+	std::vector<uint32_t> m_outputStart;
+	// Indices of the patterns completed by the states
+	std::vector<uint32_t> m_outputs;
+	// Length of each pattern in characters
+	std::vector<size_t> m_patternLengths;
+
+	/**
+	 * Builds the automaton from the patterns.
+	 * @param	patterns	Patterns to match
+	 */
+	void build(const std::vector<StringView<TChar> >& patterns);
+
+	/**
+	 * Runs the automaton over a buffer and reports all matches.
+	 * @param	row		Offset of the row of the current state, updated by the call
+	 * @param	offset		Position of the first character of the buffer in the matched string
+	 * @param	text		Buffer to match
+	 * @param	function	Function called for every match
+	 * @return			Count of matches
+	 */
+	template<class TFunction>
+	size_t run(uint32_t& row, size_t offset, const StringView<TChar>& text, TFunction& function) const;
+
+public:
+	/**
+	 * @class Stream
+	 * Matches the patterns of a MultiMatcher in a string passed as a sequence of chunks. Matches spanning the
+	 * borders of chunks are found and all positions are relative to the beginning of the first chunk.
+	 */
+	class Stream
+	{
+	private:
+		// Matcher to use
+		const MultiMatcher<TChar>& m_matcher;
+		// Offset of the row of the current state
+		uint32_t m_row;
+		// Count of characters passed so far
+		size_t m_offset;
+
+	public:
+		/**
+		 * Constructor for instances of the class Stream. The matcher must outlive the stream.
+		 * @param	matcher	Matcher to use
+		 */
+		explicit Stream(const MultiMatcher<TChar>& matcher);
+
+		/**
+		 * Passes the next chunk of the string and reports the matches ending in it.
+		 * @param	chunk		Next chunk
+		 * @param	function	Function called for every match with the index of the pattern and its position
+		 * @return			Count of matches
+		 */
+		template<class TFunction>
+		size_t feed(const StringView<TChar>& chunk, TFunction function);
+
+		/**
+		 * Restarts matching at the beginning of a new string.
+		 */
+		void reset();
+	};
+
+	/**
+	 * Constructor which compiles the automaton for a range of patterns, for example Strings or c-strings. The index
+	 * of a pattern is its position in the range.
+	 * @param	first	Iterator to the first pattern
+	 * @param	last	Iterator behind the last pattern
+	 */
+	template<class TIterator>
+	MultiMatcher(TIterator first, TIterator last);
+
+	/**
+	 * Returns the count of patterns.
+	 * @return	Count of patterns
+	 */
+	size_t patternCount() const;
+
+	/**
+	 * Returns the length of a pattern.
+	 * @param	pattern	Index of the pattern
+	 * @return		Length of the pattern in characters
+	 */
+	size_t patternLength(size_t pattern) const;
+
+	/**
+	 * Returns the count of states of the automaton.
+	 * @return	Count of states
+	 */
+	size_t stateCount() const;
+
+	/**
+	 * Reports all matches of all patterns in a string in a single pass, including overlapping ones. Matches are
+	 * reported in the order of their ends.
+	 * @param	text		String to match
+	 * @param	function	Function called for every match with the index of the pattern and its position
+	 * @return			Count of matches
+	 */
+	template<class TFunction>
+	size_t findAll(const StringView<TChar>& text, TFunction function) const;
+
+	/**
+	 * Counts the matches of all patterns in a string.
+	 * @param	text	String to match
+	 * @return		Count of matches
+	 */
+	size_t count(const StringView<TChar>& text) const;
+};
+
+
+// Include MultiMatcher class implementation
+#include "MultiMatcher.tpp"
+
+
+// Typedef of the frequently used MultiMatcher classes
+typedef MultiMatcher<char> AMultiMatcher;
+typedef MultiMatcher<wchar_t> WMultiMatcher;
+
+
+#endif // #ifndef MULTIMATCHER_HPP
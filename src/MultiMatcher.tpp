@@ -0,0 +1,224 @@
+/**
+ * @file MultiMatcher.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef MULTIMATCHER_HPP
+#error MULTIMATCHER_HPP undefined
+#endif
+
+template<class TChar>
+const uint32_t MultiMatcher<TChar>::OUTPUT_FLAG;
+
+template<class TChar>
+void MultiMatcher<TChar>::build(const std::vector<StringView<TChar> >& patterns)
+{
+	// Map the bytes occurring in the patterns to classes, all other bytes share class 0
+	for (size_t i = 0; i < 256; i++)
+	{
+		m_byteClass[i] = 0;
+	}
+	m_classCount = 1;
+	for (size_t k = 0; k < patterns.size(); k++)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(patterns[k].data());
+		for (size_t i = 0, size = patterns[k].length() * sizeof(TChar); i < size; i++)
+		{
+			if (!m_byteClass[bytes[i]])
+			{
+				m_byteClass[bytes[i]] = m_classCount++;
+			}
+		}
+		m_patternLengths.push_back(patterns[k].length());
+	}
+
+	// Build the trie, states are identified by the offsets of their rows and 0 is the root marking missing children
+	const uint32_t classCount = m_classCount;
+	m_table.assign(classCount, 0);
+	std::vector<std::vector<uint32_t> > outputs(1);
+	for (size_t k = 0; k < patterns.size(); k++)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(patterns[k].data());
+		size_t size = patterns[k].length() * sizeof(TChar);
+		if (!size)
+		{
+			continue;
+		}
+
+		uint32_t row = 0;
+		for (size_t i = 0; i < size; i++)
+		{
+			uint32_t& transition = m_table[row + m_byteClass[bytes[i]]];
+			if (!transition)
+			{
+				if (m_table.size() + classCount >= OUTPUT_FLAG)
+				{
+					throw std::length_error("MultiMatcher: too many states");
+				}
+				transition = static_cast<uint32_t>(m_table.size());
+				m_table.resize(m_table.size() + classCount, 0);
+				outputs.push_back(std::vector<uint32_t>());
+			}
+			row = m_table[row + m_byteClass[bytes[i]]];
+		}
+		outputs[row / classCount].push_back(static_cast<uint32_t>(k));
+	}
+
+	// Visit the states in breadth-first order, so the failure state of a state is complete before the state itself
+	size_t stateCount = outputs.size();
+	std::vector<uint32_t> failure(stateCount, 0);
+	std::vector<uint32_t> queue;
+	queue.reserve(stateCount);
+	for (uint32_t c = 0; c < classCount; c++)
+	{
+		if (m_table[c])
+		{
+			queue.push_back(m_table[c]);
+		}
+	}
+	for (size_t head = 0; head < queue.size(); head++)
+	{
+		uint32_t row = queue[head];
+		uint32_t fail = failure[row / classCount];
+
+		// Patterns completed by the failure state end at the same position
+		const std::vector<uint32_t>& inherited = outputs[fail / classCount];
+		outputs[row / classCount].insert(outputs[row / classCount].end(), inherited.begin(), inherited.end());
+
+		// Replace missing children by the transitions of the failure state, which turns the trie into a DFA
+		for (uint32_t c = 0; c < classCount; c++)
+		{
+			uint32_t child = m_table[row + c];
+			if (child)
+			{
+				failure[child / classCount] = m_table[fail + c];
+				queue.push_back(child);
+			}
+			else
+			{
+				m_table[row + c] = m_table[fail + c];
+			}
+		}
+	}
+
+	// Flatten the outputs and flag the transitions into states completing patterns
+	m_outputStart.resize(stateCount + 1);
+	for (size_t state = 0; state < stateCount; state++)
+	{
+		m_outputStart[state] = static_cast<uint32_t>(m_outputs.size());
+		m_outputs.insert(m_outputs.end(), outputs[state].begin(), outputs[state].end());
+	}
+	m_outputStart[stateCount] = static_cast<uint32_t>(m_outputs.size());
+	for (size_t i = 0; i < m_table.size(); i++)
+	{
+		if (!outputs[m_table[i] / classCount].empty())
+		{
+			m_table[i] |= OUTPUT_FLAG;
+		}
+	}
+}
+
+template<class TChar>
+template<class TFunction>
+size_t MultiMatcher<TChar>::run(uint32_t& row, size_t offset, const StringView<TChar>& text, TFunction& function) const
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+	const uint32_t* table = m_table.data();
+	const uint32_t* byteClass = m_byteClass;
+	uint32_t current = row;
+	size_t matches = 0;
+	for (size_t i = 0, size = text.length() * sizeof(TChar); i < size; i++)
+	{
+		current = table[current + byteClass[bytes[i]]];
+
+		// Clearing the flag only after testing it keeps it off the dependency chain of the lookups
+		if (current & OUTPUT_FLAG)
+		{
+			current &= ~OUTPUT_FLAG;
+
+			// Matches of wide characters are only valid if they end at the end of a character
+			if (0 == (i + 1) % sizeof(TChar))
+			{
+				size_t end = offset + (i + 1) / sizeof(TChar);
+				size_t state = current / m_classCount;
+				for (uint32_t k = m_outputStart[state]; k < m_outputStart[state + 1]; k++)
+				{
+					uint32_t pattern = m_outputs[k];
+					function(static_cast<size_t>(pattern), end - m_patternLengths[pattern]);
+					matches++;
+				}
+			}
+		}
+	}
+	row = current;
+	return matches;
+}
+
+template<class TChar>
+MultiMatcher<TChar>::Stream::Stream(const MultiMatcher<TChar>& matcher)
+	: m_matcher(matcher), m_row(0), m_offset(0)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+template<class TFunction>
+size_t MultiMatcher<TChar>::Stream::feed(const StringView<TChar>& chunk, TFunction function)
+{
+	size_t matches = m_matcher.run(m_row, m_offset, chunk, function);
+	m_offset += chunk.length();
+	return matches;
+}
+
+template<class TChar>
+void MultiMatcher<TChar>::Stream::reset()
+{
+	m_row = 0;
+	m_offset = 0;
+}
+
+template<class TChar>
+template<class TIterator>
+MultiMatcher<TChar>::MultiMatcher(TIterator first, TIterator last)
+	: m_classCount(1)
+{
+	std::vector<StringView<TChar> > patterns;
+	for (; first != last; ++first)
+	{
+		patterns.push_back(StringView<TChar>(*first));
+	}
+	build(patterns);
+}
+
+template<class TChar>
+size_t MultiMatcher<TChar>::patternCount() const
+{
+	return m_patternLengths.size();
+}
+
+template<class TChar>
+size_t MultiMatcher<TChar>::patternLength(size_t pattern) const
+{
+	return m_patternLengths[pattern];
+}
+
+template<class TChar>
+size_t MultiMatcher<TChar>::stateCount() const
+{
+	return m_table.size() / m_classCount;
+}
+
+template<class TChar>
+template<class TFunction>
+size_t MultiMatcher<TChar>::findAll(const StringView<TChar>& text, TFunction function) const
+{
+	uint32_t row = 0;
+	return run(row, 0, text, function);
+}
+
+template<class TChar>
+size_t MultiMatcher<TChar>::count(const StringView<TChar>& text) const
+{
+	return findAll(text, [](size_t, size_t) {});
+}
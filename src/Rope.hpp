@@ -0,0 +1,316 @@
+/**
+ * @file Rope.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef ROPE_HPP
+#define ROPE_HPP
+
+
+// For std::shared_ptr
+#include <memory>
+// For std::vector
+#include <vector>
+#include "String.hpp"
+
+
+// Appended strings are merged into the last chunk of a rope as long as the merged chunk does not exceed this length
+#define STRING_ROPE_MERGE_LENGTH 256
+
+
+/**
+ * @class Rope
+ * Rope storing a long string as a balanced tree of immutable chunks, each one a String. Concatenation, split and
+ * substring take O(log n) and never copy chunks, copies of a rope share all of its chunks. The string is only
+ * flattened into a contiguous buffer if c_str() is called, ChunkIterator gives access to the chunks without
+ * flattening. All const functions only read the rope, so a rope may be read by multiple threads at once. c_str() is not
+ * const, as it replaces the tree by the flattened chunk.
+ */
+template<class TChar, class TAllocator = StringAllocator<TChar> >
+class Rope
+{
+public:
+	// Type of the chunks
+	typedef String<TChar, TAllocator> StringType;
+
+private:
+	// Node of the tree
+	struct Node;
+	// Shared pointer to an immutable node
+	typedef std::shared_ptr<const Node> NodePtr;
+
+	struct Node
+	{
+		// Left subtree of an inner node
+		NodePtr left;
+		// Right subtree of an inner node
+		NodePtr right;
+		// Chunk of a leaf
+		std::shared_ptr<const StringType> chunk;
+		// Position of the part of the chunk referenced by a leaf
+		size_t offset;
+		// Length of the string stored in the subtree in characters
+		size_t length;
+		// Height of the subtree, 1 for leaves
+		size_t height;
+	};
+
+	// Root of the tree, 0 for an empty rope
+	NodePtr m_root;
+
+	/**
+	 * Returns the height of a subtree.
+	 * @param	node	Subtree, may be 0
+	 * @return		Height of the subtree, 0 for an empty one
+	 */
+	static size_t height(const NodePtr& node);
+
+	/**
+	 * Creates a leaf referencing a part of a chunk.
+	 * @param	chunk	Chunk to reference
+	 * @param	offset	Position of the part in the chunk
+	 * @param	length	Length of the part in characters
+	 * @return		New leaf
+	 */
+	static NodePtr makeLeaf(const std::shared_ptr<const StringType>& chunk, size_t offset, size_t length);
+
+	/**
+	 * Creates an inner node from two subtrees without balancing.
+	 * @param	left	Left subtree
+	 * @param	right	Right subtree
+	 * @return		New inner node
+	 */
+	static NodePtr makeNode(const NodePtr& left, const NodePtr& right);
+
+	/**
+	 * Creates an inner node from two subtrees differing in height by at most two, rotating if required.
+	 * @param	left	Left subtree
+	 * @param	right	Right subtree
+	 * @return		Balanced subtree
+	 */
+	static NodePtr balance(const NodePtr& left, const NodePtr& right);
+
+	/**
+	 * Concatenates two balanced subtrees in O(log n).
+	 * @param	left	Left subtree, may be 0
+	 * @param	right	Right subtree, may be 0
+	 * @return		Balanced subtree storing the concatenation
+	 */
+	static NodePtr join(const NodePtr& left, const NodePtr& right);
+
+	/**
+	 * Splits a subtree at a position in O(log n).
+	 * @param	node	Subtree to split, may be 0
+	 * @param	pos	Position to split at
+	 * @param	left	Receives the subtree storing the characters in front of pos
+	 * @param	right	Receives the subtree storing the characters from pos on
+	 */
+	static void split(const NodePtr& node, size_t pos, NodePtr& left, NodePtr& right);
+
+	/**
+	 * Replaces the last leaf of a subtree, keeping all other nodes shared.
+	 * @param	node	Subtree
+	 * @param	leaf	New last leaf
+	 * @return		Subtree with the replaced leaf
+	 */
+	static NodePtr replaceLast(const NodePtr& node, const NodePtr& leaf);
+
+	/**
+	 * Creates a rope from a subtree.
+	 * @param	root	Root of the rope
+	 */
+	explicit Rope(const NodePtr& root);
+
+public:
+	/**
+	 * @class ChunkIterator
+	 * Iterates over the chunks of a rope from left to right without flattening it. The rope must not be modified
+	 * while iterating.
+	 */
+	class ChunkIterator
+	{
+	private:
+		// Inner nodes whose right subtree has not been visited yet
+		std::vector<const Node*> m_stack;
+		// Next leaf to return
+		const Node* m_next;
+
+		/**
+		 * Descends to the leftmost leaf of a subtree, remembering the inner nodes on the way.
+		 * @param	node	Subtree, may be 0
+		 */
+		void descend(const Node* node);
+
+	public:
+		/**
+		 * Constructor for instances of the class ChunkIterator.
+		 * @param	rope	Rope to iterate over
+		 */
+		explicit ChunkIterator(const Rope<TChar, TAllocator>& rope);
+
+		/**
+		 * Returns the next chunk.
+		 * @param	data	Receives the pointer to the characters of the chunk, not zero-terminated
+		 * @param	length	Receives the length of the chunk in characters
+		 * @return		true if a chunk was returned, false if all chunks were visited
+		 */
+		bool next(const TChar*& data, size_t& length);
+	};
+
+	/**
+	 * Default constructor for instances of the class Rope. Constructs an empty rope.
+	 */
+	Rope();
+
+	/**
+	 * Constructor which creates a rope from a c-string.
+	 * @param	str	C-string to copy
+	 */
+	Rope(const TChar* str);
+
+	/**
+	 * Constructor which creates a rope from a String. The String is copied once into the chunk.
+	 * @param	str	String to copy
+	 */
+	Rope(const StringType& str);
+
+	/**
+	 * Constructor which creates a rope taking over a String as its chunk without copying it.
+	 * @param	str	String to take over
+	 */
+	Rope(StringType&& str);
+
+	/**
+	 * Returns the length of the string stored in the rope.
+	 * @return	Length of the string in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Returns the height of the tree, which is O(log n) in the count of chunks.
+	 * @return	Height of the tree, 0 for an empty rope
+	 */
+	size_t height() const;
+
+	/**
+	 * Returns the character at a position in O(log n).
+	 * @param	pos	Position of the character
+	 * @return		Character at pos, 0 if pos is not less than length()
+	 */
+	TChar at(size_t pos) const;
+
+	/**
+	 * Appends another rope in O(log n), sharing its chunks.
+	 * @param	other	Rope to append
+	 */
+	void append(const Rope<TChar, TAllocator>& other);
+
+	/**
+	 * Appends a c-string. Short strings are merged into the last chunk, longer ones become a chunk of their own.
+	 * @param	other	C-string to append
+	 * @param	len	Count of characters to append, 0 to append the whole c-string
+	 */
+	void append(const TChar* other, size_t len = 0);
+
+	/**
+	 * Appends a String. Short strings are merged into the last chunk, longer ones are copied into a chunk of their own.
+	 * @param	other	String to append
+	 */
+	void append(const StringType& other);
+
+	/**
+	 * Appends a String. Short strings are merged into the last chunk, longer ones are taken over as a chunk without
+	 * copying.
+	 * @param	other	String to append
+	 */
+	void append(StringType&& other);
+
+	/**
+	 * Splits the rope at a position in O(log n). Both parts share the chunks of the rope.
+	 * @param	pos	Position to split at
+	 * @param	left	Receives the characters in front of pos
+	 * @param	right	Receives the characters from pos on
+	 */
+	void split(size_t pos, Rope<TChar, TAllocator>& left, Rope<TChar, TAllocator>& right) const;
+
+	/**
+	 * Returns a part of the rope in O(log n), sharing its chunks.
+	 * @param	pos	Position of the first character
+	 * @param	len	Count of characters, clamped to the end of the rope
+	 * @return		Rope storing the part
+	 */
+	Rope<TChar, TAllocator> substr(size_t pos, size_t len) const;
+
+	/**
+	 * Copies the string stored in the rope into a String using a single allocation.
+	 * @return	Flattened string
+	 */
+	StringType flatten() const;
+
+	/**
+	 * Returns a pointer to the zero-terminated string stored in the rope. If the rope consists of more than one chunk,
+	 * it is flattened into a single chunk first, which modifies the rope. Copies of the rope sharing its chunks are not
+	 * affected. The pointer stays valid until the rope is modified or destroyed.
+	 * @return	Pointer to the string
+	 */
+	const TChar* c_str();
+
+	/**
+	 * Calls a function for every chunk of the rope from left to right.
+	 * @param	function	Function called with a pointer to the characters of a chunk, which is not
+	 *				zero-terminated, and the length of the chunk in characters
+	 */
+	template<class TFunction>
+	void forEachChunk(TFunction function) const;
+
+	/**
+	 * Add-to operator. Appends another rope.
+	 * @param	other	Rope to append
+	 * @return		Reference to the instance
+	 */
+	Rope<TChar, TAllocator>& operator+=(const Rope<TChar, TAllocator>& other);
+
+	/**
+	 * Add-to operator. Appends a c-string.
+	 * @param	other	C-string to append
+	 * @return		Reference to the instance
+	 */
+	Rope<TChar, TAllocator>& operator+=(const TChar* other);
+
+	/**
+	 * Add-to operator. Appends a String.
+	 * @param	other	String to append
+	 * @return		Reference to the instance
+	 */
+	Rope<TChar, TAllocator>& operator+=(const StringType& other);
+
+	/**
+	 * Add-to operator. Appends a String, taking it over if it becomes a chunk of its own.
+	 * @param	other	String to append
+	 * @return		Reference to the instance
+	 */
+	Rope<TChar, TAllocator>& operator+=(StringType&& other);
+};
+
+
+/**
+ * Concatenates two ropes in O(log n).
+ * @param	lhs	Left-hand rope
+ * @param	rhs	Right-hand rope
+ * @return		Concatenation of lhs and rhs
+ */
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator> operator+(const Rope<TChar, TAllocator>& lhs, const Rope<TChar, TAllocator>& rhs);
+
+
+// Include Rope class implementation
+#include "Rope.tpp"
+
+
+// Typedef of the frequently used Rope classes
+typedef Rope<char> ARope;
+typedef Rope<wchar_t> WRope;
+
+
+#endif // #ifndef ROPE_HPP
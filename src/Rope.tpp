@@ -0,0 +1,407 @@
+/**
+ * @file Rope.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef ROPE_HPP
+#error ROPE_HPP undefined
+#endif
+
+template<class TChar, class TAllocator>
+size_t Rope<TChar, TAllocator>::height(const NodePtr& node)
+{
+	return node ? node->height : 0;
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::NodePtr Rope<TChar, TAllocator>::makeLeaf(const std::shared_ptr<const StringType>& chunk, size_t offset, size_t length)
+{
+	std::shared_ptr<Node> leaf = std::make_shared<Node>();
+	leaf->chunk = chunk;
+	leaf->offset = offset;
+	leaf->length = length;
+	leaf->height = 1;
+	return leaf;
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::NodePtr Rope<TChar, TAllocator>::makeNode(const NodePtr& left, const NodePtr& right)
+{
+	std::shared_ptr<Node> node = std::make_shared<Node>();
+	node->left = left;
+	node->right = right;
+	node->offset = 0;
+	node->length = left->length + right->length;
+	node->height = 1 + (left->height > right->height ? left->height : right->height);
+	return node;
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::NodePtr Rope<TChar, TAllocator>::balance(const NodePtr& left, const NodePtr& right)
+{
+	if (left->height > right->height + 1)
+	{
+		if (height(left->left) >= height(left->right))
+		{
+			// Single rotation to the right
+			return makeNode(left->left, makeNode(left->right, right));
+		}
+		// Double rotation to the right
+		return makeNode(makeNode(left->left, left->right->left), makeNode(left->right->right, right));
+	}
+	if (right->height > left->height + 1)
+	{
+		if (height(right->right) >= height(right->left))
+		{
+			// Single rotation to the left
+			return makeNode(makeNode(left, right->left), right->right);
+		}
+		// Double rotation to the left
+		return makeNode(makeNode(left, right->left->left), makeNode(right->left->right, right->right));
+	}
+	return makeNode(left, right);
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::NodePtr Rope<TChar, TAllocator>::join(const NodePtr& left, const NodePtr& right)
+{
+	if (!left)
+	{
+		return right;
+	}
+	if (!right)
+	{
+		return left;
+	}
+
+	// Descend along the inner edge of the higher tree until both heights match
+	if (left->height > right->height + 1)
+	{
+		return balance(left->left, join(left->right, right));
+	}
+	if (right->height > left->height + 1)
+	{
+		return balance(join(left, right->left), right->right);
+	}
+	return makeNode(left, right);
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::split(const NodePtr& node, size_t pos, NodePtr& left, NodePtr& right)
+{
+	if (!node || !pos)
+	{
+		left.reset();
+		right = node;
+		return;
+	}
+	if (pos >= node->length)
+	{
+		left = node;
+		right.reset();
+		return;
+	}
+	if (node->chunk)
+	{
+		// Both parts reference the same chunk
+		left = makeLeaf(node->chunk, node->offset, pos);
+		right = makeLeaf(node->chunk, node->offset + pos, node->length - pos);
+		return;
+	}
+
+	NodePtr splitLeft;
+	NodePtr splitRight;
+	size_t leftLength = node->left->length;
+	if (pos < leftLength)
+	{
+		split(node->left, pos, splitLeft, splitRight);
+		left = splitLeft;
+		right = join(splitRight, node->right);
+	}
+	else
+	{
+		split(node->right, pos - leftLength, splitLeft, splitRight);
+		left = join(node->left, splitLeft);
+		right = splitRight;
+	}
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::NodePtr Rope<TChar, TAllocator>::replaceLast(const NodePtr& node, const NodePtr& leaf)
+{
+	if (node->chunk)
+	{
+		return leaf;
+	}
+	return makeNode(node->left, replaceLast(node->right, leaf));
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::Rope(const NodePtr& root)
+	: m_root(root)
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::ChunkIterator::descend(const Node* node)
+{
+	while (node && !node->chunk)
+	{
+		m_stack.push_back(node);
+		node = node->left.get();
+	}
+	m_next = node;
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::ChunkIterator::ChunkIterator(const Rope<TChar, TAllocator>& rope)
+	: m_next(0)
+{
+	descend(rope.m_root.get());
+}
+
+template<class TChar, class TAllocator>
+bool Rope<TChar, TAllocator>::ChunkIterator::next(const TChar*& data, size_t& length)
+{
+	if (!m_next)
+	{
+		return false;
+	}
+	data = m_next->chunk->c_str() + m_next->offset;
+	length = m_next->length;
+
+	// Continue with the leftmost leaf of the next right subtree
+	if (m_stack.empty())
+	{
+		m_next = 0;
+	}
+	else
+	{
+		const Node* node = m_stack.back();
+		m_stack.pop_back();
+		descend(node->right.get());
+	}
+	return true;
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::Rope()
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::Rope(const TChar* str)
+{
+	append(str);
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::Rope(const StringType& str)
+{
+	append(str);
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>::Rope(StringType&& str)
+{
+	append(std::move(str));
+}
+
+template<class TChar, class TAllocator>
+size_t Rope<TChar, TAllocator>::length() const
+{
+	return m_root ? m_root->length : 0;
+}
+
+template<class TChar, class TAllocator>
+size_t Rope<TChar, TAllocator>::height() const
+{
+	return height(m_root);
+}
+
+template<class TChar, class TAllocator>
+TChar Rope<TChar, TAllocator>::at(size_t pos) const
+{
+	if (pos >= length())
+	{
+		return static_cast<TChar>(0);
+	}
+
+	const Node* node = m_root.get();
+	while (!node->chunk)
+	{
+		if (pos < node->left->length)
+		{
+			node = node->left.get();
+		}
+		else
+		{
+			pos -= node->left->length;
+			node = node->right.get();
+		}
+	}
+	return node->chunk->c_str()[node->offset + pos];
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::append(const Rope<TChar, TAllocator>& other)
+{
+	m_root = join(m_root, other.m_root);
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::append(const TChar* other, size_t len)
+{
+	if (!other)
+	{
+		return;
+	}
+	if (!len)
+	{
+		len = StringKernels<TChar>::length(other);
+		if (!len)
+		{
+			return;
+		}
+	}
+
+	// Merge short strings into the last chunk instead of creating many tiny chunks
+	if (m_root && len <= STRING_ROPE_MERGE_LENGTH)
+	{
+		const Node* last = m_root.get();
+		while (!last->chunk)
+		{
+			last = last->right.get();
+		}
+		if (last->length + len <= STRING_ROPE_MERGE_LENGTH)
+		{
+			std::shared_ptr<StringType> chunk = std::make_shared<StringType>(last->chunk->c_str(), last->offset, last->length, last->length + len);
+			chunk->append(other, 0, len);
+			m_root = replaceLast(m_root, makeLeaf(chunk, 0, chunk->length()));
+			return;
+		}
+	}
+	m_root = join(m_root, makeLeaf(std::make_shared<const StringType>(other, 0, len), 0, len));
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::append(const StringType& other)
+{
+	append(other.c_str(), other.length());
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::append(StringType&& other)
+{
+	size_t len = other.length();
+	if (len <= STRING_ROPE_MERGE_LENGTH)
+	{
+		append(other.c_str(), len);
+		return;
+	}
+	m_root = join(m_root, makeLeaf(std::make_shared<const StringType>(std::move(other)), 0, len));
+}
+
+template<class TChar, class TAllocator>
+void Rope<TChar, TAllocator>::split(size_t pos, Rope<TChar, TAllocator>& left, Rope<TChar, TAllocator>& right) const
+{
+	// left or right may be the instance itself
+	NodePtr root = m_root;
+	split(root, pos, left.m_root, right.m_root);
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator> Rope<TChar, TAllocator>::substr(size_t pos, size_t len) const
+{
+	NodePtr unused;
+	NodePtr tail;
+	NodePtr part;
+	split(m_root, pos, unused, tail);
+	split(tail, len, part, unused);
+	return Rope<TChar, TAllocator>(part);
+}
+
+template<class TChar, class TAllocator>
+typename Rope<TChar, TAllocator>::StringType Rope<TChar, TAllocator>::flatten() const
+{
+	StringType result(length());
+	const TChar* data;
+	size_t len;
+	ChunkIterator iterator(*this);
+	while (iterator.next(data, len))
+	{
+		result.append(data, 0, len);
+	}
+	return result;
+}
+
+template<class TChar, class TAllocator>
+const TChar* Rope<TChar, TAllocator>::c_str()
+{
+	if (!m_root)
+	{
+		static const TChar empty = static_cast<TChar>(0);
+		return &empty;
+	}
+
+	// Only a leaf referencing a whole chunk is zero-terminated
+	if (!m_root->chunk || m_root->offset || m_root->length != m_root->chunk->length())
+	{
+		m_root = makeLeaf(std::make_shared<const StringType>(flatten()), 0, m_root->length);
+	}
+	return m_root->chunk->c_str();
+}
+
+template<class TChar, class TAllocator>
+template<class TFunction>
+void Rope<TChar, TAllocator>::forEachChunk(TFunction function) const
+{
+	const TChar* data;
+	size_t len;
+	ChunkIterator iterator(*this);
+	while (iterator.next(data, len))
+	{
+		function(data, len);
+	}
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>& Rope<TChar, TAllocator>::operator+=(const Rope<TChar, TAllocator>& other)
+{
+	append(other);
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>& Rope<TChar, TAllocator>::operator+=(const TChar* other)
+{
+	append(other);
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>& Rope<TChar, TAllocator>::operator+=(const StringType& other)
+{
+	append(other);
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator>& Rope<TChar, TAllocator>::operator+=(StringType&& other)
+{
+	append(std::move(other));
+	return *this;
+}
+
+
+
+template<class TChar, class TAllocator>
+Rope<TChar, TAllocator> operator+(const Rope<TChar, TAllocator>& lhs, const Rope<TChar, TAllocator>& rhs)
+{
+	Rope<TChar, TAllocator> result(lhs);
+	result.append(rhs);
+	return result;
+}
@@ -8,22 +8,83 @@
 #define STRING_HPP
 
 
+// For the reference count of shared buffers
+#include <atomic>
 // For memcpy
 #include <cstring>
-
-
-// Size of the SSO buffer in characters excluding the terminating 0
+// For std::make_unsigned
+#include <type_traits>
+// For std::move
+#include <utility>
+// For the vectorized c-string routines
+#include "StringKernels.hpp"
+// For the default allocator
+#include "StringAllocator.hpp"
+// For the instrumentation enabled by STRING_STATS
+#include "StringStats.hpp"
+// For non-owning views of strings
+#include "StringView.hpp"
+
+
+// Size of the SSO buffer in characters excluding the terminating 0, any capacity including 0 is valid
+#ifndef STRING_SSO_BUFFER_CAPACITY
 #define STRING_SSO_BUFFER_CAPACITY 15
-// Growth factor of the dynamically allocated buffer
+#endif
+// Growth factor of the dynamically allocated buffer, has to be greater than 1. A buffer grows by at least one character
+#ifndef STRING_BUFFER_GROWTH_FACTOR
 #define STRING_BUFFER_GROWTH_FACTOR 1.5f
-
+#endif
+// Enables the compact layout without a vtable, storing the SSO buffer in the same memory as the pointer, length
+// and capacity of the dynamically allocated buffer. AString then fits 23 characters into 24 bytes on 64 bit systems.
+#ifndef STRING_COMPACT_LAYOUT
+#define STRING_COMPACT_LAYOUT 0
+#endif
+// Enables sharing dynamically allocated buffers between copies using an atomic reference count stored in front of the
+// buffer. Copies of strings using a dynamically allocated buffer then take O(1), the buffer is copied by the first
+// mutating call on a string sharing it.
+#ifndef STRING_SHARED_BUFFER
+#define STRING_SHARED_BUFFER 0
+#endif
+// Enables reading and writing strings using file descriptors, see String::readFile and StringFile.hpp
+#ifndef STRING_POSIX_IO
+#if defined(__unix__) || defined(__APPLE__)
+#define STRING_POSIX_IO 1
+#else
+#define STRING_POSIX_IO 0
+#endif
+#endif
+
+#if STRING_POSIX_IO
+// For errno
+#include <cerrno>
+// For open
+#include <fcntl.h>
+// For fstat
+#include <sys/stat.h>
+// For read, write and close
+#include <unistd.h>
+#endif
+
+
+// Expression template of the concatenation operators, see StringConcat.hpp
+template<class TChar, class... TPieces>
+class StringConcat;
+
+// Pattern with arguments used by format, see StringConcat.hpp
+template<class TChar, class... TArgs>
+class StringFormat;
 
 /**
  * @class String
  * String class implementing small-string-optimization and a dynamically growing internal buffer.
- * It provides basic string manipulation functionality.
+ * It provides basic string manipulation functionality. The dynamically allocated buffer is managed by TAllocator,
+ * see StringAllocator.hpp for the interface and the available allocators.
+ * Using STRING_SHARED_BUFFER, copies share the dynamically allocated buffer until one of them is modified, unless
+ * StringAllocatorTraits of the allocator disables it. Strings
+ * sharing a buffer may be used by different threads concurrently like independent strings, a single String still
+ * must not be modified concurrently. Pointers returned by c_str are invalidated by the next mutating call.
  */
-template<class TChar>
+template<class TChar, class TAllocator = StringAllocator<TChar> >
 class String
 {
 private:
@@ -53,14 +114,56 @@ private:
 	static size_t cstr_copy(TChar* dst, const TChar* src, size_t pos, size_t length);
 
 	/**
-	 * Compares two c-strings to each other.
+	 * Compares two c-strings to each other lexicographically, comparing the characters as unsigned values.
 	 * @param	str1	First string for the comparision
 	 * @param	str2	Second string for the comparision
-	 * @return		0 if both strings are equal, otherwise non-zero
+	 * @return		0 if both strings are equal, -1 if str1 is ordered before str2, otherwise 1
 	 */
 	static int cstr_compare(const TChar* str1, const TChar* str2);
 	
 
+#if STRING_COMPACT_LAYOUT
+	enum
+	{
+		// Size of the storage shared by the SSO buffer and the fields of the dynamically allocated buffer in bytes
+		STORAGE_SIZE = ((STRING_SSO_BUFFER_CAPACITY + 1) * sizeof(TChar) > 3 * sizeof(size_t) ?
+			((STRING_SSO_BUFFER_CAPACITY + 1) * sizeof(TChar) + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t) :
+			3 * sizeof(size_t)),
+		// Count of words in the storage
+		STORAGE_WORDS = STORAGE_SIZE / sizeof(size_t),
+		// Size of the SSO buffer in characters excluding the terminating 0
+		SSO_CAPACITY = STORAGE_SIZE / sizeof(TChar) - 1
+	};
+
+	static_assert(sizeof(TChar*) == sizeof(size_t), "The compact layout requires pointers of the size of size_t");
+	static_assert(SSO_CAPACITY < 0x80, "The compact layout requires a SSO capacity below 128 characters");
+
+	// Storage of the string. Using the SSO buffer, the last character stores the remaining capacity, which becomes
+	// the terminating 0 if the SSO buffer is full. Using the dynamically allocated buffer, the first word stores the
+	// pointer to the buffer, the second one the length and the last one the capacity and a flag in its last byte.
+	union {
+		// Stack SSO buffer
+		TChar m_ssoBuffer[SSO_CAPACITY + 1];
+		// Dynamically allocated buffer
+		TChar* m_buffer;
+		// Words of the storage
+		size_t m_words[STORAGE_WORDS];
+	};
+
+	/**
+	 * Packs the capacity of the dynamically allocated buffer and the flag marking its use into one word.
+	 * @param	capacity	Capacity of the dynamically allocated buffer in characters
+	 * @return			Packed word
+	 */
+	static size_t packCapacity(size_t capacity);
+
+	/**
+	 * Extracts the capacity of the dynamically allocated buffer from a word packed by packCapacity.
+	 * @param	word	Packed word
+	 * @return		Capacity of the dynamically allocated buffer in characters
+	 */
+	static size_t unpackCapacity(size_t word);
+#else
 	// Size of the allocated buffer in characters excluding the terminating 0
 	size_t m_capacity;
 	// Length of the string in characters excluding the terminating 0
@@ -73,6 +176,35 @@ private:
 		// Dynamically allocated buffer
 		TChar* m_buffer;
 	};
+#endif
+
+#if STRING_SHARED_BUFFER
+	enum
+	{
+		// Whether copies share the dynamically allocated buffer
+		SHARED_BUFFERS = StringAllocatorTraits<TAllocator>::SHARED_BUFFERS,
+		// Size of the reference count in front of a dynamically allocated buffer in characters
+		HEADER_SIZE = SHARED_BUFFERS ? (sizeof(std::atomic<size_t>) + sizeof(TChar) - 1) / sizeof(TChar) : 0
+	};
+
+	/**
+	 * Returns the reference count of the dynamically allocated buffer.
+	 * @return	Count of instances sharing the buffer
+	 */
+	std::atomic<size_t>& references() const;
+#endif
+
+	/**
+	 * Copies a shared dynamically allocated buffer, so the instance can modify it. Does nothing if the buffer is not
+	 * shared.
+	 */
+	void detach();
+
+	/**
+	 * Stores the length of the string without detaching a shared buffer.
+	 * @param	length	New length of the string
+	 */
+	void storeLength(size_t length);
 
 	/**
 	 * Checks if the instance of the class uses the dynamically allocated buffer.
@@ -87,7 +219,78 @@ private:
 	 */
 	size_t calcNewCapacity(size_t minCapacity) const;
 
+	/**
+	 * Switches the instance to a dynamically allocated buffer. The length has to be set afterwards.
+	 * @param	buffer		Dynamically allocated buffer
+	 * @param	capacity	Capacity of the buffer in characters excluding the terminating 0
+	 */
+	void setDynamicBuffer(TChar* buffer, size_t capacity);
+
+	/**
+	 * Calculates the capacity of the buffer allocateBuffer allocates for a given capacity.
+	 * @param	capacity	Minimum capacity in characters
+	 * @return			Capacity of the whole block the allocator provides in characters
+	 */
+	static size_t roundCapacity(size_t capacity);
+
+	/**
+	 * Checks if a view points into the stored string of the instance.
+	 * @param	view	View to check
+	 * @return		true if the view overlaps the stored string, otherwise false
+	 */
+	bool overlaps(const StringView<TChar>& view) const;
+
+	/**
+	 * Moves the stored string to a new buffer of exactly a given capacity or to the SSO buffer if it fits.
+	 * @param	capacity	New capacity in characters, at least the length of the string
+	 */
+	void reallocate(size_t capacity);
+
+	/**
+	 * Allocates a buffer for at least capacity characters and the terminating 0 using TAllocator.
+	 * @param	capacity	Minimum capacity in characters, updated to the capacity of the allocated buffer
+	 * @return			Allocated buffer
+	 */
+	static TChar* allocateBuffer(size_t& capacity);
+
+	/**
+	 * Deallocates the dynamically allocated buffer of the instance using TAllocator. A shared buffer is only released
+	 * by the instance and deallocated by the last one sharing it.
+	 */
+	void deallocateBuffer();
+
+	/**
+	 * Initializes the instance as an empty string stored in the SSO buffer without deallocating anything.
+	 */
+	void initialize();
+
+	/**
+	 * Deallocates the dynamically allocated buffer if there is one and resets the instance to an empty string
+	 * stored in the SSO buffer.
+	 */
+	void release();
+
+	/**
+	 * Takes over the string of another String instance. A dynamically allocated buffer is taken over without
+	 * copying, a string stored in the SSO buffer is copied. The other instance is left as an empty string.
+	 * The instance must not use a dynamically allocated buffer when calling this method.
+	 * @param	other	String to take over the string from
+	 */
+	void steal(String<TChar, TAllocator>& other);
+
+	/**
+	 * Appends a formatted number, writing it directly behind the string if the spare capacity suffices.
+	 * @param	value		Number to append
+	 * @param	maxLength	Maximum length of a formatted number
+	 * @param	formatter	Function writing the number and returning its length, see StringNumber
+	 */
+	template<class TValue>
+	void appendNumber(TValue value, size_t maxLength, size_t (*formatter)(TValue, TChar*));
+
 public:
+	// Position returned by the search methods if nothing was found
+	static const size_t NOT_FOUND = StringView<TChar>::NOT_FOUND;
+
 	/**
 	 * Default constructor for instances of the class String. Constructs an empty instance.
 	 */
@@ -116,12 +319,38 @@ public:
 	 * @param	len			Count of characters to copy
 	 * @param	initialCapacity		Initial capacity of the buffer for the string of the instance in characters
 	 */
-	String(const String<TChar>& other, size_t pos = 0, size_t len = 0, size_t initialCapacity = 0);
+	String(const String<TChar, TAllocator>& other, size_t pos = 0, size_t len = 0, size_t initialCapacity = 0);
+
+	/**
+	 * Constructor which creates an instance of the class String from the characters of a StringView.
+	 * @param	other			View to copy
+	 * @param	initialCapacity		Initial capacity of the buffer for the string of the instance in characters
+	 */
+	explicit String(const StringView<TChar>& other, size_t initialCapacity = 0);
+
+	/**
+	 * Move-constructor. Creates an instance of the class String by taking over the string of another String. No
+	 * buffer is allocated, the other instance is left as an empty string.
+	 * @param	other	String to take over
+	 */
+	String(String<TChar, TAllocator>&& other) noexcept;
+
+	/**
+	 * Constructor which creates an instance of the class String from a concatenation, allocating at most once for the
+	 * combined length.
+	 * @param	other	Concatenation to copy
+	 */
+	template<class... TPieces>
+	String(const StringConcat<TChar, TPieces...>& other);
 	
 	/**
 	 * Destructor for instances of the class String.
 	 */
+#if STRING_COMPACT_LAYOUT
+	~String();
+#else
 	virtual ~String();
+#endif
 
 	/**
 	 * Clears the stored string of the instance and copies a c-string to the internal buffer.
@@ -133,11 +362,28 @@ public:
 
 	/**
 	 * Clears the stored string of the instance and copies the string of another String instance to the internal buffer.
+	 * Using STRING_SHARED_BUFFER, an instance without a dynamically allocated buffer shares the one of source instead
+	 * if the whole string is copied.
 	 * @param	source	String to copy to the internal buffer
 	 * @param	pos	Position from where to copy
 	 * @param	len	Length of the string to copy in characters
 	 */
-	void copy(const String<TChar>& source, size_t pos = 0, size_t len = 0);
+	void copy(const String<TChar, TAllocator>& source, size_t pos = 0, size_t len = 0);
+
+	/**
+	 * Clears the stored string of the instance and copies the characters of a StringView to the internal buffer.
+	 * @param	source	View to copy to the internal buffer
+	 */
+	void copy(const StringView<TChar>& source);
+
+	/**
+	 * Clears the stored string of the instance and copies the pieces of a concatenation to the internal buffer. The
+	 * buffer is reused if the combined length fits and no piece points into it, otherwise a buffer of exactly the
+	 * combined length is allocated.
+	 * @param	source	Concatenation to copy to the internal buffer
+	 */
+	template<class... TPieces>
+	void copy(const StringConcat<TChar, TPieces...>& source);
 
 	/**
 	 * Returns a constant pointer to the internal string buffer.
@@ -146,7 +392,7 @@ public:
 	const TChar* c_str() const;
 
 	/**
-	 * Returns a pointer to the internal string buffer.
+	 * Returns a pointer to the internal string buffer. A shared buffer is copied first.
 	 * @return	Pointer to the internal string buffer
 	 */
 	TChar* data();
@@ -167,16 +413,31 @@ public:
 	
 	/**
 	 * Sets the length of the string. This method provides a functionality to correct the value of the member variable
-	 * m_length after the internal string was manipulated outside of the class using the data() method.
+	 * m_length after the internal string was manipulated outside of the class using the data() method. The length
+	 * must not exceed the capacity. A shared buffer is copied first.
 	 * @param	length	New length of the string
 	 */
 	void setLength(size_t length);
 
+	/**
+	 * Checks if the dynamically allocated buffer of the instance is shared with other instances. Always false unless
+	 * STRING_SHARED_BUFFER is enabled.
+	 * @return	true if the buffer is shared, otherwise false
+	 */
+	bool isShared() const;
+
 	/**
 	 * Returns the capacity of the internal string buffer in characters.
 	 * @return	Capacity of the internal buffer in characters
 	 */
 	size_t capacity() const;
+
+	/**
+	 * Returns the capacity of the SSO buffer in characters. Using the compact layout this may exceed
+	 * STRING_SSO_BUFFER_CAPACITY if the storage required for the dynamically allocated buffer is larger.
+	 * @return	Capacity of the SSO buffer in characters
+	 */
+	static constexpr size_t ssoCapacity();
 	
 	/**
 	 * Updates the capacity of the internal string buffer for at least minLength characters. The method dynamically
@@ -185,6 +446,19 @@ public:
 	 */
 	void setCapacity(size_t minLength);
 
+	/**
+	 * Updates the capacity of the internal string buffer for at least minLength characters. Unlike setCapacity the
+	 * buffer does not grow by the growth factor, so a string built to a known length allocates exactly once.
+	 * @param	minLength	New minimum capacity of the instance in characters
+	 */
+	void reserve(size_t minLength);
+
+	/**
+	 * Reduces the capacity to the length of the string, moving it to the SSO buffer if it fits. A shared buffer is
+	 * kept.
+	 */
+	void shrinkToFit();
+
 	/**
 	 * Appends a c-string to the end of the string stored in the instance.
 	 * @param	other	C-string to append
@@ -199,42 +473,322 @@ public:
 	 * @param	pos	Position from where to copy
 	 * @param	len	Count of characters to copy from other
 	 */
-	void append(const String<TChar>& other, size_t pos = 0, size_t len = 0);
+	void append(const String<TChar, TAllocator>& other, size_t pos = 0, size_t len = 0);
+
+	/**
+	 * Appends one String to another. If the buffer of the instance is too small but the dynamically allocated buffer
+	 * of other is large enough for the result, the buffer of other is taken over instead of allocating a new one.
+	 * The other instance is left in a valid but unspecified state.
+	 * @param	other	String to append
+	 */
+	void append(String<TChar, TAllocator>&& other);
+
+	/**
+	 * Appends the characters of a StringView, which may view the string of the instance itself.
+	 * @param	other	View to append
+	 */
+	void append(const StringView<TChar>& other);
+
+	/**
+	 * Appends the pieces of a concatenation to the end of the string stored in the instance, growing the buffer at
+	 * most once. The pieces may point into the buffer of the instance.
+	 * @param	other	Concatenation to append
+	 */
+	template<class... TPieces>
+	void append(const StringConcat<TChar, TPieces...>& other);
+
+	/**
+	 * Appends the decimal representation of a signed integer without allocating if the spare capacity suffices.
+	 * @param	value	Integer to append
+	 */
+	void appendInt(int64_t value);
+
+	/**
+	 * Appends the decimal representation of an unsigned integer without allocating if the spare capacity suffices.
+	 * @param	value	Integer to append
+	 */
+	void appendUInt(uint64_t value);
+
+	/**
+	 * Appends the shortest decimal representation of a double which parses back to the same double without
+	 * allocating if the spare capacity suffices, see StringNumber::formatDouble.
+	 * @param	value	Double to append
+	 */
+	void appendDouble(double value);
+
+	/**
+	 * Appends a pattern whose placeholders {} are replaced by the arguments in order, growing the buffer at most
+	 * once. Literal braces are written as {{ and }}. The arguments may be anything a concatenation accepts.
+	 * @param	pattern		Pattern to append
+	 * @param	arguments	Arguments replacing the placeholders
+	 * @return			true if the pattern contains one placeholder per argument and no other braces, otherwise
+	 *				false and the string is unchanged
+	 */
+	template<class... TArgs>
+	bool appendFormat(const StringView<TChar>& pattern, const TArgs&... arguments);
+
+	/**
+	 * Sets the string to a pattern whose placeholders {} are replaced by the arguments, see appendFormat.
+	 * @param	pattern		Pattern to format
+	 * @param	arguments	Arguments replacing the placeholders
+	 * @return			true if the pattern contains one placeholder per argument and no other braces, otherwise
+	 *				false and the string is unchanged
+	 */
+	template<class... TArgs>
+	bool format(const StringView<TChar>& pattern, const TArgs&... arguments);
+
+	/**
+	 * Prepends a c-string to the beginning of the string stored in the instance.
+	 * @param	other	C-string to prepend
+	 * @param	pos	Position from where to copy
+	 * @param	len	Count of characters to copy from other
+	 */
+	void prepend(const TChar* other, size_t pos = 0, size_t len = 0);
 
 	/**
-	 * Compares the internal stored string of the instance to a c-string.
+	 * Prepends one String to another.
+	 * @param	other	String to prepend
+	 * @param	pos	Position from where to copy
+	 * @param	len	Count of characters to copy from other
+	 */
+	void prepend(const String<TChar, TAllocator>& other, size_t pos = 0, size_t len = 0);
+
+	/**
+	 * Inserts characters in front of a position, moving the rest of the string in place if the capacity suffices.
+	 * @param	pos	Position to insert at, the length of the string at most
+	 * @param	str	Characters to insert, which may view the string of the instance itself
+	 */
+	void insert(size_t pos, const StringView<TChar>& str);
+
+	/**
+	 * Removes characters in place.
+	 * @param	pos	Position of the first character to remove
+	 * @param	len	Count of characters to remove, all characters behind pos by default
+	 */
+	void erase(size_t pos, size_t len = NOT_FOUND);
+
+	/**
+	 * Replaces characters by others, moving the rest of the string in place if the capacity suffices.
+	 * @param	pos	Position of the first character to replace
+	 * @param	len	Count of characters to replace
+	 * @param	str	Characters to insert instead, which may view the string of the instance itself
+	 */
+	void replace(size_t pos, size_t len, const StringView<TChar>& str);
+
+	/**
+	 * Replaces the first occurrence of a string.
+	 * @param	needle		String to replace, an empty string is never replaced
+	 * @param	replacement	String to insert instead
+	 * @param	pos		Position to start searching at
+	 * @return			Position of the replaced occurrence, NOT_FOUND if there is none
+	 */
+	size_t replace(const StringView<TChar>& needle, const StringView<TChar>& replacement, size_t pos = 0);
+
+	/**
+	 * Replaces all non-overlapping occurrences of a string from left to right in a single pass. A replacement not
+	 * longer than needle is written in place. For a longer one the occurrences are counted first, so the buffer grows
+	 * at most once, and the string is rewritten from behind its final length if the capacity suffices.
+	 * @param	needle		String to replace, an empty string is never replaced
+	 * @param	replacement	String to insert instead
+	 * @return			Count of replaced occurrences
+	 */
+	size_t replaceAll(const StringView<TChar>& needle, const StringView<TChar>& replacement);
+
+	/**
+	 * Removes leading and trailing ASCII whitespace in place.
+	 */
+	void trim();
+
+	/**
+	 * Converts the ASCII letters of the string to lower case in place, see StringKernels::toLower.
+	 */
+	void toLower();
+
+	/**
+	 * Converts the ASCII letters of the string to upper case in place, see StringKernels::toUpper.
+	 */
+	void toUpper();
+
+	/**
+	 * Exchanges the strings of two instances without allocating or copying dynamically allocated buffers.
+	 * @param	other	String to swap with
+	 */
+	void swap(String<TChar, TAllocator>& other) noexcept;
+
+	/**
+	 * Compares the internal stored string of the instance lexicographically to a c-string.
 	 * @param	other	C-string to compare to
-	 * @return		0 if both strings are equal, otherwise non-zero
+	 * @return		0 if both strings are equal, -1 if the string is ordered before other, otherwise 1
 	 */
 	int compare(const TChar* other) const;
 
+	/**
+	 * Compares the internal stored string of the instance lexicographically to a StringView.
+	 * @param	other	View to compare to
+	 * @return		0 if both strings are equal, -1 if the string is ordered before other, otherwise 1
+	 */
+	int compare(const StringView<TChar>& other) const;
+
+	/**
+	 * Searches the first occurrence of a string using the length of the stored string instead of its terminator. The
+	 * search algorithm is selected by the length of needle, see Searcher.
+	 * @param	needle	String to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the string, NOT_FOUND if it does not occur
+	 */
+	size_t find(const StringView<TChar>& needle, size_t pos = 0) const;
+
+	/**
+	 * Searches the first occurrence of a character.
+	 * @param	c	Character to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the character, NOT_FOUND if it does not occur
+	 */
+	size_t find(TChar c, size_t pos = 0) const;
+
+	/**
+	 * Searches the last occurrence of a string.
+	 * @param	needle	String to search
+	 * @param	pos	Last position the string may start at
+	 * @return		Position of the string, NOT_FOUND if it does not occur
+	 */
+	size_t rfind(const StringView<TChar>& needle, size_t pos = NOT_FOUND) const;
+
+	/**
+	 * Searches the first occurrence of any character of a set.
+	 * @param	set	Characters to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the first character contained in set, NOT_FOUND if none occurs
+	 */
+	size_t findFirstOf(const StringView<TChar>& set, size_t pos = 0) const;
+
+	/**
+	 * Checks if a string occurs in the stored string.
+	 * @param	needle	String to search
+	 * @return		true if needle occurs, otherwise false
+	 */
+	bool contains(const StringView<TChar>& needle) const;
+
+	/**
+	 * Counts the non-overlapping occurrences of a string. An empty string is never counted.
+	 * @param	needle	String to count
+	 * @return		Count of occurrences
+	 */
+	size_t count(const StringView<TChar>& needle) const;
+
+	/**
+	 * Calculates the hash of the stored string over its length, see StringView::hash.
+	 * @return	Hash of the stored string
+	 */
+	size_t hash() const;
+
+	/**
+	 * Parses the whole stored string as a signed decimal integer, see StringNumber::parseInt.
+	 * @param	value	Parsed value, unchanged if the string is no valid integer
+	 * @return		true if the string was parsed, otherwise false
+	 */
+	bool parseInt(int64_t& value) const;
+
+	/**
+	 * Parses the whole stored string as an unsigned decimal integer, see StringNumber::parseUInt.
+	 * @param	value	Parsed value, unchanged if the string is no valid integer
+	 * @return		true if the string was parsed, otherwise false
+	 */
+	bool parseUInt(uint64_t& value) const;
+
+	/**
+	 * Parses the whole stored string as a double rounded correctly, see StringNumber::parseDouble.
+	 * @param	value	Parsed value, unchanged if the string is no valid double
+	 * @return		true if the string was parsed, otherwise false
+	 */
+	bool parseDouble(double& value) const;
+
+#if STRING_POSIX_IO
+	/**
+	 * Replaces the string by the content of a file, which is read directly into the buffer. The buffer is allocated
+	 * once for the size of a regular file and grown while reading other files like pipes. The bytes are taken as
+	 * characters of TChar, a trailing incomplete character is dropped.
+	 * @param	path	Path of the file to read
+	 * @return		true if the file was read, otherwise false and the string is empty
+	 */
+	bool readFile(const char* path);
+
+	/**
+	 * Writes the string to a file descriptor, continuing after partial writes and interrupts.
+	 * @param	fd	File descriptor to write to
+	 * @return		true if the whole string was written, otherwise false
+	 */
+	bool writeTo(int fd) const;
+#endif
+
+	/**
+	 * Concatenates any count of Strings, views, c-strings, characters, integers and doubles, allocating at most once
+	 * for the combined length and copying every piece once.
+	 * @param	pieces	Pieces to concatenate
+	 * @return		Concatenation of the pieces
+	 */
+	template<class... TPieces>
+	static String<TChar, TAllocator> concat(const TPieces&... pieces);
+
 	/**
 	 * Assign operator. Sets the internal stored string of the instance to a c-string.
 	 * @param	other	C-string to copy
 	 * @return		Reference to the instance
 	 */
-	String<TChar>& operator=(const TChar* other);
+	String<TChar, TAllocator>& operator=(const TChar* other);
 
 	/**
 	 * Assign operator. Sets the internal stored string of the instance to the string of another String instance.
 	 * @param	other	String to copy
 	 * @return		Reference to the instance
 	 */
-	String<TChar>& operator=(const String<TChar>& other);
+	String<TChar, TAllocator>& operator=(const String<TChar, TAllocator>& other);
+
+	/**
+	 * Move-assign operator. Sets the internal stored string of the instance by taking over the string of another
+	 * String instance. The other instance is left as an empty string.
+	 * @param	other	String to take over
+	 * @return		Reference to the instance
+	 */
+	String<TChar, TAllocator>& operator=(String<TChar, TAllocator>&& other) noexcept;
+
+	/**
+	 * Assign operator. Sets the internal stored string of the instance to a concatenation.
+	 * @param	other	Concatenation to copy
+	 * @return		Reference to the instance
+	 */
+	template<class... TPieces>
+	String<TChar, TAllocator>& operator=(const StringConcat<TChar, TPieces...>& other);
 
 	/**
 	 * Add-to operator. Appends a c-string to the internal stored string of the instance.
 	 * @param	other	C-string to append
 	 * @return		Reference to the instance
 	 */
-	String<TChar>& operator+=(const TChar* other);
+	String<TChar, TAllocator>& operator+=(const TChar* other);
 
 	/**
 	 * Add-to operator. Appends a string to the internal stored string of the instance.
 	 * @param	other	String to append
 	 * @return		Reference to the instance
 	 */
-	String<TChar>& operator+=(const String<TChar>& other);
+	String<TChar, TAllocator>& operator+=(const String<TChar, TAllocator>& other);
+
+	/**
+	 * Add-to operator. Appends a string to the internal stored string of the instance, taking over the buffer of
+	 * other if possible.
+	 * @param	other	String to append
+	 * @return		Reference to the instance
+	 */
+	String<TChar, TAllocator>& operator+=(String<TChar, TAllocator>&& other);
+
+	/**
+	 * Add-to operator. Appends a concatenation to the internal stored string of the instance.
+	 * @param	other	Concatenation to append
+	 * @return		Reference to the instance
+	 */
+	template<class... TPieces>
+	String<TChar, TAllocator>& operator+=(const StringConcat<TChar, TPieces...>& other);
 
 	/**
 	 * Equal operator. Checks if a c-string is equal to the internal stored string of the instance.
@@ -249,7 +803,7 @@ public:
 	 * @param	other	String to compare to
 	 * @return		true if both strings are equal, otherwise false
 	 */
-	bool operator==(const String<TChar>& other) const;
+	bool operator==(const String<TChar, TAllocator>& other) const;
 
 	/**
 	 * Unequal operator. Checks if a c-string is unequal to the internal stored string of the instance.
@@ -264,12 +818,98 @@ public:
 	 * @param	other	String instance to compare to
 	 * @return		true if both strings are unequal, otherwise false
 	 */
-	bool operator!=(const String<TChar>& other) const;
+	bool operator!=(const String<TChar, TAllocator>& other) const;
+
+	/**
+	 * Less operator. Checks if the internal stored string is ordered lexicographically before the one of another
+	 * instance, which allows Strings as keys of ordered containers.
+	 * @param	other	String to compare to
+	 * @return		true if the string is ordered before other, otherwise false
+	 */
+	bool operator<(const String<TChar, TAllocator>& other) const;
+
+	/**
+	 * Less or equal operator. Checks if the internal stored string is not ordered lexicographically after the one of
+	 * another instance.
+	 * @param	other	String to compare to
+	 * @return		true if the string is not ordered after other, otherwise false
+	 */
+	bool operator<=(const String<TChar, TAllocator>& other) const;
+
+	/**
+	 * Greater operator. Checks if the internal stored string is ordered lexicographically after the one of another
+	 * instance.
+	 * @param	other	String to compare to
+	 * @return		true if the string is ordered after other, otherwise false
+	 */
+	bool operator>(const String<TChar, TAllocator>& other) const;
+
+	/**
+	 * Greater or equal operator. Checks if the internal stored string is not ordered lexicographically before the one
+	 * of another instance.
+	 * @param	other	String to compare to
+	 * @return		true if the string is not ordered before other, otherwise false
+	 */
+	bool operator>=(const String<TChar, TAllocator>& other) const;
 };
 
 
+/**
+ * Exchanges the strings of two String instances.
+ * @param	lhs	First string
+ * @param	rhs	Second string
+ */
+template<class TChar, class TAllocator>
+void swap(String<TChar, TAllocator>& lhs, String<TChar, TAllocator>& rhs) noexcept;
+
+/**
+ * Concatenates two strings reusing the buffer of rhs if it is large enough.
+ * @param	lhs	Left-hand string
+ * @param	rhs	Right-hand string, taken over by the result if possible
+ * @return		Concatenation of lhs and rhs
+ */
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(const String<TChar, TAllocator>& lhs, String<TChar, TAllocator>&& rhs);
+
+/**
+ * Concatenates two strings reusing the buffer of lhs or rhs.
+ * @param	lhs	Left-hand string, taken over by the result
+ * @param	rhs	Right-hand string, taken over by the result if the buffer of lhs is too small
+ * @return		Concatenation of lhs and rhs
+ */
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(String<TChar, TAllocator>&& lhs, String<TChar, TAllocator>&& rhs);
+
+/**
+ * Concatenates a c-string and a string reusing the buffer of rhs if it is large enough.
+ * @param	lhs	Left-hand c-string
+ * @param	rhs	Right-hand string, taken over by the result if possible
+ * @return		Concatenation of lhs and rhs
+ */
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(const TChar* lhs, String<TChar, TAllocator>&& rhs);
+
+
 // Include String class implementation
 #include "String.tpp"
+// Include the expression templates of the concatenation operators
+#include "StringConcat.hpp"
+
+
+/**
+ * Specialization of std::hash for String, hashing the stored string over its length.
+ */
+namespace std
+{
+	template<class TChar, class TAllocator>
+	struct hash<String<TChar, TAllocator> >
+	{
+		size_t operator()(const String<TChar, TAllocator>& str) const
+		{
+			return str.hash();
+		}
+	};
+}
 
 
 // Typedef of the frequently used String classes
@@ -277,4 +917,12 @@ typedef String<char> AString;
 typedef String<wchar_t> WString;
 
 
+static_assert(STRING_BUFFER_GROWTH_FACTOR > 1, "The growth factor of the dynamically allocated buffer has to be greater than 1");
+
+#if STRING_COMPACT_LAYOUT
+static_assert(sizeof(AString) == 3 * sizeof(size_t), "AString has to fit into three words using the compact layout");
+static_assert(WString::ssoCapacity() >= STRING_SSO_BUFFER_CAPACITY, "WString has to keep the SSO capacity using the compact layout");
+#endif
+
+
 #endif // #ifndef STRING_HPP
@@ -8,38 +8,30 @@
 #error STRING_HPP undefined
 #endif
 
-template<class TChar>
-size_t String<TChar>::cstr_length(const TChar* str)
+template<class TChar, class TAllocator>
+const size_t String<TChar, TAllocator>::NOT_FOUND;
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::cstr_length(const TChar* str)
 {
-	size_t length = 0;
-	if (str)
-	{
-		while (str[length] != static_cast<TChar>(0))
-		{
-			length++;
-		}
-	}
-	return length;
+	return str ? StringKernels<TChar>::length(str) : 0;
 }
 
-template<class TChar>
-size_t String<TChar>::cstr_copy(TChar* dst, const TChar* src)
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::cstr_copy(TChar* dst, const TChar* src)
 {
 	size_t length = 0;
 	if (dst && src)
 	{
-		while (src[length] != static_cast<TChar>(0))
-		{
-			dst[length] = src[length];
-			length++;
-		}
-		dst[length] = static_cast<TChar>(0);
+		// Copy the string including the terminating 0
+		length = StringKernels<TChar>::length(src);
+		memcpy(dst, src, (length + 1) * sizeof(TChar));
 	}
 	return length;
 }
 
-template<class TChar>
-size_t String<TChar>::cstr_copy(TChar* dst, const TChar* src, size_t pos, size_t length)
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::cstr_copy(TChar* dst, const TChar* src, size_t pos, size_t length)
 {
 	if (dst && src)
 	{
@@ -55,103 +47,344 @@ size_t String<TChar>::cstr_copy(TChar* dst, const TChar* src, size_t pos, size_t
 	return 0;
 }
 
-template<class TChar>
-int String<TChar>::cstr_compare(const TChar* str1, const TChar* str2)
+template<class TChar, class TAllocator>
+int String<TChar, TAllocator>::cstr_compare(const TChar* str1, const TChar* str2)
 {
 	if (str1 && str2)
 	{
-		while (*(str1) && *(str2) && *(str1) == *(str2))
-		{
-			str1 = str1 + 1;
-			str2 = str2 + 1;
-		}
-		return (*str1) - (*str2);
+		typedef typename std::make_unsigned<TChar>::type Unsigned;
+		size_t index = StringKernels<TChar>::mismatch(str1, str2);
+		Unsigned c1 = static_cast<Unsigned>(str1[index]);
+		Unsigned c2 = static_cast<Unsigned>(str2[index]);
+		return c1 == c2 ? 0 : (c1 < c2 ? -1 : 1);
 	}
 	return 1; // TODO: Throw exception
 }
 
 
 
-template<class TChar>
-bool String<TChar>::usesDynamicBuffer() const
+#if STRING_COMPACT_LAYOUT
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::packCapacity(size_t capacity)
 {
+	// The flag has to be stored in the last byte of the storage, which is the last byte of the last word
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return (capacity << 8) | 0x80;
+#else
+	return capacity | (static_cast<size_t>(0x80) << (8 * (sizeof(size_t) - 1)));
+#endif
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::unpackCapacity(size_t word)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return word >> 8;
+#else
+	return word & ~(static_cast<size_t>(0x80) << (8 * (sizeof(size_t) - 1)));
+#endif
+}
+#endif
+
+#if STRING_SHARED_BUFFER
+template<class TChar, class TAllocator>
+std::atomic<size_t>& String<TChar, TAllocator>::references() const
+{
+	return *reinterpret_cast<std::atomic<size_t>*>(m_buffer - HEADER_SIZE);
+}
+#endif
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::detach()
+{
+#if STRING_SHARED_BUFFER
+	if (isShared())
+	{
+		// Copy the string before releasing the shared buffer, so other threads cannot free it while copying
+		size_t length = this->length();
+		size_t capacity = this->capacity();
+		TChar* buffer = allocateBuffer(capacity);
+		memcpy(buffer, m_buffer, (length + 1) * sizeof(TChar));
+		deallocateBuffer();
+		setDynamicBuffer(buffer, capacity);
+		storeLength(length);
+	}
+#endif
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::usesDynamicBuffer() const
+{
+#if STRING_COMPACT_LAYOUT
+	return 0 != (reinterpret_cast<const unsigned char*>(m_words)[STORAGE_SIZE - 1] & 0x80);
+#else
 	return m_capacity > STRING_SSO_BUFFER_CAPACITY;
+#endif
 }
 
-template<class TChar>
-size_t String<TChar>::calcNewCapacity(size_t minCapacity) const
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::calcNewCapacity(size_t minCapacity) const
 {
-	size_t newCapacity = m_capacity;
+	size_t newCapacity = capacity();
 	while (newCapacity < minCapacity)
 	{
-		newCapacity = static_cast<size_t>(STRING_BUFFER_GROWTH_FACTOR * newCapacity);
+		// Small capacities and factors close to 1 may truncate to the same capacity, so grow by at least one
+		size_t grown = static_cast<size_t>(STRING_BUFFER_GROWTH_FACTOR * newCapacity);
+		newCapacity = grown > newCapacity ? grown : newCapacity + 1;
 	}
 	return newCapacity;
 }
 
-template<class TChar>
-String<TChar>::String()
-	: m_capacity(STRING_SSO_BUFFER_CAPACITY), m_length(0)
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::roundCapacity(size_t capacity)
+{
+#if STRING_SHARED_BUFFER
+	return TAllocator::roundCapacity(capacity + HEADER_SIZE) - HEADER_SIZE;
+#else
+	return TAllocator::roundCapacity(capacity);
+#endif
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::overlaps(const StringView<TChar>& view) const
+{
+	const TChar* buffer = c_str();
+	return view.length() && view.data() < buffer + length() && view.data() + view.length() > buffer;
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::reallocate(size_t capacity)
+{
+	// Copy the string including the terminating 0 to a new instance and take it over
+	size_t length = this->length();
+#if STRING_STATS
+	if (usesDynamicBuffer())
+	{
+		StringStats::recordReallocation((length + 1) * sizeof(TChar));
+	}
+#endif
+	String<TChar, TAllocator> target(capacity);
+	memcpy(target.data(), c_str(), (length + 1) * sizeof(TChar));
+	target.storeLength(length);
+	release();
+	steal(target);
+}
+
+template<class TChar, class TAllocator>
+TChar* String<TChar, TAllocator>::allocateBuffer(size_t& capacity)
+{
+	// Use the whole block the allocator provides for the capacity
+	capacity = roundCapacity(capacity);
+#if STRING_STATS
+	StringStats::recordAllocation((capacity + 1) * sizeof(TChar));
+#endif
+#if STRING_SHARED_BUFFER
+	TChar* block = TAllocator::allocate(capacity + 1 + HEADER_SIZE);
+	if (SHARED_BUFFERS)
+	{
+		new (block) std::atomic<size_t>(1);
+	}
+	return block + HEADER_SIZE;
+#else
+	return TAllocator::allocate(capacity + 1);
+#endif
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::deallocateBuffer()
 {
-	// Nothing to do yet
+#if STRING_SHARED_BUFFER
+	// The last instance releasing the buffer deallocates it, a sole owner skips the atomic decrement
+	if (!SHARED_BUFFERS || 1 == references().load(std::memory_order_acquire) ||
+		1 == references().fetch_sub(1, std::memory_order_acq_rel))
+	{
+		TAllocator::deallocate(m_buffer - HEADER_SIZE, capacity() + 1 + HEADER_SIZE);
+	}
+#else
+	TAllocator::deallocate(m_buffer, capacity() + 1);
+#endif
 }
 
-template<class TChar>
-String<TChar>::String(size_t initialCapacity)
-	: m_capacity(STRING_SSO_BUFFER_CAPACITY), m_length(0)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::setDynamicBuffer(TChar* buffer, size_t capacity)
 {
+	m_buffer = buffer;
+#if STRING_COMPACT_LAYOUT
+	m_words[STORAGE_WORDS - 1] = packCapacity(capacity);
+#else
+	m_capacity = capacity;
+#endif
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::initialize()
+{
+#if STRING_COMPACT_LAYOUT
+	for (size_t i = 0; i < STORAGE_WORDS; i++)
+	{
+		m_words[i] = 0;
+	}
+	m_ssoBuffer[SSO_CAPACITY] = static_cast<TChar>(SSO_CAPACITY);
+#else
+	m_capacity = STRING_SSO_BUFFER_CAPACITY;
+	m_length = 0;
+	m_ssoBuffer[0] = static_cast<TChar>(0);
+#endif
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::release()
+{
+	if (usesDynamicBuffer())
+	{
+		deallocateBuffer();
+	}
+	initialize();
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::steal(String<TChar, TAllocator>& other)
+{
+	size_t length = other.length();
+	if (other.usesDynamicBuffer())
+	{
+		// Take over the buffer of other
+		setDynamicBuffer(other.m_buffer, other.capacity());
+	}
+	else
+	{
+		// Copy the SSO buffer including the terminating 0
+		memcpy(m_ssoBuffer, other.m_ssoBuffer, (length + 1) * sizeof(TChar));
+	}
+	storeLength(length);
+
+	// Leave other as an empty string
+	other.initialize();
+}
+
+template<class TChar, class TAllocator>
+template<class TValue>
+void String<TChar, TAllocator>::appendNumber(TValue value, size_t maxLength, size_t (*formatter)(TValue, TChar*))
+{
+	size_t length = this->length();
+	if (capacity() - length >= maxLength && !isShared())
+	{
+		// Write the number directly behind the string
+		TChar* buffer = data();
+		length += formatter(value, buffer + length);
+		buffer[length] = static_cast<TChar>(0);
+		storeLength(length);
+	}
+	else
+	{
+		// Format the number on the stack and grow the buffer for its exact length
+		TChar digits[StringNumber::MAX_DOUBLE_LENGTH];
+		append(StringView<TChar>(digits, formatter(value, digits)));
+	}
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String()
+{
+	initialize();
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String(size_t initialCapacity)
+{
+	initialize();
+
 	// Update capacity if required
-	if (initialCapacity > m_capacity)
+	if (initialCapacity > capacity())
 	{
 		// Set capacity to initialCapacity
-		m_buffer = new TChar[initialCapacity + 1];
-		m_capacity = initialCapacity;
+		TChar* buffer = allocateBuffer(initialCapacity);
+		setDynamicBuffer(buffer, initialCapacity);
+		setLength(0);
+		m_buffer[0] = static_cast<TChar>(0);
 	}
 }
 
-template<class TChar>
-String<TChar>::String(const TChar* other, size_t pos, size_t len, size_t initialCapacity)
-	: m_capacity(STRING_SSO_BUFFER_CAPACITY), m_length(0)
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String(const TChar* other, size_t pos, size_t len, size_t initialCapacity)
 {
+	initialize();
+
 	// Update capacity if required
-	if (initialCapacity > m_capacity)
+	if (initialCapacity > capacity())
 	{
 		// Set capacity to initialCapacity
-		m_buffer = new TChar[initialCapacity + 1];
-		m_capacity = initialCapacity;
+		TChar* buffer = allocateBuffer(initialCapacity);
+		setDynamicBuffer(buffer, initialCapacity);
 	}
 
 	// Copy source string
 	copy(other, pos, len);
 }
 
-template<class TChar>
-String<TChar>::String(const String<TChar>& other, size_t pos, size_t len, size_t initialCapacity)
-	: m_capacity(STRING_SSO_BUFFER_CAPACITY), m_length(0)
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String(const String<TChar, TAllocator>& other, size_t pos, size_t len, size_t initialCapacity)
 {
+	initialize();
+
 	// Update capacity if required
-	if (initialCapacity > m_capacity)
+	if (initialCapacity > capacity())
 	{
 		// Set capacity to initialCapacity
-		m_buffer = new TChar[initialCapacity + 1];
-		m_capacity = initialCapacity;
+		TChar* buffer = allocateBuffer(initialCapacity);
+		setDynamicBuffer(buffer, initialCapacity);
 	}
 
 	// Copy source string
 	copy(other, pos, len);
 }
 
-template<class TChar>
-String<TChar>::~String()
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String(const StringView<TChar>& other, size_t initialCapacity)
+{
+	initialize();
+
+	// Update capacity if required
+	if (initialCapacity > capacity())
+	{
+		// Set capacity to initialCapacity
+		TChar* buffer = allocateBuffer(initialCapacity);
+		setDynamicBuffer(buffer, initialCapacity);
+	}
+
+	// Copy source string
+	copy(other);
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::String(String<TChar, TAllocator>&& other) noexcept
+{
+	initialize();
+	steal(other);
+}
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+String<TChar, TAllocator>::String(const StringConcat<TChar, TPieces...>& other)
 {
+	initialize();
+	copy(other);
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>::~String()
+{
+#if STRING_STATS
+	StringStats::recordDestruction(length(), capacity(), usesDynamicBuffer());
+#endif
 	if (usesDynamicBuffer())
 	{
-		delete[] m_buffer;
+		deallocateBuffer();
 	}
 }
 
-template<class TChar>
-void String<TChar>::copy(const TChar* source, size_t pos, size_t len)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::copy(const TChar* source, size_t pos, size_t len)
 {
 	source += pos;
 	if (!len)
@@ -159,95 +392,243 @@ void String<TChar>::copy(const TChar* source, size_t pos, size_t len)
 		len = cstr_length(source);
 	}
 
-	if (len > m_capacity)
+	if (len > capacity() || isShared())
 	{
-		// DO NOT use setCapacity here! No need to copy the existing string
+		// DO NOT use setCapacity here! No need to copy the existing string, which may be shared as well. Source may
+		// point into a shared buffer, so it is copied before releasing the buffer
+		size_t newCapacity = calcNewCapacity(len);
+		TChar* newBuffer = allocateBuffer(newCapacity);
+		cstr_copy(newBuffer, source, 0, len);
 		if (usesDynamicBuffer())
 		{
-			delete[] m_buffer;
+			deallocateBuffer();
 		}
-		size_t newCapacity = calcNewCapacity(len);
-		m_buffer = new TChar[newCapacity + 1];
-		m_capacity = newCapacity;
+		setDynamicBuffer(newBuffer, newCapacity);
 	}
-
-	// Copy source string to the buffer and update the length
-	cstr_copy(data(), source, 0, len);
-	m_length = len;
+	else
+	{
+		// Copy source string to the buffer
+		cstr_copy(data(), source, 0, len);
+	}
+	setLength(len);
 }
 
-template<class TChar>
-void String<TChar>::copy(const String<TChar>& source, size_t pos, size_t len)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::copy(const String<TChar, TAllocator>& source, size_t pos, size_t len)
 {
 	if (!len)
 	{
 		len = source.length() - pos;
 	}
+
+#if STRING_SHARED_BUFFER
+	if (SHARED_BUFFERS && !pos && len == source.length() && source.usesDynamicBuffer() && !usesDynamicBuffer())
+	{
+		// Share the buffer of source instead of copying it
+		source.references().fetch_add(1, std::memory_order_relaxed);
+		setDynamicBuffer(source.m_buffer, source.capacity());
+		storeLength(len);
+		return;
+	}
+#endif
 	copy(source.c_str(), pos, len);
 }
 
-template<class TChar>
-const TChar* String<TChar>::c_str() const
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::copy(const StringView<TChar>& source)
+{
+	if (!source.length())
+	{
+		// A length of 0 would copy a whole c-string, but views are not zero-terminated
+		data()[0] = static_cast<TChar>(0);
+		setLength(0);
+		return;
+	}
+
+	const TChar* buffer = c_str();
+	if (source.data() >= buffer && source.data() <= buffer + length())
+	{
+		// The view is a part of the string of the instance, which fits into the buffer. Detaching a shared buffer
+		// copies the string, so the view is located by its offset
+		size_t offset = source.data() - buffer;
+		TChar* dst = data();
+		memmove(dst, dst + offset, source.length() * sizeof(TChar));
+		dst[source.length()] = static_cast<TChar>(0);
+		setLength(source.length());
+		return;
+	}
+	copy(source.data(), 0, source.length());
+}
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+void String<TChar, TAllocator>::copy(const StringConcat<TChar, TPieces...>& source)
+{
+	const TChar* buffer = c_str();
+	if (source.overlaps(buffer, buffer + capacity()))
+	{
+		// A piece points into the buffer, build the string in a new instance
+		String<TChar, TAllocator> result(source);
+		release();
+		steal(result);
+		return;
+	}
+
+	// Reuse the buffer if the combined length fits, otherwise allocate one of exactly the combined length
+	size_t length = source.length();
+	if (length > capacity() || isShared())
+	{
+		release();
+		if (length > capacity())
+		{
+			size_t capacity = length;
+			TChar* newBuffer = allocateBuffer(capacity);
+			setDynamicBuffer(newBuffer, capacity);
+		}
+	}
+
+	// Copy the pieces and terminate the string
+	*source.write(data()) = static_cast<TChar>(0);
+	storeLength(length);
+}
+
+template<class TChar, class TAllocator>
+const TChar* String<TChar, TAllocator>::c_str() const
 {
 	return usesDynamicBuffer() ? m_buffer : m_ssoBuffer;
 }
 
-template<class TChar>
-TChar* String<TChar>::data()
+template<class TChar, class TAllocator>
+TChar* String<TChar, TAllocator>::data()
 {
+	detach();
 	return usesDynamicBuffer() ? m_buffer : m_ssoBuffer;
 }
 
-template<class TChar>
-size_t String<TChar>::length() const
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::length() const
 {
+#if STRING_COMPACT_LAYOUT
+	return usesDynamicBuffer() ? m_words[1] : SSO_CAPACITY - static_cast<size_t>(m_ssoBuffer[SSO_CAPACITY]);
+#else
 	return m_length;
+#endif
 }
 
-template<class TChar>
-size_t String<TChar>::calcLength()
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::calcLength()
 {
-	m_length = cstr_length(c_str());
-	return m_length;
+	size_t length = cstr_length(c_str());
+	setLength(length);
+	return length;
 }
 
-template<class TChar>
-void String<TChar>::setLength(size_t length)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::setLength(size_t length)
 {
+	detach();
+	storeLength(length);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::storeLength(size_t length)
+{
+#if STRING_COMPACT_LAYOUT
+	if (usesDynamicBuffer())
+	{
+		m_words[1] = length;
+	}
+	else
+	{
+		m_ssoBuffer[SSO_CAPACITY] = static_cast<TChar>(SSO_CAPACITY - length);
+	}
+#else
 	m_length = length;
+#endif
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::isShared() const
+{
+#if STRING_SHARED_BUFFER
+	return SHARED_BUFFERS && usesDynamicBuffer() && references().load(std::memory_order_acquire) > 1;
+#else
+	return false;
+#endif
 }
 
-template<class TChar>
-size_t String<TChar>::capacity() const
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::capacity() const
 {
+#if STRING_COMPACT_LAYOUT
+	return usesDynamicBuffer() ? unpackCapacity(m_words[STORAGE_WORDS - 1]) : static_cast<size_t>(SSO_CAPACITY);
+#else
 	return m_capacity;
+#endif
 }
 
-template<class TChar>
-void String<TChar>::setCapacity(size_t minLength)
+template<class TChar, class TAllocator>
+constexpr size_t String<TChar, TAllocator>::ssoCapacity()
 {
-	if (minLength > m_capacity)
+#if STRING_COMPACT_LAYOUT
+	return SSO_CAPACITY;
+#else
+	return STRING_SSO_BUFFER_CAPACITY;
+#endif
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::setCapacity(size_t minLength)
+{
+	if (minLength > capacity())
 	{
+		size_t length = this->length();
 		size_t newCapacity = calcNewCapacity(minLength);
-		TChar* newBuffer = new TChar[newCapacity + 1];
-		if (m_length)
+		TChar* newBuffer = allocateBuffer(newCapacity);
+		if (length)
 		{
 			// Copy the string to the new buffer
-			cstr_copy(newBuffer, c_str(), 0, m_length);
+			cstr_copy(newBuffer, c_str(), 0, length);
+		}
+		else
+		{
+			newBuffer[0] = static_cast<TChar>(0);
 		}
 		if (usesDynamicBuffer())
 		{
+#if STRING_STATS
+			StringStats::recordReallocation(length * sizeof(TChar));
+#endif
 			// Deallocate old buffer
-			delete[] m_buffer;
+			deallocateBuffer();
 		}
-		// Update m_buffer and m_capacity member variables
-		m_buffer = newBuffer;
-		m_capacity = newCapacity;
+		// Switch to the new buffer and restore the length
+		setDynamicBuffer(newBuffer, newCapacity);
+		setLength(length);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::reserve(size_t minLength)
+{
+	if (minLength > capacity())
+	{
+		reallocate(minLength);
 	}
 }
 
-template<class TChar>
-void String<TChar>::append(const TChar* other, size_t pos, size_t len)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::shrinkToFit()
+{
+	size_t length = this->length();
+	if (usesDynamicBuffer() && !isShared() && (length <= ssoCapacity() || roundCapacity(length) < capacity()))
+	{
+		reallocate(length);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::append(const TChar* other, size_t pos, size_t len)
 {
 	if (other)
 	{
@@ -257,17 +638,28 @@ void String<TChar>::append(const TChar* other, size_t pos, size_t len)
 			len = cstr_length(other);
 		}
 
-		// Update capacity if required
-		setCapacity(m_length + len);
+		// Update capacity if required, other may point into the buffer of the instance
+		size_t length = this->length();
+		const TChar* buffer = c_str();
+		if (other >= buffer && other <= buffer + length)
+		{
+			size_t offset = other - buffer;
+			setCapacity(length + len);
+			other = data() + offset;
+		}
+		else
+		{
+			setCapacity(length + len);
+		}
 
 		// Copy other to the end of the current string
-		cstr_copy(data() + m_length, other, 0, len);
-		m_length += len;
+		cstr_copy(data() + length, other, 0, len);
+		setLength(length + len);
 	}
 }
 
-template<class TChar>
-void String<TChar>::append(const String<TChar>& other, size_t pos, size_t len)
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::append(const String<TChar, TAllocator>& other, size_t pos, size_t len)
 {
 	if (!len)
 	{
@@ -276,21 +668,569 @@ void String<TChar>::append(const String<TChar>& other, size_t pos, size_t len)
 	append(other.c_str(), pos, len);
 }
 
-template<class TChar>
-int String<TChar>::compare(const TChar* other) const
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::append(String<TChar, TAllocator>&& other)
+{
+	if (this == &other)
+	{
+		append(static_cast<const String<TChar, TAllocator>&>(other));
+		return;
+	}
+
+	size_t length = this->length();
+	size_t newLength = length + other.length();
+	if (newLength > capacity() && other.usesDynamicBuffer() && newLength <= other.capacity())
+	{
+		// The buffer of other is large enough, prepend the string of the instance and take it over
+		other.prepend(c_str(), 0, length);
+		release();
+		steal(other);
+	}
+	else if (!length && other.usesDynamicBuffer())
+	{
+		// Nothing to keep, take over the buffer of other
+		release();
+		steal(other);
+	}
+	else
+	{
+		append(other.c_str(), 0, other.length());
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::append(const StringView<TChar>& other)
+{
+	if (other.length())
+	{
+		append(other.data(), 0, other.length());
+	}
+}
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+void String<TChar, TAllocator>::append(const StringConcat<TChar, TPieces...>& other)
+{
+	size_t length = this->length();
+	size_t newLength = length + other.length();
+	if (newLength > capacity() || isShared())
+	{
+		// Copy the string and the pieces to a new buffer before releasing the old one, pieces may point into it
+		size_t newCapacity = calcNewCapacity(newLength);
+		TChar* newBuffer = allocateBuffer(newCapacity);
+		memcpy(newBuffer, c_str(), length * sizeof(TChar));
+		*other.write(newBuffer + length) = static_cast<TChar>(0);
+		if (usesDynamicBuffer())
+		{
+#if STRING_STATS
+			if (newLength > capacity())
+			{
+				StringStats::recordReallocation(length * sizeof(TChar));
+			}
+#endif
+			deallocateBuffer();
+		}
+		setDynamicBuffer(newBuffer, newCapacity);
+	}
+	else
+	{
+		// Copy the pieces behind the string, pieces pointing into it are not overwritten
+		*other.write(data() + length) = static_cast<TChar>(0);
+	}
+	storeLength(newLength);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::appendInt(int64_t value)
+{
+	appendNumber(value, StringNumber::MAX_INTEGER_LENGTH, &StringNumber::formatInt<TChar>);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::appendUInt(uint64_t value)
+{
+	appendNumber(value, StringNumber::MAX_INTEGER_LENGTH, &StringNumber::formatUInt<TChar>);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::appendDouble(double value)
+{
+	appendNumber(value, StringNumber::MAX_DOUBLE_LENGTH, &StringNumber::formatDouble<TChar>);
+}
+
+template<class TChar, class TAllocator>
+template<class... TArgs>
+bool String<TChar, TAllocator>::appendFormat(const StringView<TChar>& pattern, const TArgs&... arguments)
+{
+	StringFormat<TChar, TArgs...> formatted(pattern, arguments...);
+	if (!formatted.isValid())
+	{
+		return false;
+	}
+	append(StringConcat<TChar, StringFormat<TChar, TArgs...> >(formatted));
+	return true;
+}
+
+template<class TChar, class TAllocator>
+template<class... TArgs>
+bool String<TChar, TAllocator>::format(const StringView<TChar>& pattern, const TArgs&... arguments)
+{
+	StringFormat<TChar, TArgs...> formatted(pattern, arguments...);
+	if (!formatted.isValid())
+	{
+		return false;
+	}
+	copy(StringConcat<TChar, StringFormat<TChar, TArgs...> >(formatted));
+	return true;
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::prepend(const TChar* other, size_t pos, size_t len)
+{
+	if (other)
+	{
+		other += pos;
+		if (!len)
+		{
+			len = cstr_length(other);
+		}
+		if (overlaps(StringView<TChar>(other, len)))
+		{
+			// The buffer is moved or reallocated below, so a part of the string is copied first
+			String<TChar, TAllocator> copy(StringView<TChar>(other, len));
+			prepend(copy.c_str(), 0, len);
+			return;
+		}
+
+		// Update capacity if required
+		size_t length = this->length();
+		setCapacity(length + len);
+
+		// Move the current string behind the prepended part and copy other to the front
+		TChar* buffer = data();
+		memmove(buffer + len, buffer, length * sizeof(TChar));
+		memcpy(buffer, other, len * sizeof(TChar));
+		buffer[length + len] = static_cast<TChar>(0);
+		setLength(length + len);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::prepend(const String<TChar, TAllocator>& other, size_t pos, size_t len)
+{
+	if (!len)
+	{
+		len = other.length() - pos;
+	}
+	prepend(other.c_str(), pos, len);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::insert(size_t pos, const StringView<TChar>& str)
+{
+	replace(pos, 0, str);
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::erase(size_t pos, size_t len)
+{
+	replace(pos, len, StringView<TChar>());
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::replace(size_t pos, size_t len, const StringView<TChar>& str)
+{
+	if (overlaps(str))
+	{
+		// The characters are moved below, so a view into the string is copied first
+		String<TChar, TAllocator> copy(str);
+		replace(pos, len, StringView<TChar>(copy));
+		return;
+	}
+
+	size_t length = this->length();
+	pos = pos < length ? pos : length;
+	len = len < length - pos ? len : length - pos;
+	size_t rest = length - pos - len;
+	size_t newLength = length - len + str.length();
+	if (newLength > capacity() || isShared())
+	{
+		// Copy the parts to a new buffer
+		size_t newCapacity = newLength > capacity() ? calcNewCapacity(newLength) : capacity();
+		TChar* newBuffer = allocateBuffer(newCapacity);
+		const TChar* buffer = c_str();
+		memcpy(newBuffer, buffer, pos * sizeof(TChar));
+		if (str.length())
+		{
+			memcpy(newBuffer + pos, str.data(), str.length() * sizeof(TChar));
+		}
+		memcpy(newBuffer + pos + str.length(), buffer + pos + len, (rest + 1) * sizeof(TChar));
+		if (usesDynamicBuffer())
+		{
+#if STRING_STATS
+			if (newLength > capacity())
+			{
+				StringStats::recordReallocation((length - len) * sizeof(TChar));
+			}
+#endif
+			deallocateBuffer();
+		}
+		setDynamicBuffer(newBuffer, newCapacity);
+	}
+	else
+	{
+		// Move the rest including the terminating 0 behind the inserted characters
+		TChar* buffer = data();
+		memmove(buffer + pos + str.length(), buffer + pos + len, (rest + 1) * sizeof(TChar));
+		if (str.length())
+		{
+			memcpy(buffer + pos, str.data(), str.length() * sizeof(TChar));
+		}
+	}
+	storeLength(newLength);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::replace(const StringView<TChar>& needle, const StringView<TChar>& replacement, size_t pos)
+{
+	size_t found = needle.length() ? find(needle, pos) : NOT_FOUND;
+	if (found != NOT_FOUND)
+	{
+		replace(found, needle.length(), replacement);
+	}
+	return found;
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::replaceAll(const StringView<TChar>& needle, const StringView<TChar>& replacement)
+{
+	if (overlaps(needle) || overlaps(replacement))
+	{
+		// The string is rewritten below, so views into it are copied first
+		String<TChar, TAllocator> needleCopy(needle);
+		String<TChar, TAllocator> replacementCopy(replacement);
+		return replaceAll(StringView<TChar>(needleCopy), StringView<TChar>(replacementCopy));
+	}
+
+	size_t length = this->length();
+	Searcher<TChar> searcher(needle);
+	size_t found = needle.length() ? searcher.find(StringView<TChar>(*this)) : NOT_FOUND;
+	if (NOT_FOUND == found)
+	{
+		return 0;
+	}
+
+	size_t count = 0;
+	size_t read = 0;
+	size_t write = 0;
+	if (replacement.length() <= needle.length())
+	{
+		// The string does not grow, so it is compacted from left to right
+		TChar* buffer = data();
+		StringView<TChar> source(buffer, length);
+		for (; found != NOT_FOUND; found = searcher.find(source, read))
+		{
+			memmove(buffer + write, buffer + read, (found - read) * sizeof(TChar));
+			write += found - read;
+			if (replacement.length())
+			{
+				memcpy(buffer + write, replacement.data(), replacement.length() * sizeof(TChar));
+			}
+			write += replacement.length();
+			read = found + needle.length();
+			count++;
+		}
+		memmove(buffer + write, buffer + read, (length - read + 1) * sizeof(TChar));
+		storeLength(write + length - read);
+		return count;
+	}
+
+	// The string grows, the count of occurrences gives its final length
+	count = searcher.count(StringView<TChar>(*this));
+	size_t newLength = length + count * (replacement.length() - needle.length());
+	size_t newCapacity = capacity();
+	TChar* newBuffer = 0;
+	TChar* target;
+	const TChar* source;
+	if (newLength > newCapacity || isShared())
+	{
+		newCapacity = newLength > newCapacity ? calcNewCapacity(newLength) : newCapacity;
+		newBuffer = allocateBuffer(newCapacity);
+		target = newBuffer;
+		source = c_str();
+	}
+	else
+	{
+		// Move the string to the end of the buffer, the rewritten string never overtakes the unread characters
+		target = data();
+		memmove(target + newLength - length, target, length * sizeof(TChar));
+		source = target + newLength - length;
+	}
+
+	StringView<TChar> view(source, length);
+	for (found = searcher.find(view); found != NOT_FOUND; found = searcher.find(view, read))
+	{
+		memmove(target + write, source + read, (found - read) * sizeof(TChar));
+		write += found - read;
+		memcpy(target + write, replacement.data(), replacement.length() * sizeof(TChar));
+		write += replacement.length();
+		read = found + needle.length();
+	}
+	memmove(target + write, source + read, (length - read) * sizeof(TChar));
+	target[newLength] = static_cast<TChar>(0);
+	if (newBuffer)
+	{
+		if (usesDynamicBuffer())
+		{
+#if STRING_STATS
+			if (newLength > capacity())
+			{
+				StringStats::recordReallocation((length - count * needle.length()) * sizeof(TChar));
+			}
+#endif
+			deallocateBuffer();
+		}
+		setDynamicBuffer(newBuffer, newCapacity);
+	}
+	storeLength(newLength);
+	return count;
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::trim()
+{
+	// Space, tab, line feed, vertical tab, form feed and carriage return
+	const TChar* buffer = c_str();
+	size_t length = this->length();
+	size_t begin = 0;
+	while (begin < length && (' ' == buffer[begin] || (buffer[begin] >= '\t' && buffer[begin] <= '\r')))
+	{
+		begin++;
+	}
+	size_t end = length;
+	while (end > begin && (' ' == buffer[end - 1] || (buffer[end - 1] >= '\t' && buffer[end - 1] <= '\r')))
+	{
+		end--;
+	}
+	if (begin || end < length)
+	{
+		TChar* target = data();
+		memmove(target, target + begin, (end - begin) * sizeof(TChar));
+		target[end - begin] = static_cast<TChar>(0);
+		storeLength(end - begin);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::toLower()
+{
+	size_t length = this->length();
+	if (length)
+	{
+		StringKernels<TChar>::toLower(data(), length);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::toUpper()
+{
+	size_t length = this->length();
+	if (length)
+	{
+		StringKernels<TChar>::toUpper(data(), length);
+	}
+}
+
+template<class TChar, class TAllocator>
+void String<TChar, TAllocator>::swap(String<TChar, TAllocator>& other) noexcept
+{
+	if (this != &other)
+	{
+		String<TChar, TAllocator> temp(std::move(other));
+		other.steal(*this);
+		steal(temp);
+	}
+}
+
+template<class TChar, class TAllocator>
+int String<TChar, TAllocator>::compare(const TChar* other) const
 {
 	return cstr_compare(c_str(), other);
 }
 
-template<class TChar>
-String<TChar>& String<TChar>::operator=(const TChar* other)
+template<class TChar, class TAllocator>
+int String<TChar, TAllocator>::compare(const StringView<TChar>& other) const
+{
+	return StringView<TChar>(*this).compare(other);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::find(const StringView<TChar>& needle, size_t pos) const
+{
+	return StringView<TChar>(*this).find(needle, pos);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::find(TChar c, size_t pos) const
+{
+	return StringView<TChar>(*this).find(c, pos);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::rfind(const StringView<TChar>& needle, size_t pos) const
+{
+	return StringView<TChar>(*this).rfind(needle, pos);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::findFirstOf(const StringView<TChar>& set, size_t pos) const
+{
+	return StringView<TChar>(*this).findFirstOf(set, pos);
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::contains(const StringView<TChar>& needle) const
+{
+	return StringView<TChar>(*this).contains(needle);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::count(const StringView<TChar>& needle) const
+{
+	return StringView<TChar>(*this).count(needle);
+}
+
+template<class TChar, class TAllocator>
+size_t String<TChar, TAllocator>::hash() const
+{
+	return StringView<TChar>(*this).hash();
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::parseInt(int64_t& value) const
+{
+	return StringNumber::parseInt(c_str(), length(), value);
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::parseUInt(uint64_t& value) const
+{
+	return StringNumber::parseUInt(c_str(), length(), value);
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::parseDouble(double& value) const
+{
+	return StringNumber::parseDouble(c_str(), length(), value);
+}
+
+#if STRING_POSIX_IO
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::readFile(const char* path)
+{
+	int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		release();
+		return false;
+	}
+
+	// Allocate the buffer once for the size of a regular file, other files have no known size
+	struct stat status;
+	size_t size = 0;
+	if (0 == fstat(fd, &status) && S_ISREG(status.st_mode))
+	{
+		size = static_cast<size_t>(status.st_size) / sizeof(TChar);
+	}
+	if (size > capacity() || isShared())
+	{
+		release();
+		if (size > capacity())
+		{
+			TChar* newBuffer = allocateBuffer(size);
+			setDynamicBuffer(newBuffer, size);
+		}
+	}
+
+	// Read until the end of the file, which may have grown since fstat
+	TChar* buffer = data();
+	size_t bytes = 0;
+	bool result = true;
+	char probe[256];
+	for (;;)
+	{
+		// Once the buffer is full, check for the end of the file before growing it
+		bool full = bytes == capacity() * sizeof(TChar);
+		char* target = full ? probe : reinterpret_cast<char*>(buffer) + bytes;
+		ssize_t count = ::read(fd, target, full ? sizeof(probe) : capacity() * sizeof(TChar) - bytes);
+		if (count > 0 && full)
+		{
+			// The buffer only contains complete characters here, which are kept while growing it
+			storeLength(bytes / sizeof(TChar));
+			setCapacity(capacity() + sizeof(probe));
+			buffer = data();
+			memcpy(reinterpret_cast<char*>(buffer) + bytes, probe, static_cast<size_t>(count));
+			bytes += static_cast<size_t>(count);
+		}
+		else if (count > 0)
+		{
+			bytes += static_cast<size_t>(count);
+		}
+		else if (count == 0)
+		{
+			break;
+		}
+		else if (errno != EINTR)
+		{
+			result = false;
+			break;
+		}
+	}
+	::close(fd);
+
+	size_t length = result ? bytes / sizeof(TChar) : 0;
+	buffer[length] = static_cast<TChar>(0);
+	storeLength(length);
+	return result;
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::writeTo(int fd) const
+{
+	const char* position = reinterpret_cast<const char*>(c_str());
+	const char* end = position + length() * sizeof(TChar);
+	while (position != end)
+	{
+		ssize_t count = ::write(fd, position, static_cast<size_t>(end - position));
+		if (count >= 0)
+		{
+			position += count;
+		}
+		else if (errno != EINTR)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+#endif
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+String<TChar, TAllocator> String<TChar, TAllocator>::concat(const TPieces&... pieces)
+{
+	return String<TChar, TAllocator>(StringConcat<TChar, TPieces...>(pieces...));
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator=(const TChar* other)
 {
 	copy(other);
 	return *this;
 }
 
-template<class TChar>
-String<TChar>& String<TChar>::operator=(const String<TChar>& other)
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator=(const String<TChar, TAllocator>& other)
 {
 	if (this != &other)
 	{
@@ -299,56 +1239,143 @@ String<TChar>& String<TChar>::operator=(const String<TChar>& other)
 	return *this;
 }
 
-template<class TChar>
-String<TChar>& String<TChar>::operator+=(const TChar* other)
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator=(String<TChar, TAllocator>&& other) noexcept
+{
+	if (this != &other)
+	{
+		release();
+		steal(other);
+	}
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator=(const StringConcat<TChar, TPieces...>& other)
+{
+	copy(other);
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator+=(const TChar* other)
 {
 	append(other);
 	return *this;
 }
 
-template<class TChar>
-String<TChar>& String<TChar>::operator+=(const String<TChar>& other)
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator+=(const String<TChar, TAllocator>& other)
+{
+	append(other);
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator+=(String<TChar, TAllocator>&& other)
+{
+	append(std::move(other));
+	return *this;
+}
+
+template<class TChar, class TAllocator>
+template<class... TPieces>
+String<TChar, TAllocator>& String<TChar, TAllocator>::operator+=(const StringConcat<TChar, TPieces...>& other)
 {
 	append(other);
 	return *this;
 }
 
-template<class TChar>
-bool String<TChar>::operator==(const TChar* other) const
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator==(const TChar* other) const
 {
 	return 0 == compare(other);
 }
 
-template<class TChar>
-bool String<TChar>::operator==(const String<TChar>& other) const
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator==(const String<TChar, TAllocator>& other) const
 {
 	if (this == &other)
 	{
 		return true;
 	}
-	if (other.length() != m_length)
+	if (other.length() != length())
 	{
 		return false;
 	}
-	return 0 == compare(other.c_str());
+	// The lengths are known, compare the buffers without searching for the terminating 0
+	return StringKernels<TChar>::equal(c_str(), other.c_str(), length());
 }
 
-template<class TChar>
-bool String<TChar>::operator!=(const TChar* other) const
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator!=(const TChar* other) const
 {
 	return 0 != compare(other);
 }
 
-template<class TChar>
-bool String<TChar>::operator!=(const String<TChar>& other) const
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator!=(const String<TChar, TAllocator>& other) const
 {
 	if (this == &other)
 	{
 		return false;
 	}
-	if (other.length() != m_length)
+	if (other.length() != length())
 	{
 		return true;
 	}
-	return 0 != compare(other.c_str());
+	return !StringKernels<TChar>::equal(c_str(), other.c_str(), length());
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator<(const String<TChar, TAllocator>& other) const
+{
+	return compare(other) < 0;
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator<=(const String<TChar, TAllocator>& other) const
+{
+	return compare(other) <= 0;
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator>(const String<TChar, TAllocator>& other) const
+{
+	return compare(other) > 0;
+}
+
+template<class TChar, class TAllocator>
+bool String<TChar, TAllocator>::operator>=(const String<TChar, TAllocator>& other) const
+{
+	return compare(other) >= 0;
+}
+
+
+template<class TChar, class TAllocator>
+void swap(String<TChar, TAllocator>& lhs, String<TChar, TAllocator>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(const String<TChar, TAllocator>& lhs, String<TChar, TAllocator>&& rhs)
+{
+	rhs.prepend(lhs);
+	return std::move(rhs);
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(String<TChar, TAllocator>&& lhs, String<TChar, TAllocator>&& rhs)
+{
+	lhs.append(std::move(rhs));
+	return std::move(lhs);
+}
+
+template<class TChar, class TAllocator>
+String<TChar, TAllocator> operator+(const TChar* lhs, String<TChar, TAllocator>&& rhs)
+{
+	rhs.prepend(lhs);
+	return std::move(rhs);
 }
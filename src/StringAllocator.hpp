@@ -0,0 +1,405 @@
+/**
+ * @file StringAllocator.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGALLOCATOR_HPP
+#define STRINGALLOCATOR_HPP
+
+
+// For the lists of blocks freed by other threads
+#include <atomic>
+// For size_t
+#include <cstddef>
+// For uintptr_t
+#include <cstdint>
+// For std::bad_alloc
+#include <new>
+
+
+// Size of the blocks the arena allocates from the heap in bytes
+#define STRING_ARENA_BLOCK_SIZE 65536
+// Size of the slabs the pool allocator carves its blocks from in bytes
+#define STRING_POOL_SLAB_SIZE 65536
+
+
+/**
+ * @class StringAllocator
+ * Default allocator of the class String using new[] and delete[]. An allocator of the class String provides the
+ * static methods allocate, deallocate and roundCapacity with the signatures below. Allocators are stateless, so they
+ * do not increase the size of a String.
+ */
+template<class TChar>
+class StringAllocator
+{
+public:
+	/**
+	 * Allocates a buffer.
+	 * @param	count	Count of characters to allocate including the terminating 0
+	 * @return		Allocated buffer
+	 */
+	static TChar* allocate(size_t count);
+
+	/**
+	 * Deallocates a buffer returned by allocate.
+	 * @param	buffer	Buffer to deallocate
+	 * @param	count	Count of characters passed to allocate for the buffer
+	 */
+	static void deallocate(TChar* buffer, size_t count);
+
+	/**
+	 * Rounds a capacity up to the capacity the allocator actually provides for it, so a String can use the slack of
+	 * the allocated block.
+	 * @param	capacity	Requested capacity in characters excluding the terminating 0
+	 * @return			Usable capacity in characters excluding the terminating 0
+	 */
+	static size_t roundCapacity(size_t capacity);
+};
+
+
+/**
+ * @class StringPoolAllocator
+ * Allocator of the class String using thread-local free lists of power-of-two size classes from 32 bytes to 4 KB.
+ * Allocating and deallocating a block takes no lock and no call into the heap unless a free list runs empty, which
+ * removes the allocator contention of multi-threaded parsers. Every slab belongs to the thread which allocated it.
+ * Blocks freed by another thread are pushed onto a lock-free list of their slab, and the owning thread takes them back
+ * before it allocates a new slab, so a producer handing its strings to a consumer keeps reusing the same slabs. When a
+ * thread exits, its slabs are returned to the heap as soon as all their blocks are freed. Larger buffers are allocated
+ * using new[].
+ */
+template<class TChar>
+class StringPoolAllocator
+{
+private:
+	enum
+	{
+		// Size of the smallest size class in bytes
+		MIN_BLOCK_SIZE = 32,
+		// Count of size classes
+		SIZE_CLASSES = 8,
+		// Size of the largest size class in bytes
+		MAX_BLOCK_SIZE = MIN_BLOCK_SIZE << (SIZE_CLASSES - 1)
+	};
+
+	static_assert((STRING_POOL_SLAB_SIZE & (STRING_POOL_SLAB_SIZE - 1)) == 0 && STRING_POOL_SLAB_SIZE >= 2 * MAX_BLOCK_SIZE,
+		"STRING_POOL_SLAB_SIZE must be a power of two holding at least two blocks of the largest size class");
+
+	// Block in a free list
+	struct FreeBlock
+	{
+		// Next free block of the same size class
+		FreeBlock* next;
+	};
+
+	struct Heap;
+
+	/**
+	 * @struct Slab
+	 * Header at the start of a slab, which is aligned to STRING_POOL_SLAB_SIZE so a block finds it by its address.
+	 */
+	struct Slab
+	{
+		// Heap of the owning thread, 0 once the thread exited
+		std::atomic<Heap*> owner;
+		// Blocks freed by other threads than the owner, ORPHANED once the owner exited
+		std::atomic<uintptr_t> remoteFree;
+		// Blocks still in use after the owner exited, reaches 0 exactly once when the last one is freed
+		std::atomic<ptrdiff_t> orphanedBlocks;
+		// Blocks handed out and not yet returned to the owner, only used by the owner
+		size_t usedBlocks;
+		// Next slab of the same size class of the owner
+		Slab* next;
+		// Memory allocated for the slab, which starts at or before the header
+		void* memory;
+	};
+
+	/**
+	 * @struct Heap
+	 * Free lists and slabs of a thread.
+	 */
+	struct Heap
+	{
+		// First free block of every size class
+		FreeBlock* freeLists[SIZE_CLASSES];
+		// Slabs of every size class
+		Slab* slabs[SIZE_CLASSES];
+	};
+
+	/**
+	 * @struct Reaper
+	 * Thread-local object releasing the heap of its thread when the thread exits.
+	 */
+	struct Reaper
+	{
+		/**
+		 * Destructor releasing the heap of the exiting thread.
+		 */
+		~Reaper();
+	};
+
+	// Value of Slab::remoteFree after the owner exited
+	static const uintptr_t ORPHANED = 1;
+
+	/**
+	 * Returns the heap of the calling thread.
+	 * @return	Reference to the pointer to the heap, 0 before the first allocation and after the thread exited
+	 */
+	static Heap*& currentHeap();
+
+	/**
+	 * Returns the heap of the calling thread, creating it on first use.
+	 * @return	Heap of the calling thread
+	 */
+	static Heap& ownHeap();
+
+	/**
+	 * Returns the counter of allocated slabs.
+	 * @return	Reference to the counter
+	 */
+	static std::atomic<size_t>& slabCounter();
+
+	/**
+	 * Calculates the size class of a block.
+	 * @param	size	Size of the block in bytes, must not exceed MAX_BLOCK_SIZE
+	 * @return		Size class of the block
+	 */
+	static size_t sizeClass(size_t size);
+
+	/**
+	 * Returns the slab a block was carved from.
+	 * @param	block	Block of a slab
+	 * @return		Slab of the block
+	 */
+	static Slab* slabOf(const void* block);
+
+	/**
+	 * Takes back the blocks of the slabs of a size class freed by other threads.
+	 * @param	heap		Heap of the calling thread
+	 * @param	sizeClass	Size class
+	 * @return			Whether any block was taken back
+	 */
+	static bool reclaim(Heap& heap, size_t sizeClass);
+
+	/**
+	 * Allocates a new slab and adds its blocks to the free list of a size class of the calling thread.
+	 * @param	heap		Heap of the calling thread
+	 * @param	sizeClass	Size class to refill
+	 */
+	static void refill(Heap& heap, size_t sizeClass);
+
+	/**
+	 * Hands a slab of an exiting thread over to the threads freeing its remaining blocks.
+	 * @param	slab	Slab of the exiting thread
+	 */
+	static void orphan(Slab* slab);
+
+	/**
+	 * Frees a slab on the heap.
+	 * @param	slab	Slab without used blocks
+	 */
+	static void freeSlab(Slab* slab);
+
+public:
+	/**
+	 * Allocates a buffer.
+	 * @param	count	Count of characters to allocate including the terminating 0
+	 * @return		Allocated buffer
+	 */
+	static TChar* allocate(size_t count);
+
+	/**
+	 * Returns a buffer to the free list of the calling thread if it owns the slab of the buffer, otherwise to the slab.
+	 * @param	buffer	Buffer to deallocate
+	 * @param	count	Count of characters passed to allocate for the buffer
+	 */
+	static void deallocate(TChar* buffer, size_t count);
+
+	/**
+	 * Rounds a capacity up to the size class it is allocated from.
+	 * @param	capacity	Requested capacity in characters excluding the terminating 0
+	 * @return			Usable capacity in characters excluding the terminating 0
+	 */
+	static size_t roundCapacity(size_t capacity);
+
+	/**
+	 * Returns the count of slabs of all threads not yet returned to the heap.
+	 * @return	Count of slabs
+	 */
+	static size_t slabs();
+};
+
+
+/**
+ * @class StringArena
+ * Monotonic arena handing out memory by bumping a pointer through large blocks. Single allocations are never freed,
+ * reset frees everything at once. An arena is activated for the calling thread using StringArena::Scope, Strings using
+ * StringArenaAllocator then allocate from it. An arena must only be used by one thread. Strings allocated from an
+ * arena must be destroyed before the arena is reset or destroyed, a String outliving it points to freed memory.
+ */
+class StringArena
+{
+private:
+	// Header of a block allocated from the heap
+	struct Block
+	{
+		// Previously allocated block
+		Block* previous;
+		// Size of the block in bytes including the header
+		size_t size;
+	};
+
+	// Most recently allocated block
+	Block* m_block;
+	// Next free byte in the most recently allocated block
+	char* m_current;
+	// End of the most recently allocated block
+	char* m_end;
+	// Size of the blocks to allocate from the heap in bytes
+	size_t m_blockSize;
+	// Count of bytes handed out since the last reset
+	size_t m_usedBytes;
+
+	/**
+	 * Returns the arena active for the calling thread.
+	 * @return	Reference to the pointer to the active arena, 0 if no arena is active
+	 */
+	static StringArena*& activeArena();
+
+	/**
+	 * Allocates a new block large enough for an allocation.
+	 * @param	size	Size of the allocation in bytes
+	 */
+	void grow(size_t size);
+
+	StringArena(const StringArena&);
+	StringArena& operator=(const StringArena&);
+
+public:
+	/**
+	 * @class Scope
+	 * Activates an arena for the calling thread for the lifetime of the instance. Scopes can be nested, the
+	 * previously active arena is restored on destruction.
+	 */
+	class Scope
+	{
+	private:
+		// Arena active before the scope was entered
+		StringArena* m_previous;
+
+		Scope(const Scope&);
+		Scope& operator=(const Scope&);
+
+	public:
+		/**
+		 * Constructor activating an arena for the calling thread.
+		 * @param	arena	Arena to activate
+		 */
+		explicit Scope(StringArena& arena);
+
+		/**
+		 * Destructor restoring the previously active arena.
+		 */
+		~Scope();
+	};
+
+	/**
+	 * Constructor for instances of the class StringArena. No memory is allocated until the first allocation.
+	 * @param	blockSize	Size of the blocks to allocate from the heap in bytes
+	 */
+	explicit StringArena(size_t blockSize = STRING_ARENA_BLOCK_SIZE);
+
+	/**
+	 * Destructor for instances of the class StringArena. Frees all blocks.
+	 */
+	~StringArena();
+
+	/**
+	 * Allocates memory from the arena.
+	 * @param	size		Size of the allocation in bytes
+	 * @param	alignment	Alignment of the allocation in bytes, must be a power of two
+	 * @return			Pointer to the allocated memory
+	 */
+	void* allocate(size_t size, size_t alignment);
+
+	/**
+	 * Frees all allocations at once. The most recently allocated block is kept for reuse, all others are returned
+	 * to the heap. Strings allocated from the arena must be destroyed before.
+	 */
+	void reset();
+
+	/**
+	 * Returns the count of bytes handed out since the last reset.
+	 * @return	Count of bytes
+	 */
+	size_t usedBytes() const;
+
+	/**
+	 * Returns the arena active for the calling thread.
+	 * @return	Active arena, 0 if no arena is active
+	 */
+	static StringArena* active();
+};
+
+
+/**
+ * @class StringArenaAllocator
+ * Allocator of the class String allocating from the StringArena active for the calling thread. Deallocating is a
+ * no-op, the memory is freed by resetting or destroying the arena. Allocating without an active arena throws
+ * std::bad_alloc. Buffers are aligned to words like the ones of the other allocators. Copies of a String using the
+ * arena allocator never share a buffer, see StringAllocatorTraits.
+ */
+template<class TChar>
+class StringArenaAllocator
+{
+public:
+	/**
+	 * Allocates a buffer from the active arena.
+	 * @param	count	Count of characters to allocate including the terminating 0
+	 * @return		Allocated buffer
+	 */
+	static TChar* allocate(size_t count);
+
+	/**
+	 * Does nothing, arena memory is freed by StringArena::reset.
+	 * @param	buffer	Buffer to deallocate
+	 * @param	count	Count of characters passed to allocate for the buffer
+	 */
+	static void deallocate(TChar* buffer, size_t count);
+
+	/**
+	 * Returns the capacity unchanged.
+	 * @param	capacity	Requested capacity in characters excluding the terminating 0
+	 * @return			Usable capacity in characters excluding the terminating 0
+	 */
+	static size_t roundCapacity(size_t capacity);
+};
+
+
+/**
+ * @struct StringAllocatorTraits
+ * Properties of an allocator of the class String, specialized for allocators deviating from the defaults.
+ */
+template<class TAllocator>
+struct StringAllocatorTraits
+{
+	// Whether copies may share a buffer using STRING_SHARED_BUFFER, which keeps a reference count in front of it
+	static const bool SHARED_BUFFERS = true;
+};
+
+/**
+ * @struct StringAllocatorTraits
+ * StringArenaAllocator does not share buffers, so destroying a String never reads from a buffer of a reset arena.
+ */
+template<class TChar>
+struct StringAllocatorTraits<StringArenaAllocator<TChar> >
+{
+	static const bool SHARED_BUFFERS = false;
+};
+
+
+// Include the allocator implementations
+#include "StringAllocator.tpp"
+
+
+#endif // #ifndef STRINGALLOCATOR_HPP
@@ -0,0 +1,380 @@
+/**
+ * @file StringAllocator.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGALLOCATOR_HPP
+#error STRINGALLOCATOR_HPP undefined
+#endif
+
+template<class TChar>
+TChar* StringAllocator<TChar>::allocate(size_t count)
+{
+	return new TChar[count];
+}
+
+template<class TChar>
+void StringAllocator<TChar>::deallocate(TChar* buffer, size_t)
+{
+	delete[] buffer;
+}
+
+template<class TChar>
+size_t StringAllocator<TChar>::roundCapacity(size_t capacity)
+{
+	return capacity;
+}
+
+
+
+template<class TChar>
+StringPoolAllocator<TChar>::Reaper::~Reaper()
+{
+	Heap* heap = currentHeap();
+	if (!heap)
+	{
+		return;
+	}
+	for (size_t sizeClass = 0; sizeClass < SIZE_CLASSES; sizeClass++)
+	{
+		Slab* slab = heap->slabs[sizeClass];
+		while (slab)
+		{
+			Slab* next = slab->next;
+			orphan(slab);
+			slab = next;
+		}
+	}
+	delete heap;
+	currentHeap() = 0;
+}
+
+template<class TChar>
+typename StringPoolAllocator<TChar>::Heap*& StringPoolAllocator<TChar>::currentHeap()
+{
+	static thread_local Heap* heap = 0;
+	return heap;
+}
+
+template<class TChar>
+typename StringPoolAllocator<TChar>::Heap& StringPoolAllocator<TChar>::ownHeap()
+{
+	Heap*& heap = currentHeap();
+	if (!heap)
+	{
+		// The reaper is constructed on the first allocation of the thread and releases the heap when it exits
+		static thread_local Reaper reaper;
+		(void)reaper;
+		heap = new Heap();
+	}
+	return *heap;
+}
+
+template<class TChar>
+std::atomic<size_t>& StringPoolAllocator<TChar>::slabCounter()
+{
+	static std::atomic<size_t> counter(0);
+	return counter;
+}
+
+template<class TChar>
+size_t StringPoolAllocator<TChar>::sizeClass(size_t size)
+{
+	size_t sizeClass = 0;
+	size_t blockSize = MIN_BLOCK_SIZE;
+	while (blockSize < size)
+	{
+		blockSize <<= 1;
+		sizeClass++;
+	}
+	return sizeClass;
+}
+
+template<class TChar>
+typename StringPoolAllocator<TChar>::Slab* StringPoolAllocator<TChar>::slabOf(const void* block)
+{
+	return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(block) & ~static_cast<uintptr_t>(STRING_POOL_SLAB_SIZE - 1));
+}
+
+template<class TChar>
+bool StringPoolAllocator<TChar>::reclaim(Heap& heap, size_t sizeClass)
+{
+	bool reclaimed = false;
+	for (Slab* slab = heap.slabs[sizeClass]; slab; slab = slab->next)
+	{
+		if (!slab->remoteFree.load(std::memory_order_relaxed))
+		{
+			continue;
+		}
+
+		// Move the blocks freed by other threads to the free list
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(slab->remoteFree.exchange(0, std::memory_order_acquire));
+		while (block)
+		{
+			FreeBlock* next = block->next;
+			block->next = heap.freeLists[sizeClass];
+			heap.freeLists[sizeClass] = block;
+			slab->usedBlocks--;
+			block = next;
+		}
+		reclaimed = true;
+	}
+	return reclaimed;
+}
+
+template<class TChar>
+void StringPoolAllocator<TChar>::refill(Heap& heap, size_t sizeClass)
+{
+	// Align the slab to its size, which takes one slab of address space more
+	size_t blockSize = static_cast<size_t>(MIN_BLOCK_SIZE) << sizeClass;
+	void* memory = ::operator new(2 * STRING_POOL_SLAB_SIZE);
+	char* start = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(memory) + STRING_POOL_SLAB_SIZE - 1) &
+		~static_cast<uintptr_t>(STRING_POOL_SLAB_SIZE - 1));
+	Slab* slab = new (start) Slab();
+	slab->owner.store(&heap, std::memory_order_relaxed);
+	slab->memory = memory;
+	slab->next = heap.slabs[sizeClass];
+	heap.slabs[sizeClass] = slab;
+	slabCounter().fetch_add(1, std::memory_order_relaxed);
+
+	// Push the blocks behind the header onto the free list
+	size_t header = (sizeof(Slab) + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE * MIN_BLOCK_SIZE;
+	FreeBlock*& first = heap.freeLists[sizeClass];
+	for (size_t offset = header; offset + blockSize <= STRING_POOL_SLAB_SIZE; offset += blockSize)
+	{
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(start + offset);
+		block->next = first;
+		first = block;
+	}
+}
+
+template<class TChar>
+void StringPoolAllocator<TChar>::orphan(Slab* slab)
+{
+	// Other threads free the remaining blocks by counting down orphanedBlocks from now on
+	slab->owner.store(0, std::memory_order_relaxed);
+	FreeBlock* block = reinterpret_cast<FreeBlock*>(slab->remoteFree.exchange(ORPHANED, std::memory_order_acq_rel));
+	for (; block; block = block->next)
+	{
+		slab->usedBlocks--;
+	}
+
+	// Threads counting down before the blocks in use are added never see 0, the last one after them frees the slab
+	ptrdiff_t used = static_cast<ptrdiff_t>(slab->usedBlocks);
+	if (slab->orphanedBlocks.fetch_add(used, std::memory_order_acq_rel) + used == 0)
+	{
+		freeSlab(slab);
+	}
+}
+
+template<class TChar>
+void StringPoolAllocator<TChar>::freeSlab(Slab* slab)
+{
+	void* memory = slab->memory;
+	slab->~Slab();
+	::operator delete(memory);
+	slabCounter().fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<class TChar>
+TChar* StringPoolAllocator<TChar>::allocate(size_t count)
+{
+	size_t size = count * sizeof(TChar);
+	if (size > MAX_BLOCK_SIZE)
+	{
+		return new TChar[count];
+	}
+
+	size_t blockClass = sizeClass(size);
+	Heap& heap = ownHeap();
+	FreeBlock*& first = heap.freeLists[blockClass];
+	if (!first && !reclaim(heap, blockClass))
+	{
+		refill(heap, blockClass);
+	}
+	FreeBlock* block = first;
+	first = block->next;
+	slabOf(block)->usedBlocks++;
+	return reinterpret_cast<TChar*>(block);
+}
+
+template<class TChar>
+void StringPoolAllocator<TChar>::deallocate(TChar* buffer, size_t count)
+{
+	size_t size = count * sizeof(TChar);
+	if (size > MAX_BLOCK_SIZE)
+	{
+		delete[] buffer;
+		return;
+	}
+
+	FreeBlock* block = reinterpret_cast<FreeBlock*>(buffer);
+	Slab* slab = slabOf(block);
+	Heap* heap = currentHeap();
+	if (heap && slab->owner.load(std::memory_order_relaxed) == heap)
+	{
+		FreeBlock*& first = heap->freeLists[sizeClass(size)];
+		block->next = first;
+		first = block;
+		slab->usedBlocks--;
+		return;
+	}
+
+	// Return the block to the owner of its slab, or count it down if the owner exited
+	uintptr_t head = slab->remoteFree.load(std::memory_order_relaxed);
+	do
+	{
+		if (head == ORPHANED)
+		{
+			if (slab->orphanedBlocks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				freeSlab(slab);
+			}
+			return;
+		}
+		block->next = reinterpret_cast<FreeBlock*>(head);
+	}
+	while (!slab->remoteFree.compare_exchange_weak(head, reinterpret_cast<uintptr_t>(block), std::memory_order_release,
+		std::memory_order_relaxed));
+}
+
+template<class TChar>
+size_t StringPoolAllocator<TChar>::roundCapacity(size_t capacity)
+{
+	size_t size = (capacity + 1) * sizeof(TChar);
+	if (size > MAX_BLOCK_SIZE)
+	{
+		return capacity;
+	}
+	return (static_cast<size_t>(MIN_BLOCK_SIZE) << sizeClass(size)) / sizeof(TChar) - 1;
+}
+
+template<class TChar>
+size_t StringPoolAllocator<TChar>::slabs()
+{
+	return slabCounter().load(std::memory_order_relaxed);
+}
+
+
+
+inline StringArena*& StringArena::activeArena()
+{
+	static thread_local StringArena* arena = 0;
+	return arena;
+}
+
+inline void StringArena::grow(size_t size)
+{
+	// Oversized allocations get a block of their own
+	size_t blockSize = m_blockSize;
+	if (size + sizeof(Block) > blockSize)
+	{
+		blockSize = size + sizeof(Block);
+	}
+
+	Block* block = static_cast<Block*>(::operator new(blockSize));
+	block->previous = m_block;
+	block->size = blockSize;
+	m_block = block;
+	m_current = reinterpret_cast<char*>(block + 1);
+	m_end = reinterpret_cast<char*>(block) + blockSize;
+}
+
+inline StringArena::Scope::Scope(StringArena& arena)
+	: m_previous(activeArena())
+{
+	activeArena() = &arena;
+}
+
+inline StringArena::Scope::~Scope()
+{
+	activeArena() = m_previous;
+}
+
+inline StringArena::StringArena(size_t blockSize)
+	: m_block(0), m_current(0), m_end(0), m_blockSize(blockSize), m_usedBytes(0)
+{
+	// Nothing to do yet
+}
+
+inline StringArena::~StringArena()
+{
+	while (m_block)
+	{
+		Block* previous = m_block->previous;
+		::operator delete(m_block);
+		m_block = previous;
+	}
+}
+
+inline void* StringArena::allocate(size_t size, size_t alignment)
+{
+	size_t padding = (alignment - (reinterpret_cast<uintptr_t>(m_current) & (alignment - 1))) & (alignment - 1);
+	if (!m_block || size + padding > static_cast<size_t>(m_end - m_current))
+	{
+		grow(size + alignment);
+		padding = (alignment - (reinterpret_cast<uintptr_t>(m_current) & (alignment - 1))) & (alignment - 1);
+	}
+
+	char* memory = m_current + padding;
+	m_current = memory + size;
+	m_usedBytes += size;
+	return memory;
+}
+
+inline void StringArena::reset()
+{
+	if (m_block)
+	{
+		// Keep the most recently allocated block
+		Block* block = m_block->previous;
+		while (block)
+		{
+			Block* previous = block->previous;
+			::operator delete(block);
+			block = previous;
+		}
+		m_block->previous = 0;
+		m_current = reinterpret_cast<char*>(m_block + 1);
+		m_end = reinterpret_cast<char*>(m_block) + m_block->size;
+	}
+	m_usedBytes = 0;
+}
+
+inline size_t StringArena::usedBytes() const
+{
+	return m_usedBytes;
+}
+
+inline StringArena* StringArena::active()
+{
+	return activeArena();
+}
+
+
+
+template<class TChar>
+TChar* StringArenaAllocator<TChar>::allocate(size_t count)
+{
+	StringArena* arena = StringArena::active();
+	if (!arena)
+	{
+		throw std::bad_alloc();
+	}
+	// Align the buffers for the reference count of shared buffers
+	size_t alignment = sizeof(TChar) > sizeof(size_t) ? sizeof(TChar) : sizeof(size_t);
+	return static_cast<TChar*>(arena->allocate(count * sizeof(TChar), alignment));
+}
+
+template<class TChar>
+void StringArenaAllocator<TChar>::deallocate(TChar*, size_t)
+{
+	// Nothing to do, the arena frees all allocations at once
+}
+
+template<class TChar>
+size_t StringArenaAllocator<TChar>::roundCapacity(size_t capacity)
+{
+	return capacity;
+}
@@ -0,0 +1,540 @@
+/**
+ * @file StringConcat.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGCONCAT_HPP
+#define STRINGCONCAT_HPP
+
+
+// For memcpy
+#include <cstring>
+// For std::numeric_limits
+#include <limits>
+// For std::enable_if and std::is_signed
+#include <type_traits>
+// For formatting numbers
+#include "StringNumber.hpp"
+#include "String.hpp"
+
+
+/**
+ * @class StringRangePiece
+ * Piece of a concatenation referring to a range of characters of a String, a StringView or a c-string.
+ */
+template<class TChar>
+class StringRangePiece
+{
+private:
+	// First character of the range
+	const TChar* m_data;
+	// Length of the range in characters
+	size_t m_length;
+
+public:
+	/**
+	 * Constructor which refers to the characters of a c-string.
+	 * @param	str	C-string to refer to, may be nullptr
+	 */
+	StringRangePiece(const TChar* str);
+
+	/**
+	 * Constructor which refers to the characters of a view.
+	 * @param	str	View to refer to
+	 */
+	StringRangePiece(const StringView<TChar>& str);
+
+	/**
+	 * Constructor which refers to the characters of a String.
+	 * @param	str	String to refer to
+	 */
+	template<class TAllocator>
+	StringRangePiece(const String<TChar, TAllocator>& str);
+
+	/**
+	 * Returns the length of the piece in characters.
+	 * @return	Length of the piece
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the characters of the piece to a buffer.
+	 * @param	target	Buffer for at least length() characters
+	 * @return		Position behind the copied characters
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if the piece refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		true if the piece points into the buffer, otherwise false
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+};
+
+/**
+ * @class StringCharPiece
+ * Piece of a concatenation consisting of a single character.
+ */
+template<class TChar>
+class StringCharPiece
+{
+private:
+	// Stored character
+	TChar m_char;
+
+public:
+	/**
+	 * Constructor which stores a character.
+	 * @param	c	Character to store
+	 */
+	StringCharPiece(TChar c);
+
+	/**
+	 * Returns the length of the piece in characters.
+	 * @return	Always 1
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the character to a buffer.
+	 * @param	target	Buffer for at least one character
+	 * @return		Position behind the copied character
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if the piece refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		Always false, the character is stored in the piece
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+};
+
+/**
+ * @class StringIntegerPiece
+ * Piece of a concatenation consisting of the decimal representation of an integer, which is formatted once by the
+ * constructor using StringNumber.
+ */
+template<class TChar, class TInteger>
+class StringIntegerPiece
+{
+private:
+	// Formatted digits including the sign
+	TChar m_digits[StringNumber::MAX_INTEGER_LENGTH];
+	// Count of the formatted digits
+	size_t m_length;
+
+public:
+	/**
+	 * Constructor which formats an integer.
+	 * @param	value	Integer to format
+	 */
+	StringIntegerPiece(TInteger value);
+
+	/**
+	 * Returns the length of the piece in characters.
+	 * @return	Length of the piece
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the digits to a buffer.
+	 * @param	target	Buffer for at least length() characters
+	 * @return		Position behind the copied digits
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if the piece refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		Always false, the digits are stored in the piece
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+};
+
+/**
+ * @class StringDoublePiece
+ * Piece of a concatenation consisting of the shortest decimal representation of a double, which is formatted once by
+ * the constructor using StringNumber.
+ */
+template<class TChar>
+class StringDoublePiece
+{
+private:
+	// Formatted characters
+	TChar m_digits[StringNumber::MAX_DOUBLE_LENGTH];
+	// Count of the formatted characters
+	size_t m_length;
+
+public:
+	/**
+	 * Constructor which formats a double.
+	 * @param	value	Double to format
+	 */
+	StringDoublePiece(double value);
+
+	/**
+	 * Returns the length of the piece in characters.
+	 * @return	Length of the piece
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the formatted characters to a buffer.
+	 * @param	target	Buffer for at least length() characters
+	 * @return		Position behind the copied characters
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if the piece refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		Always false, the characters are stored in the piece
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+};
+
+/**
+ * @class StringPattern
+ * Pattern of String::format, in which every {} is replaced by an argument. Literal braces are written as {{ and }}.
+ * The pattern is checked once by the constructor.
+ */
+template<class TChar>
+class StringPattern
+{
+private:
+	// First character of the pattern
+	const TChar* m_data;
+	// End of the pattern
+	const TChar* m_end;
+	// Count of placeholders
+	size_t m_placeholders;
+	// Length of the pattern without placeholders and with unescaped braces
+	size_t m_length;
+	// Whether every brace is part of a placeholder or an escape sequence
+	bool m_valid;
+
+public:
+	/**
+	 * Constructor which checks a pattern.
+	 * @param	pattern	Pattern to refer to
+	 */
+	StringPattern(const StringView<TChar>& pattern);
+
+	/**
+	 * Checks if the pattern is valid for a count of arguments.
+	 * @param	arguments	Count of arguments
+	 * @return			true if the braces are valid and there is one placeholder per argument, otherwise false
+	 */
+	bool isValid(size_t arguments) const;
+
+	/**
+	 * Returns the length of the literal text of the pattern.
+	 * @return	Length of the pattern without placeholders
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the literal text up to the next placeholder to a buffer.
+	 * @param	target		Buffer for the literal text
+	 * @param	position	Position in the pattern to start at, set behind the next placeholder or to the end
+	 * @return			Position behind the copied text
+	 */
+	TChar* writeLiteral(TChar* target, const TChar*& position) const;
+
+	/**
+	 * Returns the first character of the pattern.
+	 * @return	First character of the pattern
+	 */
+	const TChar* begin() const;
+
+	/**
+	 * Returns the end of the pattern.
+	 * @return	End of the pattern
+	 */
+	const TChar* end() const;
+};
+
+/**
+ * @class StringFormat
+ * Piece of a concatenation consisting of a pattern whose placeholders are replaced by arguments, which are stored
+ * like the pieces of a concatenation. It must only be used if the pattern is valid for the arguments.
+ */
+template<class TChar, class... TArgs>
+class StringFormat
+{
+private:
+	// Checked pattern
+	StringPattern<TChar> m_pattern;
+	// Arguments replacing the placeholders
+	StringConcat<TChar, TArgs...> m_arguments;
+
+public:
+	/**
+	 * Constructor which checks the pattern and refers to or stores the arguments.
+	 * @param	pattern		Pattern to refer to
+	 * @param	arguments	Arguments replacing the placeholders
+	 */
+	StringFormat(const StringView<TChar>& pattern, const TArgs&... arguments);
+
+	/**
+	 * Checks if the pattern contains one placeholder per argument and no invalid braces.
+	 * @return	true if the pattern is valid, otherwise false
+	 */
+	bool isValid() const;
+
+	/**
+	 * Returns the length of the formatted string.
+	 * @return	Length of the formatted string in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Writes the formatted string to a buffer.
+	 * @param	target	Buffer for at least length() characters
+	 * @return		Position behind the formatted string
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if the pattern or any of the arguments refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		true if the pattern or an argument points into the buffer, otherwise false
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+};
+
+/**
+ * @struct StringPieceType
+ * Selects the piece class storing an operand of a concatenation. Strings, views and c-strings are referred to,
+ * characters, doubles and integers other than character types are stored, nested concatenations and formats are
+ * referred to by reference. Other types, including float, are rejected at compile time.
+ */
+template<class TChar, class TPiece, class TEnable = void>
+struct StringPieceType;
+
+template<class TChar, class TAllocator>
+struct StringPieceType<TChar, String<TChar, TAllocator> >
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar>
+struct StringPieceType<TChar, StringView<TChar> >
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar>
+struct StringPieceType<TChar, const TChar*>
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar>
+struct StringPieceType<TChar, TChar*>
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar, size_t N>
+struct StringPieceType<TChar, TChar[N]>
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar, size_t N>
+struct StringPieceType<TChar, const TChar[N]>
+{
+	typedef StringRangePiece<TChar> Type;
+};
+
+template<class TChar>
+struct StringPieceType<TChar, TChar>
+{
+	typedef StringCharPiece<TChar> Type;
+};
+
+template<class TChar, class TInteger>
+struct StringPieceType<TChar, TInteger, typename std::enable_if<std::is_integral<TInteger>::value &&
+	!std::is_same<TInteger, TChar>::value && !std::is_same<TInteger, bool>::value &&
+	!std::is_same<TInteger, char>::value && !std::is_same<TInteger, signed char>::value &&
+	!std::is_same<TInteger, unsigned char>::value && !std::is_same<TInteger, wchar_t>::value &&
+	!std::is_same<TInteger, char16_t>::value && !std::is_same<TInteger, char32_t>::value>::type>
+{
+	typedef StringIntegerPiece<TChar, TInteger> Type;
+};
+
+template<class TChar>
+struct StringPieceType<TChar, double>
+{
+	typedef StringDoublePiece<TChar> Type;
+};
+
+template<class TChar, class... TPieces>
+struct StringPieceType<TChar, StringConcat<TChar, TPieces...> >
+{
+	typedef const StringConcat<TChar, TPieces...>& Type;
+};
+
+template<class TChar, class... TArgs>
+struct StringPieceType<TChar, StringFormat<TChar, TArgs...> >
+{
+	typedef const StringFormat<TChar, TArgs...>& Type;
+};
+
+/**
+ * @class StringConcat
+ * Expression template of a concatenation returned by operator+ and used by String::concat. It only refers to its
+ * pieces, so the combined length is calculated once when it is assigned to a String, which then allocates at most
+ * once and copies every piece once. A concatenation refers to Strings and to the nested concatenations of a chain of
+ * operator+ and must be assigned to a String within the same expression, it must not be stored using auto.
+ */
+template<class TChar, class... TPieces>
+class StringConcat
+{
+public:
+	/**
+	 * Constructor of an empty concatenation.
+	 */
+	StringConcat();
+
+	/**
+	 * Returns the combined length of the pieces.
+	 * @return	Always 0
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the pieces to a buffer.
+	 * @param	target	Buffer to copy to
+	 * @return		target
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if any of the pieces refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		Always false
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+
+	/**
+	 * Copies the remaining literal text of a pattern to a buffer.
+	 * @param	target		Buffer to copy to
+	 * @param	pattern		Checked pattern
+	 * @param	position	Position in the pattern behind the last placeholder
+	 * @return			Position behind the copied text
+	 */
+	TChar* writeFormat(TChar* target, const StringPattern<TChar>& pattern, const TChar* position) const;
+};
+
+template<class TChar, class TFirst, class... TRest>
+class StringConcat<TChar, TFirst, TRest...>
+{
+private:
+	// First piece
+	typename StringPieceType<TChar, TFirst>::Type m_first;
+	// Remaining pieces
+	StringConcat<TChar, TRest...> m_rest;
+
+public:
+	/**
+	 * Constructor of a concatenation referring to or storing its pieces.
+	 * @param	first	First piece
+	 * @param	rest	Remaining pieces
+	 */
+	StringConcat(const TFirst& first, const TRest&... rest);
+
+	/**
+	 * Returns the combined length of the pieces.
+	 * @return	Combined length of the pieces in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Copies the pieces to a buffer.
+	 * @param	target	Buffer for at least length() characters
+	 * @return		Position behind the copied pieces
+	 */
+	TChar* write(TChar* target) const;
+
+	/**
+	 * Checks if any of the pieces refers to characters inside a buffer.
+	 * @param	begin	Start of the buffer
+	 * @param	end	End of the buffer
+	 * @return		true if a piece points into the buffer, otherwise false
+	 */
+	bool overlaps(const TChar* begin, const TChar* end) const;
+
+	/**
+	 * Copies the literal text of a pattern to a buffer and the pieces in place of its placeholders.
+	 * @param	target		Buffer to copy to
+	 * @param	pattern		Checked pattern with one placeholder per piece
+	 * @param	position	Position in the pattern to start at
+	 * @return			Position behind the copied text
+	 */
+	TChar* writeFormat(TChar* target, const StringPattern<TChar>& pattern, const TChar* position) const;
+};
+
+
+/**
+ * Concatenates a string and a String, view, c-string, character, integer, double or concatenation lazily.
+ * @param	lhs	Left-hand string
+ * @param	rhs	Right-hand piece
+ * @return		Concatenation of lhs and rhs, which refers to them
+ */
+template<class TChar, class TAllocator, class TRight>
+StringConcat<TChar, String<TChar, TAllocator>, TRight> operator+(const String<TChar, TAllocator>& lhs, const TRight& rhs);
+
+/**
+ * Concatenates a string and a String, view, c-string, character, integer, double or concatenation reusing the buffer
+ * of lhs.
+ * @param	lhs	Left-hand string, taken over by the result
+ * @param	rhs	Right-hand piece
+ * @return		Concatenation of lhs and rhs
+ */
+template<class TChar, class TAllocator, class TRight>
+String<TChar, TAllocator> operator+(String<TChar, TAllocator>&& lhs, const TRight& rhs);
+
+/**
+ * Concatenates a c-string and a string lazily.
+ * @param	lhs	Left-hand c-string
+ * @param	rhs	Right-hand string
+ * @return		Concatenation of lhs and rhs, which refers to them
+ */
+template<class TChar, class TAllocator>
+StringConcat<TChar, const TChar*, String<TChar, TAllocator> > operator+(const TChar* lhs, const String<TChar, TAllocator>& rhs);
+
+/**
+ * Concatenates a view and a string lazily.
+ * @param	lhs	Left-hand view
+ * @param	rhs	Right-hand string
+ * @return		Concatenation of lhs and rhs, which refers to them
+ */
+template<class TChar, class TAllocator>
+StringConcat<TChar, StringView<TChar>, String<TChar, TAllocator> > operator+(const StringView<TChar>& lhs, const String<TChar, TAllocator>& rhs);
+
+/**
+ * Extends a concatenation by another String, view, c-string, character, integer, double or concatenation lazily.
+ * @param	lhs	Left-hand concatenation
+ * @param	rhs	Right-hand piece
+ * @return		Concatenation of lhs and rhs, which refers to them
+ */
+template<class TChar, class... TPieces, class TRight>
+StringConcat<TChar, StringConcat<TChar, TPieces...>, TRight> operator+(const StringConcat<TChar, TPieces...>& lhs, const TRight& rhs);
+
+
+// Include StringConcat class implementation
+#include "StringConcat.tpp"
+
+
+#endif // #ifndef STRINGCONCAT_HPP
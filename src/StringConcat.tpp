@@ -0,0 +1,349 @@
+/**
+ * @file StringConcat.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGCONCAT_HPP
+#error STRINGCONCAT_HPP undefined
+#endif
+
+template<class TChar>
+StringRangePiece<TChar>::StringRangePiece(const TChar* str)
+	: m_data(str), m_length(str ? StringKernels<TChar>::length(str) : 0)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+StringRangePiece<TChar>::StringRangePiece(const StringView<TChar>& str)
+	: m_data(str.data()), m_length(str.length())
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+template<class TAllocator>
+StringRangePiece<TChar>::StringRangePiece(const String<TChar, TAllocator>& str)
+	: m_data(str.c_str()), m_length(str.length())
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+size_t StringRangePiece<TChar>::length() const
+{
+	return m_length;
+}
+
+template<class TChar>
+TChar* StringRangePiece<TChar>::write(TChar* target) const
+{
+	if (m_length)
+	{
+		memcpy(target, m_data, m_length * sizeof(TChar));
+	}
+	return target + m_length;
+}
+
+template<class TChar>
+bool StringRangePiece<TChar>::overlaps(const TChar* begin, const TChar* end) const
+{
+	return m_data >= begin && m_data <= end;
+}
+
+template<class TChar>
+StringCharPiece<TChar>::StringCharPiece(TChar c)
+	: m_char(c)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+size_t StringCharPiece<TChar>::length() const
+{
+	return 1;
+}
+
+template<class TChar>
+TChar* StringCharPiece<TChar>::write(TChar* target) const
+{
+	*target = m_char;
+	return target + 1;
+}
+
+template<class TChar>
+bool StringCharPiece<TChar>::overlaps(const TChar*, const TChar*) const
+{
+	return false;
+}
+
+template<class TChar, class TInteger>
+StringIntegerPiece<TChar, TInteger>::StringIntegerPiece(TInteger value)
+{
+	// Only the branch matching the signedness is taken, so the conversion of the other one never truncates
+	if (std::is_signed<TInteger>::value)
+	{
+		m_length = StringNumber::formatInt(static_cast<int64_t>(value), m_digits);
+	}
+	else
+	{
+		m_length = StringNumber::formatUInt(static_cast<uint64_t>(value), m_digits);
+	}
+}
+
+template<class TChar, class TInteger>
+size_t StringIntegerPiece<TChar, TInteger>::length() const
+{
+	return m_length;
+}
+
+template<class TChar, class TInteger>
+TChar* StringIntegerPiece<TChar, TInteger>::write(TChar* target) const
+{
+	memcpy(target, m_digits, m_length * sizeof(TChar));
+	return target + m_length;
+}
+
+template<class TChar, class TInteger>
+bool StringIntegerPiece<TChar, TInteger>::overlaps(const TChar*, const TChar*) const
+{
+	return false;
+}
+
+template<class TChar>
+StringDoublePiece<TChar>::StringDoublePiece(double value)
+	: m_length(StringNumber::formatDouble(value, m_digits))
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+size_t StringDoublePiece<TChar>::length() const
+{
+	return m_length;
+}
+
+template<class TChar>
+TChar* StringDoublePiece<TChar>::write(TChar* target) const
+{
+	memcpy(target, m_digits, m_length * sizeof(TChar));
+	return target + m_length;
+}
+
+template<class TChar>
+bool StringDoublePiece<TChar>::overlaps(const TChar*, const TChar*) const
+{
+	return false;
+}
+
+template<class TChar>
+StringPattern<TChar>::StringPattern(const StringView<TChar>& pattern)
+	: m_data(pattern.data()), m_end(pattern.data() + pattern.length()), m_placeholders(0), m_length(0), m_valid(true)
+{
+	// Count the placeholders and the literal characters, a brace must be followed by a closing or the same brace
+	for (const TChar* position = m_data; position != m_end; ++position)
+	{
+		if (*position == '{' || *position == '}')
+		{
+			if (position + 1 == m_end || (position[1] != *position && !(*position == '{' && position[1] == '}')))
+			{
+				m_valid = false;
+				return;
+			}
+			if (*position == '{' && position[1] == '}')
+			{
+				++m_placeholders;
+				++position;
+				continue;
+			}
+			++position;
+		}
+		++m_length;
+	}
+}
+
+template<class TChar>
+bool StringPattern<TChar>::isValid(size_t arguments) const
+{
+	return m_valid && m_placeholders == arguments;
+}
+
+template<class TChar>
+size_t StringPattern<TChar>::length() const
+{
+	return m_length;
+}
+
+template<class TChar>
+TChar* StringPattern<TChar>::writeLiteral(TChar* target, const TChar*& position) const
+{
+	// Copy runs without braces at once, escaped braces are copied once
+	while (position != m_end)
+	{
+		const TChar* run = position;
+		while (run != m_end && *run != '{' && *run != '}')
+		{
+			++run;
+		}
+		size_t length = run - position;
+		if (length)
+		{
+			memcpy(target, position, length * sizeof(TChar));
+			target += length;
+		}
+		position = run;
+		if (position == m_end)
+		{
+			break;
+		}
+		if (position[0] == '{' && position[1] == '}')
+		{
+			position += 2;
+			break;
+		}
+		*target++ = *position;
+		position += 2;
+	}
+	return target;
+}
+
+template<class TChar>
+const TChar* StringPattern<TChar>::begin() const
+{
+	return m_data;
+}
+
+template<class TChar>
+const TChar* StringPattern<TChar>::end() const
+{
+	return m_end;
+}
+
+template<class TChar, class... TArgs>
+StringFormat<TChar, TArgs...>::StringFormat(const StringView<TChar>& pattern, const TArgs&... arguments)
+	: m_pattern(pattern), m_arguments(arguments...)
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class... TArgs>
+bool StringFormat<TChar, TArgs...>::isValid() const
+{
+	return m_pattern.isValid(sizeof...(TArgs));
+}
+
+template<class TChar, class... TArgs>
+size_t StringFormat<TChar, TArgs...>::length() const
+{
+	return m_pattern.length() + m_arguments.length();
+}
+
+template<class TChar, class... TArgs>
+TChar* StringFormat<TChar, TArgs...>::write(TChar* target) const
+{
+	return m_arguments.writeFormat(target, m_pattern, m_pattern.begin());
+}
+
+template<class TChar, class... TArgs>
+bool StringFormat<TChar, TArgs...>::overlaps(const TChar* begin, const TChar* end) const
+{
+	return (m_pattern.begin() >= begin && m_pattern.begin() <= end) || m_arguments.overlaps(begin, end);
+}
+
+template<class TChar, class... TPieces>
+StringConcat<TChar, TPieces...>::StringConcat()
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class... TPieces>
+size_t StringConcat<TChar, TPieces...>::length() const
+{
+	return 0;
+}
+
+template<class TChar, class... TPieces>
+TChar* StringConcat<TChar, TPieces...>::write(TChar* target) const
+{
+	return target;
+}
+
+template<class TChar, class... TPieces>
+bool StringConcat<TChar, TPieces...>::overlaps(const TChar*, const TChar*) const
+{
+	return false;
+}
+
+template<class TChar, class... TPieces>
+TChar* StringConcat<TChar, TPieces...>::writeFormat(TChar* target, const StringPattern<TChar>& pattern,
+	const TChar* position) const
+{
+	return pattern.writeLiteral(target, position);
+}
+
+template<class TChar, class TFirst, class... TRest>
+StringConcat<TChar, TFirst, TRest...>::StringConcat(const TFirst& first, const TRest&... rest)
+	: m_first(first), m_rest(rest...)
+{
+	// Nothing to do yet
+}
+
+template<class TChar, class TFirst, class... TRest>
+size_t StringConcat<TChar, TFirst, TRest...>::length() const
+{
+	return m_first.length() + m_rest.length();
+}
+
+template<class TChar, class TFirst, class... TRest>
+TChar* StringConcat<TChar, TFirst, TRest...>::write(TChar* target) const
+{
+	return m_rest.write(m_first.write(target));
+}
+
+template<class TChar, class TFirst, class... TRest>
+bool StringConcat<TChar, TFirst, TRest...>::overlaps(const TChar* begin, const TChar* end) const
+{
+	return m_first.overlaps(begin, end) || m_rest.overlaps(begin, end);
+}
+
+template<class TChar, class TFirst, class... TRest>
+TChar* StringConcat<TChar, TFirst, TRest...>::writeFormat(TChar* target, const StringPattern<TChar>& pattern,
+	const TChar* position) const
+{
+	// The literal text is copied up to the placeholder of the first piece, which is skipped
+	target = m_first.write(pattern.writeLiteral(target, position));
+	return m_rest.writeFormat(target, pattern, position);
+}
+
+
+template<class TChar, class TAllocator, class TRight>
+StringConcat<TChar, String<TChar, TAllocator>, TRight> operator+(const String<TChar, TAllocator>& lhs, const TRight& rhs)
+{
+	return StringConcat<TChar, String<TChar, TAllocator>, TRight>(lhs, rhs);
+}
+
+template<class TChar, class TAllocator, class TRight>
+String<TChar, TAllocator> operator+(String<TChar, TAllocator>&& lhs, const TRight& rhs)
+{
+	lhs.append(StringConcat<TChar, TRight>(rhs));
+	return std::move(lhs);
+}
+
+template<class TChar, class TAllocator>
+StringConcat<TChar, const TChar*, String<TChar, TAllocator> > operator+(const TChar* lhs, const String<TChar, TAllocator>& rhs)
+{
+	return StringConcat<TChar, const TChar*, String<TChar, TAllocator> >(lhs, rhs);
+}
+
+template<class TChar, class TAllocator>
+StringConcat<TChar, StringView<TChar>, String<TChar, TAllocator> > operator+(const StringView<TChar>& lhs, const String<TChar, TAllocator>& rhs)
+{
+	return StringConcat<TChar, StringView<TChar>, String<TChar, TAllocator> >(lhs, rhs);
+}
+
+template<class TChar, class... TPieces, class TRight>
+StringConcat<TChar, StringConcat<TChar, TPieces...>, TRight> operator+(const StringConcat<TChar, TPieces...>& lhs, const TRight& rhs)
+{
+	return StringConcat<TChar, StringConcat<TChar, TPieces...>, TRight>(lhs, rhs);
+}
@@ -0,0 +1,226 @@
+/**
+ * @file StringFile.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGFILE_HPP
+#define STRINGFILE_HPP
+
+
+#include "String.hpp"
+
+#if !STRING_POSIX_IO
+#error StringFile.hpp requires POSIX file descriptors, see STRING_POSIX_IO
+#endif
+
+// For errno
+#include <cerrno>
+// For open
+#include <fcntl.h>
+// For mmap and madvise
+#include <sys/mman.h>
+// For fstat
+#include <sys/stat.h>
+// For writev
+#include <sys/uio.h>
+// For read and close
+#include <unistd.h>
+
+
+// Count of bytes StringLineReader reads at once by default
+#ifndef STRING_LINE_CHUNK_SIZE
+#define STRING_LINE_CHUNK_SIZE 1048576
+#endif
+// Count of views StringFile::writeTo passes to a single call of writev
+#define STRING_WRITE_VECTORS 64
+
+
+/**
+ * @class StringFile
+ * Writes many strings to a file descriptor using scatter/gather writes, so they do not have to be concatenated into
+ * one buffer first. Reading files is done by String::readFile, MappedString and StringLineReader.
+ */
+class StringFile
+{
+public:
+	/**
+	 * Writes views one after another to a file descriptor, passing up to STRING_WRITE_VECTORS of them to every call
+	 * of writev and continuing after partial writes and interrupts.
+	 * @param	fd	File descriptor to write to
+	 * @param	views	Views to write
+	 * @param	count	Count of views
+	 * @return		true if all views were written, otherwise false
+	 */
+	template<class TChar>
+	static bool writeTo(int fd, const StringView<TChar>* views, size_t count);
+};
+
+/**
+ * @class MappedString
+ * Read-only view of a whole file mapped into memory, so the file is read by the page cache on demand without copying
+ * it. The pages are advised for sequential access. The characters are not zero-terminated and must not be accessed
+ * after the file was truncated by another process.
+ */
+class MappedString
+{
+private:
+	// First character of the mapping, an empty string for empty files, which cannot be mapped
+	const char* m_data;
+	// Length of the mapping in characters
+	size_t m_length;
+
+	// The mapping is owned by the instance, so it can be moved but neither copied nor assigned
+	MappedString(const MappedString&);
+	MappedString& operator=(const MappedString&);
+
+public:
+	/**
+	 * Default constructor for instances of the class MappedString. Constructs an empty view.
+	 */
+	MappedString();
+
+	/**
+	 * Move constructor for instances of the class MappedString. Takes over the mapping of other, which is left empty.
+	 * @param	other	Instance to move
+	 */
+	MappedString(MappedString&& other) noexcept;
+
+	/**
+	 * Destructor for instances of the class MappedString. Unmaps the file.
+	 */
+	~MappedString();
+
+	/**
+	 * Maps a file, replacing the previous mapping.
+	 * @param	path	Path of the file to map
+	 * @return		true if the file was mapped, otherwise false and the view is empty
+	 */
+	bool open(const char* path);
+
+	/**
+	 * Unmaps the file, leaving an empty view.
+	 */
+	void close();
+
+	/**
+	 * Returns a pointer to the mapped characters.
+	 * @return	First mapped character
+	 */
+	const char* data() const;
+
+	/**
+	 * Returns the length of the mapped file.
+	 * @return	Length in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Returns a view of the mapped characters.
+	 * @return	View of the file
+	 */
+	operator StringView<char>() const;
+
+	/**
+	 * Move assign operator. Unmaps the file and takes over the mapping of other, which is left empty.
+	 * @param	other	Instance to move
+	 * @return		Reference to the instance
+	 */
+	MappedString& operator=(MappedString&& other) noexcept;
+};
+
+/**
+ * @class StringLineReader
+ * Reads a file descriptor in chunks and splits it into lines at '\n', which is not part of the lines. The lines are
+ * returned as views into a buffer reused for every chunk or copied into a String reusing its capacity, so reading does
+ * not allocate per line. The buffer only grows for lines longer than a chunk. A last line without '\n' is returned if
+ * it is not empty.
+ */
+class StringLineReader
+{
+private:
+	// Buffer of the chunks, its length is the count of bytes read
+	String<char> m_buffer;
+	// Start of the next line in the buffer
+	size_t m_begin;
+	// Count of bytes behind m_begin searched for '\n' without success
+	size_t m_scanned;
+	// Count of bytes to read at once
+	size_t m_chunkSize;
+	// File descriptor to read from, -1 if none
+	int m_fd;
+	// Whether the file descriptor is closed by the reader
+	bool m_ownsFile;
+	// Whether the end of the file was reached
+	bool m_endOfFile;
+	// Whether reading failed
+	bool m_failed;
+
+	/**
+	 * Reads the next chunk behind the unfinished line, which is moved to the start of the buffer first.
+	 * @return	true if bytes were read, otherwise false at the end of the file or on errors
+	 */
+	bool readChunk();
+
+	// The file descriptor may be owned by the instance, so it can neither be copied nor assigned
+	StringLineReader(const StringLineReader&);
+	StringLineReader& operator=(const StringLineReader&);
+
+public:
+	/**
+	 * Constructor for instances of the class StringLineReader. Constructs a reader without a file.
+	 * @param	chunkSize	Count of bytes to read at once
+	 */
+	StringLineReader(size_t chunkSize = STRING_LINE_CHUNK_SIZE);
+
+	/**
+	 * Destructor for instances of the class StringLineReader. Closes the file if it was opened by the reader.
+	 */
+	~StringLineReader();
+
+	/**
+	 * Opens a file to read, replacing the previous one.
+	 * @param	path	Path of the file to read
+	 * @return		true if the file was opened, otherwise false
+	 */
+	bool open(const char* path);
+
+	/**
+	 * Reads from a file descriptor, which stays open when the reader is closed, replacing the previous one.
+	 * @param	fd	File descriptor to read from
+	 */
+	void attach(int fd);
+
+	/**
+	 * Stops reading and closes the file if it was opened by the reader. The buffer is kept for the next file.
+	 */
+	void close();
+
+	/**
+	 * Returns the next line as a view into the buffer, which stays valid until the next call.
+	 * @param	line	View of the line
+	 * @return		true if a line was read, otherwise false at the end of the file or on errors
+	 */
+	bool next(StringView<char>& line);
+
+	/**
+	 * Copies the next line into a String, reusing its capacity.
+	 * @param	line	String receiving the line
+	 * @return		true if a line was read, otherwise false at the end of the file or on errors
+	 */
+	template<class TAllocator>
+	bool next(String<char, TAllocator>& line);
+
+	/**
+	 * Checks if reading failed, which distinguishes errors from the end of the file after next returned false.
+	 * @return	true if reading failed, otherwise false
+	 */
+	bool failed() const;
+};
+
+
+// Include StringFile class implementation
+#include "StringFile.tpp"
+
+
+#endif // #ifndef STRINGFILE_HPP
@@ -0,0 +1,280 @@
+/**
+ * @file StringFile.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGFILE_HPP
+#error STRINGFILE_HPP undefined
+#endif
+
+template<class TChar>
+bool StringFile::writeTo(int fd, const StringView<TChar>* views, size_t count)
+{
+	iovec vectors[STRING_WRITE_VECTORS];
+	size_t used = 0;
+	size_t next = 0;
+	for (;;)
+	{
+		// Fill the batch with the next views, empty views are skipped
+		for (; used < STRING_WRITE_VECTORS && next < count; next++)
+		{
+			if (views[next].length())
+			{
+				vectors[used].iov_base = const_cast<TChar*>(views[next].data());
+				vectors[used].iov_len = views[next].length() * sizeof(TChar);
+				used++;
+			}
+		}
+		if (!used)
+		{
+			return true;
+		}
+
+		ssize_t written = writev(fd, vectors, static_cast<int>(used));
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return false;
+		}
+
+		// Drop the written views and continue a partially written one
+		size_t done = 0;
+		size_t rest = static_cast<size_t>(written);
+		while (done < used && rest >= vectors[done].iov_len)
+		{
+			rest -= vectors[done].iov_len;
+			done++;
+		}
+		if (done < used)
+		{
+			vectors[done].iov_base = static_cast<char*>(vectors[done].iov_base) + rest;
+			vectors[done].iov_len -= rest;
+		}
+		used -= done;
+		memmove(vectors, vectors + done, used * sizeof(iovec));
+	}
+}
+
+inline MappedString::MappedString()
+	: m_data(""), m_length(0)
+{
+	// Nothing to do yet
+}
+
+inline MappedString::MappedString(MappedString&& other) noexcept
+	: m_data(other.m_data), m_length(other.m_length)
+{
+	other.m_data = "";
+	other.m_length = 0;
+}
+
+inline MappedString::~MappedString()
+{
+	close();
+}
+
+inline bool MappedString::open(const char* path)
+{
+	close();
+	int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	// Empty files cannot be mapped and keep the empty view, the mapping stays valid after closing the file
+	struct stat status;
+	bool result = 0 == fstat(fd, &status) && S_ISREG(status.st_mode);
+	if (result && status.st_size > 0)
+	{
+		size_t length = static_cast<size_t>(status.st_size);
+		void* mapping = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED)
+		{
+			madvise(mapping, length, MADV_SEQUENTIAL);
+			m_data = static_cast<const char*>(mapping);
+			m_length = length;
+		}
+		else
+		{
+			result = false;
+		}
+	}
+	::close(fd);
+	return result;
+}
+
+inline void MappedString::close()
+{
+	if (m_length)
+	{
+		munmap(const_cast<char*>(m_data), m_length);
+		m_data = "";
+		m_length = 0;
+	}
+}
+
+inline const char* MappedString::data() const
+{
+	return m_data;
+}
+
+inline size_t MappedString::length() const
+{
+	return m_length;
+}
+
+inline MappedString::operator StringView<char>() const
+{
+	return StringView<char>(m_data, m_length);
+}
+
+inline MappedString& MappedString::operator=(MappedString&& other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+		m_data = other.m_data;
+		m_length = other.m_length;
+		other.m_data = "";
+		other.m_length = 0;
+	}
+	return *this;
+}
+
+inline StringLineReader::StringLineReader(size_t chunkSize)
+	: m_begin(0), m_scanned(0), m_chunkSize(chunkSize ? chunkSize : 1), m_fd(-1), m_ownsFile(false),
+	m_endOfFile(true), m_failed(false)
+{
+	// Nothing to do yet
+}
+
+inline StringLineReader::~StringLineReader()
+{
+	close();
+}
+
+inline bool StringLineReader::open(const char* path)
+{
+	close();
+	int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		m_failed = true;
+		return false;
+	}
+	attach(fd);
+	m_ownsFile = true;
+	return true;
+}
+
+inline void StringLineReader::attach(int fd)
+{
+	close();
+	m_fd = fd;
+	m_endOfFile = false;
+	m_failed = false;
+}
+
+inline void StringLineReader::close()
+{
+	if (m_ownsFile)
+	{
+		::close(m_fd);
+	}
+	m_fd = -1;
+	m_ownsFile = false;
+	m_endOfFile = true;
+	m_begin = 0;
+	m_scanned = 0;
+	m_buffer.setLength(0);
+}
+
+inline bool StringLineReader::readChunk()
+{
+	if (m_endOfFile)
+	{
+		return false;
+	}
+
+	// Move the unfinished line to the start of the buffer and make room for a whole chunk behind it
+	size_t rest = m_buffer.length() - m_begin;
+	if (m_begin)
+	{
+		char* buffer = m_buffer.data();
+		memmove(buffer, buffer + m_begin, rest);
+		m_buffer.setLength(rest);
+		m_begin = 0;
+	}
+	m_buffer.setCapacity(rest + m_chunkSize);
+
+	for (;;)
+	{
+		char* buffer = m_buffer.data();
+		ssize_t count = ::read(m_fd, buffer + rest, m_buffer.capacity() - rest);
+		if (count > 0)
+		{
+			m_buffer.setLength(rest + static_cast<size_t>(count));
+			return true;
+		}
+		if (count < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		m_failed = count < 0;
+		m_endOfFile = true;
+		return false;
+	}
+}
+
+inline bool StringLineReader::next(StringView<char>& line)
+{
+	for (;;)
+	{
+		// Search the end of the line behind the bytes searched before
+		StringView<char> rest = StringView<char>(m_buffer).substr(m_begin);
+		size_t end = rest.find('\n', m_scanned);
+		if (end != StringView<char>::NOT_FOUND)
+		{
+			line = rest.substr(0, end);
+			m_begin += end + 1;
+			m_scanned = 0;
+			return true;
+		}
+		m_scanned = rest.length();
+
+		if (!readChunk())
+		{
+			// Return the last line without '\n' unless reading failed, it may have been moved by readChunk
+			if (m_failed || m_begin == m_buffer.length())
+			{
+				return false;
+			}
+			line = StringView<char>(m_buffer).substr(m_begin);
+			m_begin = m_buffer.length();
+			m_scanned = 0;
+			return true;
+		}
+	}
+}
+
+template<class TAllocator>
+bool StringLineReader::next(String<char, TAllocator>& line)
+{
+	StringView<char> view;
+	if (!next(view))
+	{
+		return false;
+	}
+	line.copy(view);
+	return true;
+}
+
+inline bool StringLineReader::failed() const
+{
+	return m_failed;
+}
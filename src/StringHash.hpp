@@ -0,0 +1,177 @@
+/**
+ * @file StringHash.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGHASH_HPP
+#define STRINGHASH_HPP
+
+
+// For memcpy
+#include <cstring>
+// For uint64_t
+#include <cstdint>
+// For std::make_unsigned
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+
+/**
+ * @class StringHash
+ * Fast non-cryptographic hash of byte buffers following the design of wyhash. Buffers of up to 16 bytes are read
+ * using two overlapping loads without a loop, longer ones are consumed in blocks of 48 bytes by three independent
+ * lanes. Each step mixes two 64 bit words by a single 64x64 to 128 bit multiplication, which beats SIMD for the short
+ * keys of hash tables and keeps up with memory bandwidth for long ones. The hash depends on the byte order of the
+ * processor, so it must not be persisted.
+ */
+class StringHash
+{
+private:
+	// Constants of the mixing steps, odd and with balanced bits
+	static const uint64_t SECRET0 = 0x2d358dccaa6c78a5ULL;
+	static const uint64_t SECRET1 = 0x8bb84b93962eacc9ULL;
+	static const uint64_t SECRET2 = 0x4b33a62ed433d4a3ULL;
+	static const uint64_t SECRET3 = 0x4d5a2da51de1aa47ULL;
+
+	/**
+	 * Multiplies two 64 bit words.
+	 * @param	a	First factor, replaced by the low word of the product
+	 * @param	b	Second factor, replaced by the high word of the product
+	 */
+	static void multiply(uint64_t& a, uint64_t& b);
+
+	/**
+	 * Mixes two 64 bit words by folding their product.
+	 * @param	a	First word
+	 * @param	b	Second word
+	 * @return		Low and high word of the product combined
+	 */
+	static uint64_t mix(uint64_t a, uint64_t b);
+
+	/**
+	 * Reads 8 bytes at an arbitrary address.
+	 * @param	bytes	Address of the bytes
+	 * @return		Bytes as a word
+	 */
+	static uint64_t read64(const unsigned char* bytes);
+
+	/**
+	 * Reads 4 bytes at an arbitrary address.
+	 * @param	bytes	Address of the bytes
+	 * @return		Bytes as a word
+	 */
+	static uint64_t read32(const unsigned char* bytes);
+
+	/**
+	 * Calculates the high word of the product of two 64 bit words in a constant expression.
+	 * @param	a	First factor
+	 * @param	b	Second factor
+	 * @return		High word of the product
+	 */
+	static constexpr uint64_t multiplyHighConstant(uint64_t a, uint64_t b);
+
+	/**
+	 * Mixes two 64 bit words like mix in a constant expression.
+	 * @param	a	First word
+	 * @param	b	Second word
+	 * @return		Low and high word of the product combined
+	 */
+	static constexpr uint64_t mixConstant(uint64_t a, uint64_t b);
+
+	/**
+	 * Returns a byte of the memory representation of characters in a constant expression.
+	 * @param	str	Characters
+	 * @param	index	Index of the byte
+	 * @return		Byte as stored in memory
+	 */
+	template<class TChar>
+	static constexpr uint64_t byteConstant(const TChar* str, size_t index);
+
+	/**
+	 * Reads bytes of the memory representation of characters in a constant expression like read32 and read64.
+	 * @param	str	Characters
+	 * @param	index	Index of the first byte
+	 * @param	count	Count of bytes, at most 8
+	 * @return		Bytes as a word in the byte order of the processor
+	 */
+	template<class TChar>
+	static constexpr uint64_t readConstant(const TChar* str, size_t index, size_t count);
+
+	/**
+	 * Combines the last two words of the hash like the end of hash.
+	 * @param	a	First word
+	 * @param	b	Second word
+	 * @param	seed	Mixed seed
+	 * @param	size	Size of the hashed buffer in bytes
+	 * @return		Hash of the buffer
+	 */
+	static constexpr uint64_t finishConstant(uint64_t a, uint64_t b, uint64_t seed, size_t size);
+
+	/**
+	 * Hashes the blocks of 48 bytes of a buffer longer than 48 bytes like the three lanes of hash.
+	 * @param	str		Characters to hash
+	 * @param	size		Size of the characters in bytes
+	 * @param	index		Index of the next block
+	 * @param	seed		Lane 0
+	 * @param	seed1		Lane 1
+	 * @param	seed2		Lane 2
+	 * @return			Hash of the buffer
+	 */
+	template<class TChar>
+	static constexpr uint64_t lanesConstant(const TChar* str, size_t size, size_t index, uint64_t seed, uint64_t seed1,
+		uint64_t seed2);
+
+	/**
+	 * Hashes the remaining blocks of 16 bytes and the last 16 bytes of a buffer longer than 16 bytes.
+	 * @param	str	Characters to hash
+	 * @param	size	Size of the characters in bytes
+	 * @param	index	Index of the next block
+	 * @param	seed	Mixed seed
+	 * @return		Hash of the buffer
+	 */
+	template<class TChar>
+	static constexpr uint64_t tailConstant(const TChar* str, size_t size, size_t index, uint64_t seed);
+
+	/**
+	 * Hashes the memory representation of characters like hash after mixing the seed.
+	 * @param	str	Characters to hash
+	 * @param	size	Size of the characters in bytes
+	 * @param	seed	Mixed seed
+	 * @return		Hash of the buffer
+	 */
+	template<class TChar>
+	static constexpr uint64_t bytesConstant(const TChar* str, size_t size, uint64_t seed);
+
+public:
+	/**
+	 * Calculates the hash of a buffer.
+	 * @param	data	Buffer to hash
+	 * @param	size	Size of the buffer in bytes
+	 * @param	seed	Seed selecting one of many independent hash functions
+	 * @return		Hash of the buffer
+	 */
+	static uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+
+	/**
+	 * Calculates the hash of characters in a constant expression, which equals the hash of their memory
+	 * representation calculated by hash. It is meant for compile-time hashing, calculating it at runtime is slower
+	 * than hash.
+	 * @param	str	Characters to hash
+	 * @param	length	Count of characters
+	 * @param	seed	Seed selecting one of many independent hash functions
+	 * @return		Hash of the characters
+	 */
+	template<class TChar>
+	static constexpr uint64_t hashConstant(const TChar* str, size_t length, uint64_t seed = 0);
+};
+
+
+// Include StringHash class implementation
+#include "StringHash.tpp"
+
+
+#endif // #ifndef STRINGHASH_HPP
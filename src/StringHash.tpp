@@ -0,0 +1,190 @@
+/**
+ * @file StringHash.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGHASH_HPP
+#error STRINGHASH_HPP undefined
+#endif
+
+inline void StringHash::multiply(uint64_t& a, uint64_t& b)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 uint128;
+	uint128 product = static_cast<uint128>(a) * b;
+	a = static_cast<uint64_t>(product);
+	b = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	a = _umul128(a, b, &b);
+#else
+	// Multiply the 32 bit halves and add up the partial products
+	uint64_t aHigh = a >> 32, aLow = static_cast<uint32_t>(a);
+	uint64_t bHigh = b >> 32, bLow = static_cast<uint32_t>(b);
+	uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+	uint64_t middle = (lowLow >> 32) + static_cast<uint32_t>(lowHigh) + static_cast<uint32_t>(highLow);
+	a = (middle << 32) | static_cast<uint32_t>(lowLow);
+	b = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+inline uint64_t StringHash::mix(uint64_t a, uint64_t b)
+{
+	multiply(a, b);
+	return a ^ b;
+}
+
+inline uint64_t StringHash::read64(const unsigned char* bytes)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+inline uint64_t StringHash::read32(const unsigned char* bytes)
+{
+	uint32_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
+}
+
+inline uint64_t StringHash::hash(const void* data, size_t size, uint64_t seed)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	seed ^= mix(seed ^ SECRET0, SECRET1);
+
+	uint64_t a, b;
+	if (size <= 16)
+	{
+		if (size >= 4)
+		{
+			// Two pairs of overlapping loads cover 4 to 16 bytes
+			size_t offset = (size >> 3) << 2;
+			a = (read32(bytes) << 32) | read32(bytes + offset);
+			b = (read32(bytes + size - 4) << 32) | read32(bytes + size - 4 - offset);
+		}
+		else if (size > 0)
+		{
+			a = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[size >> 1]) << 8) | bytes[size - 1];
+			b = 0;
+		}
+		else
+		{
+			a = 0;
+			b = 0;
+		}
+	}
+	else
+	{
+		size_t remaining = size;
+		if (remaining > 48)
+		{
+			// Three independent lanes keep the multipliers busy
+			uint64_t seed1 = seed, seed2 = seed;
+			do
+			{
+				seed = mix(read64(bytes) ^ SECRET1, read64(bytes + 8) ^ seed);
+				seed1 = mix(read64(bytes + 16) ^ SECRET2, read64(bytes + 24) ^ seed1);
+				seed2 = mix(read64(bytes + 32) ^ SECRET3, read64(bytes + 40) ^ seed2);
+				bytes += 48;
+				remaining -= 48;
+			}
+			while (remaining > 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (remaining > 16)
+		{
+			seed = mix(read64(bytes) ^ SECRET1, read64(bytes + 8) ^ seed);
+			bytes += 16;
+			remaining -= 16;
+		}
+
+		// The last 16 bytes overlap the previous block if necessary
+		a = read64(bytes + remaining - 16);
+		b = read64(bytes + remaining - 8);
+	}
+
+	a ^= SECRET1;
+	b ^= seed;
+	multiply(a, b);
+	return mix(a ^ SECRET0 ^ size, b ^ SECRET1);
+}
+
+inline constexpr uint64_t StringHash::multiplyHighConstant(uint64_t a, uint64_t b)
+{
+	// Multiply the 32 bit halves and add up the partial products like the portable multiply
+	return (a >> 32) * (b >> 32) + ((static_cast<uint32_t>(a) * (b >> 32)) >> 32) + (((a >> 32) * static_cast<uint32_t>(b)) >> 32) +
+		((((static_cast<uint64_t>(static_cast<uint32_t>(a)) * static_cast<uint32_t>(b)) >> 32) +
+		static_cast<uint32_t>(static_cast<uint32_t>(a) * (b >> 32)) + static_cast<uint32_t>((a >> 32) * static_cast<uint32_t>(b))) >> 32);
+}
+
+inline constexpr uint64_t StringHash::mixConstant(uint64_t a, uint64_t b)
+{
+	return (a * b) ^ multiplyHighConstant(a, b);
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::byteConstant(const TChar* str, size_t index)
+{
+	// The bytes of a character are stored starting with the least significant one unless the processor is big-endian
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return (static_cast<uint64_t>(static_cast<typename std::make_unsigned<TChar>::type>(str[index / sizeof(TChar)])) >>
+		(8 * (sizeof(TChar) - 1 - index % sizeof(TChar)))) & 0xFF;
+#else
+	return (static_cast<uint64_t>(static_cast<typename std::make_unsigned<TChar>::type>(str[index / sizeof(TChar)])) >>
+		(8 * (index % sizeof(TChar)))) & 0xFF;
+#endif
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::readConstant(const TChar* str, size_t index, size_t count)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return count ? (byteConstant(str, index) << (8 * (count - 1))) | readConstant(str, index + 1, count - 1) : 0;
+#else
+	return count ? byteConstant(str, index) | (readConstant(str, index + 1, count - 1) << 8) : 0;
+#endif
+}
+
+inline constexpr uint64_t StringHash::finishConstant(uint64_t a, uint64_t b, uint64_t seed, size_t size)
+{
+	return mixConstant(((a ^ SECRET1) * (b ^ seed)) ^ SECRET0 ^ size, multiplyHighConstant(a ^ SECRET1, b ^ seed) ^ SECRET1);
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::lanesConstant(const TChar* str, size_t size, size_t index, uint64_t seed, uint64_t seed1,
+	uint64_t seed2)
+{
+	return size - index > 48 ?
+		lanesConstant(str, size, index + 48,
+			mixConstant(readConstant(str, index, 8) ^ SECRET1, readConstant(str, index + 8, 8) ^ seed),
+			mixConstant(readConstant(str, index + 16, 8) ^ SECRET2, readConstant(str, index + 24, 8) ^ seed1),
+			mixConstant(readConstant(str, index + 32, 8) ^ SECRET3, readConstant(str, index + 40, 8) ^ seed2)) :
+		tailConstant(str, size, index, seed ^ seed1 ^ seed2);
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::tailConstant(const TChar* str, size_t size, size_t index, uint64_t seed)
+{
+	return size - index > 16 ?
+		tailConstant(str, size, index + 16, mixConstant(readConstant(str, index, 8) ^ SECRET1, readConstant(str, index + 8, 8) ^ seed)) :
+		finishConstant(readConstant(str, size - 16, 8), readConstant(str, size - 8, 8), seed, size);
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::bytesConstant(const TChar* str, size_t size, uint64_t seed)
+{
+	return size > 48 ? lanesConstant(str, size, 0, seed, seed, seed) :
+		size > 16 ? tailConstant(str, size, 0, seed) :
+		size >= 4 ? finishConstant((readConstant(str, 0, 4) << 32) | readConstant(str, (size >> 3) << 2, 4),
+			(readConstant(str, size - 4, 4) << 32) | readConstant(str, size - 4 - ((size >> 3) << 2), 4), seed, size) :
+		size > 0 ? finishConstant((byteConstant(str, 0) << 16) | (byteConstant(str, size >> 1) << 8) | byteConstant(str, size - 1), 0,
+			seed, size) :
+		finishConstant(0, 0, seed, size);
+}
+
+template<class TChar>
+constexpr uint64_t StringHash::hashConstant(const TChar* str, size_t length, uint64_t seed)
+{
+	return bytesConstant(str, length * sizeof(TChar), seed ^ mixConstant(seed ^ SECRET0, SECRET1));
+}
@@ -0,0 +1,371 @@
+/**
+ * @file StringKernels.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGKERNELS_HPP
+#define STRINGKERNELS_HPP
+
+
+// For memcmp and memcpy
+#include <cstring>
+// For uintptr_t
+#include <cstdint>
+
+
+// Enables the SSE2 and AVX2 kernels on x86 processors, set to 0 to use the scalar kernels only
+#ifndef STRING_SIMD
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define STRING_SIMD 1
+#else
+#define STRING_SIMD 0
+#endif
+#endif
+
+#if STRING_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define STRING_TARGET_AVX2
+#else
+#define STRING_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// The vectorized kernels deliberately read past the end of a string within the same page
+#if defined(__GNUC__) || defined(__clang__)
+#define STRING_NO_SANITIZE __attribute__((no_sanitize_address, no_sanitize_thread))
+#else
+#define STRING_NO_SANITIZE
+#endif
+
+
+/**
+ * @class StringKernels
+ * Collection of the low level c-string routines used by the class String. Each routine is implemented as a scalar
+ * loop and, if STRING_SIMD is enabled, using SSE2 and AVX2. The fastest implementation supported by the processor is
+ * selected once at runtime. Loads past the end of a string never cross a page boundary.
+ */
+template<class TChar>
+class StringKernels
+{
+private:
+	// Size of a page in bytes, loads must not cross its boundaries past the end of a string
+	static const uintptr_t KERNEL_PAGE_SIZE = 4096;
+
+	// Signature of the length kernels
+	typedef size_t (*LengthFunction)(const TChar* str);
+	// Signature of the mismatch kernels
+	typedef size_t (*MismatchFunction)(const TChar* str1, const TChar* str2);
+	// Signature of the mismatchBuffer kernels
+	typedef size_t (*MismatchBufferFunction)(const TChar* str1, const TChar* str2, size_t length);
+	// Signature of the equal kernels
+	typedef bool (*EqualFunction)(const TChar* str1, const TChar* str2, size_t length);
+	// Signature of the find kernels
+	typedef size_t (*FindFunction)(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength);
+	// Signature of the case conversion kernels
+	typedef void (*CaseFunction)(TChar* str, size_t length, TChar first);
+
+	/**
+	 * Checks if the processor and the operating system support AVX2.
+	 * @return	true if AVX2 is supported, otherwise false
+	 */
+	static bool supportsAvx2();
+
+	/**
+	 * Checks if a vector of a given size can be loaded from an address without crossing a page boundary.
+	 * @param	address		Address to load from
+	 * @param	vectorSize	Size of the vector in bytes
+	 * @return			true if the load stays within the page, otherwise false
+	 */
+	static bool isPageSafe(const void* address, size_t vectorSize);
+
+	/**
+	 * Returns the index of the lowest set bit of a non-zero mask.
+	 * @param	mask	Mask to scan
+	 * @return		Index of the lowest set bit
+	 */
+	static unsigned int firstBit(unsigned int mask);
+
+#if STRING_SIMD
+	/**
+	 * Compares the characters of two SSE2 vectors for equality.
+	 * @param	a	First vector
+	 * @param	b	Second vector
+	 * @return		Vector with all bits of equal characters set
+	 */
+	static __m128i compareSse2(__m128i a, __m128i b);
+
+	/**
+	 * Compares the characters of two AVX2 vectors for equality.
+	 * @param	a	First vector
+	 * @param	b	Second vector
+	 * @return		Vector with all bits of equal characters set
+	 */
+	STRING_TARGET_AVX2 static __m256i compareAvx2(__m256i a, __m256i b);
+
+	/**
+	 * Compares the characters of two SSE2 vectors as signed integers.
+	 * @param	a	First vector
+	 * @param	b	Second vector
+	 * @return		Vector with all bits of the characters of a greater than the ones of b set
+	 */
+	static __m128i greaterSse2(__m128i a, __m128i b);
+
+	/**
+	 * Compares the characters of two AVX2 vectors as signed integers.
+	 * @param	a	First vector
+	 * @param	b	Second vector
+	 * @return		Vector with all bits of the characters of a greater than the ones of b set
+	 */
+	STRING_TARGET_AVX2 static __m256i greaterAvx2(__m256i a, __m256i b);
+
+	/**
+	 * Fills all characters of an SSE2 vector with a character.
+	 * @param	c	Character to fill the vector with
+	 * @return		Vector filled with c
+	 */
+	static __m128i broadcastSse2(TChar c);
+
+	/**
+	 * Fills all characters of an AVX2 vector with a character.
+	 * @param	c	Character to fill the vector with
+	 * @return		Vector filled with c
+	 */
+	STRING_TARGET_AVX2 static __m256i broadcastAvx2(TChar c);
+#endif
+
+public:
+	// Position returned by find if the needle does not occur
+	static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+	/**
+	 * Returns the name of the instruction set used by the selected kernels.
+	 * @return	"avx2", "sse2" or "scalar"
+	 */
+	static const char* implementation();
+
+	/**
+	 * Calculates the length of a zero-terminated c-string.
+	 * @param	str	C-string to calculate the length for
+	 * @return		Length of the c-string in characters
+	 */
+	static size_t length(const TChar* str);
+
+	/**
+	 * Searches the first position at which two zero-terminated c-strings differ or the first one ends.
+	 * @param	str1	First c-string
+	 * @param	str2	Second c-string
+	 * @return		Index of the first differing character or the terminating 0 of str1
+	 */
+	static size_t mismatch(const TChar* str1, const TChar* str2);
+
+	/**
+	 * Searches the first position at which two buffers of the same length differ. The buffers are not required to be
+	 * zero-terminated.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		Index of the first differing character, length if both buffers are equal
+	 */
+	static size_t mismatchBuffer(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * Checks if two buffers of the same length contain the same characters. The buffers are not required to be
+	 * zero-terminated.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		true if both buffers are equal, otherwise false
+	 */
+	static bool equal(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * Searches the first occurrence of a needle in a buffer. Candidates are filtered by comparing the first and the
+	 * last character of the needle to a whole vector of positions at once, only matching candidates are compared
+	 * completely. Neither buffer is required to be zero-terminated and no character behind the haystack is read.
+	 * @param	haystack	Buffer to search in
+	 * @param	length		Length of the haystack in characters
+	 * @param	needle		Buffer to search
+	 * @param	needleLength	Length of the needle in characters, must not be 0
+	 * @return			Position of the first occurrence, NOT_FOUND if the needle does not occur
+	 */
+	static size_t find(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength);
+
+	/**
+	 * Converts the ASCII letters A to Z of a buffer to lower case in place, other characters are kept.
+	 * @param	str	Buffer to convert, which is not required to be zero-terminated
+	 * @param	length	Length of the buffer in characters
+	 */
+	static void toLower(TChar* str, size_t length);
+
+	/**
+	 * Converts the ASCII letters a to z of a buffer to upper case in place, other characters are kept.
+	 * @param	str	Buffer to convert, which is not required to be zero-terminated
+	 * @param	length	Length of the buffer in characters
+	 */
+	static void toUpper(TChar* str, size_t length);
+
+	/**
+	 * Scalar implementation of length.
+	 * @param	str	C-string to calculate the length for
+	 * @return		Length of the c-string in characters
+	 */
+	static size_t lengthScalar(const TChar* str);
+
+	/**
+	 * Scalar implementation of mismatch.
+	 * @param	str1	First c-string
+	 * @param	str2	Second c-string
+	 * @return		Index of the first differing character or the terminating 0 of str1
+	 */
+	static size_t mismatchScalar(const TChar* str1, const TChar* str2);
+
+	/**
+	 * Scalar implementation of mismatchBuffer.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		Index of the first differing character, length if both buffers are equal
+	 */
+	static size_t mismatchBufferScalar(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * Scalar implementation of equal.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		true if both buffers are equal, otherwise false
+	 */
+	static bool equalScalar(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * Scalar implementation of find.
+	 * @param	haystack	Buffer to search in
+	 * @param	length		Length of the haystack in characters
+	 * @param	needle		Buffer to search
+	 * @param	needleLength	Length of the needle in characters, must not be 0
+	 * @return			Position of the first occurrence, NOT_FOUND if the needle does not occur
+	 */
+	static size_t findScalar(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength);
+
+	/**
+	 * Scalar implementation of the case conversion, which toggles the case of the 26 letters starting at first.
+	 * @param	str	Buffer to convert
+	 * @param	length	Length of the buffer in characters
+	 * @param	first	'A' to convert to lower case, 'a' to convert to upper case
+	 */
+	static void convertCaseScalar(TChar* str, size_t length, TChar first);
+
+#if STRING_SIMD
+	/**
+	 * SSE2 implementation of length.
+	 * @param	str	C-string to calculate the length for
+	 * @return		Length of the c-string in characters
+	 */
+	STRING_NO_SANITIZE static size_t lengthSse2(const TChar* str);
+
+	/**
+	 * SSE2 implementation of mismatch.
+	 * @param	str1	First c-string
+	 * @param	str2	Second c-string
+	 * @return		Index of the first differing character or the terminating 0 of str1
+	 */
+	STRING_NO_SANITIZE static size_t mismatchSse2(const TChar* str1, const TChar* str2);
+
+	/**
+	 * SSE2 implementation of mismatchBuffer.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		Index of the first differing character, length if both buffers are equal
+	 */
+	static size_t mismatchBufferSse2(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * SSE2 implementation of equal.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		true if both buffers are equal, otherwise false
+	 */
+	static bool equalSse2(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * SSE2 implementation of find.
+	 * @param	haystack	Buffer to search in
+	 * @param	length		Length of the haystack in characters
+	 * @param	needle		Buffer to search
+	 * @param	needleLength	Length of the needle in characters, must not be 0
+	 * @return			Position of the first occurrence, NOT_FOUND if the needle does not occur
+	 */
+	static size_t findSse2(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength);
+
+	/**
+	 * SSE2 implementation of the case conversion.
+	 * @param	str	Buffer to convert
+	 * @param	length	Length of the buffer in characters
+	 * @param	first	'A' to convert to lower case, 'a' to convert to upper case
+	 */
+	static void convertCaseSse2(TChar* str, size_t length, TChar first);
+
+	/**
+	 * AVX2 implementation of length. Must only be called if the processor supports AVX2.
+	 * @param	str	C-string to calculate the length for
+	 * @return		Length of the c-string in characters
+	 */
+	STRING_TARGET_AVX2 STRING_NO_SANITIZE static size_t lengthAvx2(const TChar* str);
+
+	/**
+	 * AVX2 implementation of mismatch. Must only be called if the processor supports AVX2.
+	 * @param	str1	First c-string
+	 * @param	str2	Second c-string
+	 * @return		Index of the first differing character or the terminating 0 of str1
+	 */
+	STRING_TARGET_AVX2 STRING_NO_SANITIZE static size_t mismatchAvx2(const TChar* str1, const TChar* str2);
+
+	/**
+	 * AVX2 implementation of mismatchBuffer. Must only be called if the processor supports AVX2.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		Index of the first differing character, length if both buffers are equal
+	 */
+	STRING_TARGET_AVX2 static size_t mismatchBufferAvx2(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * AVX2 implementation of equal. Must only be called if the processor supports AVX2.
+	 * @param	str1	First buffer
+	 * @param	str2	Second buffer
+	 * @param	length	Length of both buffers in characters
+	 * @return		true if both buffers are equal, otherwise false
+	 */
+	STRING_TARGET_AVX2 static bool equalAvx2(const TChar* str1, const TChar* str2, size_t length);
+
+	/**
+	 * AVX2 implementation of find. Must only be called if the processor supports AVX2.
+	 * @param	haystack	Buffer to search in
+	 * @param	length		Length of the haystack in characters
+	 * @param	needle		Buffer to search
+	 * @param	needleLength	Length of the needle in characters, must not be 0
+	 * @return			Position of the first occurrence, NOT_FOUND if the needle does not occur
+	 */
+	STRING_TARGET_AVX2 static size_t findAvx2(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength);
+
+	/**
+	 * AVX2 implementation of the case conversion. Must only be called if the processor supports AVX2.
+	 * @param	str	Buffer to convert
+	 * @param	length	Length of the buffer in characters
+	 * @param	first	'A' to convert to lower case, 'a' to convert to upper case
+	 */
+	STRING_TARGET_AVX2 static void convertCaseAvx2(TChar* str, size_t length, TChar first);
+#endif
+};
+
+
+// Include StringKernels class implementation
+#include "StringKernels.tpp"
+
+
+#endif // #ifndef STRINGKERNELS_HPP
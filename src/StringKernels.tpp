@@ -0,0 +1,697 @@
+/**
+ * @file StringKernels.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGKERNELS_HPP
+#error STRINGKERNELS_HPP undefined
+#endif
+
+template<class TChar>
+const size_t StringKernels<TChar>::NOT_FOUND;
+
+template<class TChar>
+bool StringKernels<TChar>::supportsAvx2()
+{
+#if STRING_SIMD && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+	// The operating system has to save the AVX registers (OSXSAVE and AVX bits, XMM and YMM state)
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+	{
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#elif STRING_SIMD
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+template<class TChar>
+bool StringKernels<TChar>::isPageSafe(const void* address, size_t vectorSize)
+{
+	return (reinterpret_cast<uintptr_t>(address) & (KERNEL_PAGE_SIZE - 1)) <= KERNEL_PAGE_SIZE - vectorSize;
+}
+
+template<class TChar>
+unsigned int StringKernels<TChar>::firstBit(unsigned int mask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return static_cast<unsigned int>(index);
+#else
+	return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+#if STRING_SIMD
+template<class TChar>
+__m128i StringKernels<TChar>::compareSse2(__m128i a, __m128i b)
+{
+	return sizeof(TChar) == 1 ? _mm_cmpeq_epi8(a, b) : sizeof(TChar) == 2 ? _mm_cmpeq_epi16(a, b) : _mm_cmpeq_epi32(a, b);
+}
+
+template<class TChar>
+__m256i StringKernels<TChar>::compareAvx2(__m256i a, __m256i b)
+{
+	return sizeof(TChar) == 1 ? _mm256_cmpeq_epi8(a, b) : sizeof(TChar) == 2 ? _mm256_cmpeq_epi16(a, b) : _mm256_cmpeq_epi32(a, b);
+}
+
+template<class TChar>
+__m128i StringKernels<TChar>::greaterSse2(__m128i a, __m128i b)
+{
+	return sizeof(TChar) == 1 ? _mm_cmpgt_epi8(a, b) : sizeof(TChar) == 2 ? _mm_cmpgt_epi16(a, b) : _mm_cmpgt_epi32(a, b);
+}
+
+template<class TChar>
+__m256i StringKernels<TChar>::greaterAvx2(__m256i a, __m256i b)
+{
+	return sizeof(TChar) == 1 ? _mm256_cmpgt_epi8(a, b) : sizeof(TChar) == 2 ? _mm256_cmpgt_epi16(a, b) : _mm256_cmpgt_epi32(a, b);
+}
+
+template<class TChar>
+__m128i StringKernels<TChar>::broadcastSse2(TChar c)
+{
+	return sizeof(TChar) == 1 ? _mm_set1_epi8(static_cast<char>(c)) : sizeof(TChar) == 2 ? _mm_set1_epi16(static_cast<short>(c)) : _mm_set1_epi32(static_cast<int>(c));
+}
+
+template<class TChar>
+__m256i StringKernels<TChar>::broadcastAvx2(TChar c)
+{
+	return sizeof(TChar) == 1 ? _mm256_set1_epi8(static_cast<char>(c)) : sizeof(TChar) == 2 ? _mm256_set1_epi16(static_cast<short>(c)) : _mm256_set1_epi32(static_cast<int>(c));
+}
+#endif
+
+template<class TChar>
+const char* StringKernels<TChar>::implementation()
+{
+#if STRING_SIMD
+	return supportsAvx2() ? "avx2" : "sse2";
+#else
+	return "scalar";
+#endif
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::length(const TChar* str)
+{
+#if STRING_SIMD
+	static const LengthFunction function = supportsAvx2() ? lengthAvx2 : lengthSse2;
+	return function(str);
+#else
+	return lengthScalar(str);
+#endif
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatch(const TChar* str1, const TChar* str2)
+{
+#if STRING_SIMD
+	static const MismatchFunction function = supportsAvx2() ? mismatchAvx2 : mismatchSse2;
+	return function(str1, str2);
+#else
+	return mismatchScalar(str1, str2);
+#endif
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchBuffer(const TChar* str1, const TChar* str2, size_t length)
+{
+#if STRING_SIMD
+	static const MismatchBufferFunction function = supportsAvx2() ? mismatchBufferAvx2 : mismatchBufferSse2;
+	return function(str1, str2, length);
+#else
+	return mismatchBufferScalar(str1, str2, length);
+#endif
+}
+
+template<class TChar>
+bool StringKernels<TChar>::equal(const TChar* str1, const TChar* str2, size_t length)
+{
+#if STRING_SIMD
+	static const EqualFunction function = supportsAvx2() ? equalAvx2 : equalSse2;
+	return function(str1, str2, length);
+#else
+	return equalScalar(str1, str2, length);
+#endif
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::find(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength)
+{
+#if STRING_SIMD
+	static const FindFunction function = supportsAvx2() ? findAvx2 : findSse2;
+	return function(haystack, length, needle, needleLength);
+#else
+	return findScalar(haystack, length, needle, needleLength);
+#endif
+}
+
+template<class TChar>
+void StringKernels<TChar>::toLower(TChar* str, size_t length)
+{
+#if STRING_SIMD
+	static const CaseFunction function = supportsAvx2() ? convertCaseAvx2 : convertCaseSse2;
+	function(str, length, static_cast<TChar>('A'));
+#else
+	convertCaseScalar(str, length, static_cast<TChar>('A'));
+#endif
+}
+
+template<class TChar>
+void StringKernels<TChar>::toUpper(TChar* str, size_t length)
+{
+#if STRING_SIMD
+	static const CaseFunction function = supportsAvx2() ? convertCaseAvx2 : convertCaseSse2;
+	function(str, length, static_cast<TChar>('a'));
+#else
+	convertCaseScalar(str, length, static_cast<TChar>('a'));
+#endif
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::lengthScalar(const TChar* str)
+{
+	size_t length = 0;
+	while (str[length] != static_cast<TChar>(0))
+	{
+		length++;
+	}
+	return length;
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchScalar(const TChar* str1, const TChar* str2)
+{
+	size_t index = 0;
+	while (str1[index] && str1[index] == str2[index])
+	{
+		index++;
+	}
+	return index;
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchBufferScalar(const TChar* str1, const TChar* str2, size_t length)
+{
+	size_t index = 0;
+	while (index < length && str1[index] == str2[index])
+	{
+		index++;
+	}
+	return index;
+}
+
+template<class TChar>
+bool StringKernels<TChar>::equalScalar(const TChar* str1, const TChar* str2, size_t length)
+{
+	return 0 == memcmp(str1, str2, length * sizeof(TChar));
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::findScalar(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength)
+{
+	if (needleLength > length)
+	{
+		return NOT_FOUND;
+	}
+	TChar first = needle[0];
+	TChar last = needle[needleLength - 1];
+	for (size_t pos = 0, end = length - needleLength; pos <= end; pos++)
+	{
+		if (haystack[pos] == first && haystack[pos + needleLength - 1] == last &&
+			equalScalar(haystack + pos + 1, needle + 1, needleLength < 2 ? 0 : needleLength - 2))
+		{
+			return pos;
+		}
+	}
+	return NOT_FOUND;
+}
+
+template<class TChar>
+void StringKernels<TChar>::convertCaseScalar(TChar* str, size_t length, TChar first)
+{
+	// Upper and lower case letters differ in bit 5 only
+	for (size_t i = 0; i < length; i++)
+	{
+		if (static_cast<unsigned long>(str[i] - first) < 26)
+		{
+			str[i] ^= 0x20;
+		}
+	}
+}
+
+#if STRING_SIMD
+template<class TChar>
+size_t StringKernels<TChar>::lengthSse2(const TChar* str)
+{
+	// Characters crossing the vector lanes cannot be compared
+	if (reinterpret_cast<uintptr_t>(str) % sizeof(TChar))
+	{
+		return lengthScalar(str);
+	}
+
+	// Aligned loads never cross a page boundary, the first one may start in front of str
+	const char* start = reinterpret_cast<const char*>(str);
+	unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(start) & 15);
+	const __m128i* block = reinterpret_cast<const __m128i*>(start - offset);
+	const __m128i zero = _mm_setzero_si128();
+
+	// Ignore the bytes in front of str
+	unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(_mm_load_si128(block), zero))) >> offset;
+	if (mask)
+	{
+		return firstBit(mask) / sizeof(TChar);
+	}
+	block++;
+
+	// Check single vectors until four of them can be checked at once without crossing a page boundary
+	while (reinterpret_cast<uintptr_t>(block) & 63)
+	{
+		mask = static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(_mm_load_si128(block), zero)));
+		if (mask)
+		{
+			return (reinterpret_cast<const char*>(block) - start + firstBit(mask)) / sizeof(TChar);
+		}
+		block++;
+	}
+	for (;;)
+	{
+		__m128i found = _mm_or_si128(
+			_mm_or_si128(compareSse2(_mm_load_si128(block), zero), compareSse2(_mm_load_si128(block + 1), zero)),
+			_mm_or_si128(compareSse2(_mm_load_si128(block + 2), zero), compareSse2(_mm_load_si128(block + 3), zero)));
+		if (_mm_movemask_epi8(found))
+		{
+			for (;; block++)
+			{
+				mask = static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(_mm_load_si128(block), zero)));
+				if (mask)
+				{
+					return (reinterpret_cast<const char*>(block) - start + firstBit(mask)) / sizeof(TChar);
+				}
+			}
+		}
+		block += 4;
+	}
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchSse2(const TChar* str1, const TChar* str2)
+{
+	const size_t step = 16 / sizeof(TChar);
+	const __m128i zero = _mm_setzero_si128();
+	size_t index = 0;
+	for (;;)
+	{
+		if (isPageSafe(str1 + index, 16) && isPageSafe(str2 + index, 16))
+		{
+			__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + index));
+			__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + index));
+
+			// Mark differing characters and the end of str1
+			unsigned int mask = (~static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(vector1, vector2))) & 0xFFFF) |
+				static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(vector1, zero)));
+			if (mask)
+			{
+				return index + firstBit(mask) / sizeof(TChar);
+			}
+			index += step;
+		}
+		else
+		{
+			// Step over the page boundary character by character
+			for (size_t end = index + step; index < end; index++)
+			{
+				if (!str1[index] || str1[index] != str2[index])
+				{
+					return index;
+				}
+			}
+		}
+	}
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchBufferSse2(const TChar* str1, const TChar* str2, size_t length)
+{
+	const size_t step = 16 / sizeof(TChar);
+	if (length < step)
+	{
+		return mismatchBufferScalar(str1, str2, length);
+	}
+
+	size_t index = 0;
+	for (; index + step <= length; index += step)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + index));
+		unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(vector1, vector2))) & 0xFFFF;
+		if (mask)
+		{
+			return index + firstBit(mask) / sizeof(TChar);
+		}
+	}
+	if (index < length)
+	{
+		// Compare the remaining characters using a vector overlapping the previous one
+		index = length - step;
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + index));
+		unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(compareSse2(vector1, vector2))) & 0xFFFF;
+		if (mask)
+		{
+			return index + firstBit(mask) / sizeof(TChar);
+		}
+	}
+	return length;
+}
+
+template<class TChar>
+bool StringKernels<TChar>::equalSse2(const TChar* str1, const TChar* str2, size_t length)
+{
+	size_t size = length * sizeof(TChar);
+	if (size < 16)
+	{
+		return equalScalar(str1, str2, length);
+	}
+
+	const char* bytes1 = reinterpret_cast<const char*>(str1);
+	const char* bytes2 = reinterpret_cast<const char*>(str2);
+	size_t offset = 0;
+	for (; offset + 16 <= size; offset += 16)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes1 + offset));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes2 + offset));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(vector1, vector2)) != 0xFFFF)
+		{
+			return false;
+		}
+	}
+	if (offset < size)
+	{
+		// Compare the remaining bytes using a vector overlapping the previous one
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes1 + size - 16));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes2 + size - 16));
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(vector1, vector2)) == 0xFFFF;
+	}
+	return true;
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::findSse2(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength)
+{
+	const size_t step = 16 / sizeof(TChar);
+	if (needleLength > length || reinterpret_cast<uintptr_t>(haystack) % sizeof(TChar))
+	{
+		return findScalar(haystack, length, needle, needleLength);
+	}
+
+	const __m128i first = broadcastSse2(needle[0]);
+	const __m128i last = broadcastSse2(needle[needleLength - 1]);
+	size_t positions = length - needleLength + 1;
+	size_t pos = 0;
+	for (; pos + step <= positions; pos += step)
+	{
+		// Mark the positions matching the first and the last character of the needle
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + pos));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + pos + needleLength - 1));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(compareSse2(blockFirst, first), compareSse2(blockLast, last))));
+		while (mask)
+		{
+			unsigned int bit = firstBit(mask);
+			size_t candidate = pos + bit / sizeof(TChar);
+			if (needleLength < 3 || equalScalar(haystack + candidate + 1, needle + 1, needleLength - 2))
+			{
+				return candidate;
+			}
+			mask &= ~(((1u << sizeof(TChar)) - 1) << bit);
+		}
+	}
+
+	// Check the remaining positions, which do not fill a vector
+	size_t found = findScalar(haystack + pos, length - pos, needle, needleLength);
+	return NOT_FOUND == found ? NOT_FOUND : pos + found;
+}
+
+template<class TChar>
+void StringKernels<TChar>::convertCaseSse2(TChar* str, size_t length, TChar first)
+{
+	const size_t step = 16 / sizeof(TChar);
+	if (length < step)
+	{
+		convertCaseScalar(str, length, first);
+		return;
+	}
+
+	// Letters lie between the characters in front of first and behind the 26th letter, wider characters are negative
+	const __m128i below = broadcastSse2(static_cast<TChar>(first - 1));
+	const __m128i above = broadcastSse2(static_cast<TChar>(first + 26));
+	const __m128i bit = broadcastSse2(static_cast<TChar>(0x20));
+	for (size_t index = 0; index < length; index += step)
+	{
+		// The last vector may overlap the previous one, converted letters are not converted back
+		__m128i* block = reinterpret_cast<__m128i*>(index + step <= length ? str + index : str + length - step);
+		__m128i vector = _mm_loadu_si128(block);
+		__m128i letters = _mm_and_si128(greaterSse2(vector, below), greaterSse2(above, vector));
+		_mm_storeu_si128(block, _mm_xor_si128(vector, _mm_and_si128(letters, bit)));
+	}
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::lengthAvx2(const TChar* str)
+{
+	// Characters crossing the vector lanes cannot be compared
+	if (reinterpret_cast<uintptr_t>(str) % sizeof(TChar))
+	{
+		return lengthScalar(str);
+	}
+
+	// Aligned loads never cross a page boundary, the first one may start in front of str
+	const char* start = reinterpret_cast<const char*>(str);
+	unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(start) & 31);
+	const __m256i* block = reinterpret_cast<const __m256i*>(start - offset);
+	const __m256i zero = _mm256_setzero_si256();
+
+	// Ignore the bytes in front of str
+	unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(_mm256_load_si256(block), zero))) >> offset;
+	if (mask)
+	{
+		return firstBit(mask) / sizeof(TChar);
+	}
+	block++;
+
+	// Check single vectors until four of them can be checked at once without crossing a page boundary
+	while (reinterpret_cast<uintptr_t>(block) & 127)
+	{
+		mask = static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(_mm256_load_si256(block), zero)));
+		if (mask)
+		{
+			return (reinterpret_cast<const char*>(block) - start + firstBit(mask)) / sizeof(TChar);
+		}
+		block++;
+	}
+	for (;;)
+	{
+		__m256i found = _mm256_or_si256(
+			_mm256_or_si256(compareAvx2(_mm256_load_si256(block), zero), compareAvx2(_mm256_load_si256(block + 1), zero)),
+			_mm256_or_si256(compareAvx2(_mm256_load_si256(block + 2), zero), compareAvx2(_mm256_load_si256(block + 3), zero)));
+		if (_mm256_movemask_epi8(found))
+		{
+			for (;; block++)
+			{
+				mask = static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(_mm256_load_si256(block), zero)));
+				if (mask)
+				{
+					return (reinterpret_cast<const char*>(block) - start + firstBit(mask)) / sizeof(TChar);
+				}
+			}
+		}
+		block += 4;
+	}
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchAvx2(const TChar* str1, const TChar* str2)
+{
+	const size_t step = 32 / sizeof(TChar);
+	const __m256i zero = _mm256_setzero_si256();
+	size_t index = 0;
+	for (;;)
+	{
+		if (isPageSafe(str1 + index, 32) && isPageSafe(str2 + index, 32))
+		{
+			__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str1 + index));
+			__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str2 + index));
+
+			// Mark differing characters and the end of str1
+			unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(vector1, vector2))) |
+				static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(vector1, zero)));
+			if (mask)
+			{
+				return index + firstBit(mask) / sizeof(TChar);
+			}
+			index += step;
+		}
+		else
+		{
+			// Step over the page boundary character by character
+			for (size_t end = index + step; index < end; index++)
+			{
+				if (!str1[index] || str1[index] != str2[index])
+				{
+					return index;
+				}
+			}
+		}
+	}
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::mismatchBufferAvx2(const TChar* str1, const TChar* str2, size_t length)
+{
+	const size_t step = 32 / sizeof(TChar);
+	if (length < step)
+	{
+		return mismatchBufferSse2(str1, str2, length);
+	}
+
+	size_t index = 0;
+	for (; index + step <= length; index += step)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str2 + index));
+		unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(vector1, vector2)));
+		if (mask)
+		{
+			return index + firstBit(mask) / sizeof(TChar);
+		}
+	}
+	if (index < length)
+	{
+		// Compare the remaining characters using a vector overlapping the previous one
+		index = length - step;
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str2 + index));
+		unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(compareAvx2(vector1, vector2)));
+		if (mask)
+		{
+			return index + firstBit(mask) / sizeof(TChar);
+		}
+	}
+	return length;
+}
+
+template<class TChar>
+bool StringKernels<TChar>::equalAvx2(const TChar* str1, const TChar* str2, size_t length)
+{
+	size_t size = length * sizeof(TChar);
+	if (size < 32)
+	{
+		return equalSse2(str1, str2, length);
+	}
+
+	const char* bytes1 = reinterpret_cast<const char*>(str1);
+	const char* bytes2 = reinterpret_cast<const char*>(str2);
+	size_t offset = 0;
+	for (; offset + 128 <= size; offset += 128)
+	{
+		const __m256i* block1 = reinterpret_cast<const __m256i*>(bytes1 + offset);
+		const __m256i* block2 = reinterpret_cast<const __m256i*>(bytes2 + offset);
+		__m256i same = _mm256_and_si256(
+			_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256(block1), _mm256_loadu_si256(block2)),
+				_mm256_cmpeq_epi8(_mm256_loadu_si256(block1 + 1), _mm256_loadu_si256(block2 + 1))),
+			_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256(block1 + 2), _mm256_loadu_si256(block2 + 2)),
+				_mm256_cmpeq_epi8(_mm256_loadu_si256(block1 + 3), _mm256_loadu_si256(block2 + 3))));
+		if (static_cast<unsigned int>(_mm256_movemask_epi8(same)) != 0xFFFFFFFFu)
+		{
+			return false;
+		}
+	}
+	for (; offset + 32 <= size; offset += 32)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes1 + offset));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes2 + offset));
+		if (static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vector1, vector2))) != 0xFFFFFFFFu)
+		{
+			return false;
+		}
+	}
+	if (offset < size)
+	{
+		// Compare the remaining bytes using a vector overlapping the previous one
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes1 + size - 32));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes2 + size - 32));
+		return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vector1, vector2))) == 0xFFFFFFFFu;
+	}
+	return true;
+}
+
+template<class TChar>
+size_t StringKernels<TChar>::findAvx2(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength)
+{
+	const size_t step = 32 / sizeof(TChar);
+	if (needleLength > length || reinterpret_cast<uintptr_t>(haystack) % sizeof(TChar))
+	{
+		return findScalar(haystack, length, needle, needleLength);
+	}
+
+	const __m256i first = broadcastAvx2(needle[0]);
+	const __m256i last = broadcastAvx2(needle[needleLength - 1]);
+	size_t positions = length - needleLength + 1;
+	size_t pos = 0;
+	for (; pos + step <= positions; pos += step)
+	{
+		// Mark the positions matching the first and the last character of the needle
+		__m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + pos));
+		__m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + pos + needleLength - 1));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(compareAvx2(blockFirst, first), compareAvx2(blockLast, last))));
+		while (mask)
+		{
+			unsigned int bit = firstBit(mask);
+			size_t candidate = pos + bit / sizeof(TChar);
+			if (needleLength < 3 || equalScalar(haystack + candidate + 1, needle + 1, needleLength - 2))
+			{
+				return candidate;
+			}
+			mask &= ~(((1u << sizeof(TChar)) - 1) << bit);
+		}
+	}
+
+	// Check the remaining positions, which do not fill a vector
+	size_t found = findScalar(haystack + pos, length - pos, needle, needleLength);
+	return NOT_FOUND == found ? NOT_FOUND : pos + found;
+}
+
+template<class TChar>
+void StringKernels<TChar>::convertCaseAvx2(TChar* str, size_t length, TChar first)
+{
+	const size_t step = 32 / sizeof(TChar);
+	if (length < step)
+	{
+		convertCaseSse2(str, length, first);
+		return;
+	}
+
+	const __m256i below = broadcastAvx2(static_cast<TChar>(first - 1));
+	const __m256i above = broadcastAvx2(static_cast<TChar>(first + 26));
+	const __m256i bit = broadcastAvx2(static_cast<TChar>(0x20));
+	for (size_t index = 0; index < length; index += step)
+	{
+		// The last vector may overlap the previous one, converted letters are not converted back
+		__m256i* block = reinterpret_cast<__m256i*>(index + step <= length ? str + index : str + length - step);
+		__m256i vector = _mm256_loadu_si256(block);
+		__m256i letters = _mm256_and_si256(greaterAvx2(vector, below), greaterAvx2(above, vector));
+		_mm256_storeu_si256(block, _mm256_xor_si256(vector, _mm256_and_si256(letters, bit)));
+	}
+}
+#endif
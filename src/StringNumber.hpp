@@ -0,0 +1,330 @@
+/**
+ * @file StringNumber.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGNUMBER_HPP
+#define STRINGNUMBER_HPP
+
+
+// For memcpy
+#include <cstring>
+// For size_t
+#include <cstddef>
+// For uint64_t
+#include <cstdint>
+// For std::numeric_limits
+#include <limits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+
+/**
+ * @class StringNumber
+ * Conversion between numbers and their decimal representation without allocating and independent of the locale.
+ * Integers are written two digits at a time using a table of digit pairs. Doubles are written using Ryu, which finds
+ * the shortest representation that parses back to the same double using 128 bit multiplications by tables of powers
+ * of 5, and formatted like JavaScript does: fixed-point notation for decimal exponents from -6 to 20, otherwise
+ * scientific notation. Doubles are parsed by exact double arithmetic if possible and otherwise by the reverse
+ * algorithm of Ryu on the same tables, inputs with more than 17 significant digits are rounded correctly by comparing
+ * them to the halfway point between the candidates using big integers on the stack.
+ */
+class StringNumber
+{
+private:
+	// Bits of the mantissa and the exponent and bias of the exponent of a double
+	enum { MANTISSA_BITS = 52, EXPONENT_BITS = 11, EXPONENT_BIAS = 1023 };
+	// Bits of the normalized powers of 5 and their inverses in the tables
+	enum { POW5_BITS = 125, POW5_INVERSE_BITS = 125 };
+	// Count of entries of the tables of powers of 5 and their inverses
+	enum { POW5_COUNT = 326, POW5_INVERSE_COUNT = 342 };
+	// Significant digits parsed into the mantissa of a double, further digits are compared using big integers
+	enum { PARSE_DIGITS = 17 };
+	// Digits of a decimal compared using big integers, a halfway point between two doubles has at most 767
+	enum { COMPARE_DIGITS = 800 };
+
+	/**
+	 * @struct Decimal
+	 * Decimal representation of a positive double as mantissa * 10^exponent.
+	 */
+	struct Decimal
+	{
+		// Decimal digits
+		uint64_t mantissa;
+		// Power of 10 of the last digit
+		int32_t exponent;
+	};
+
+	/**
+	 * @class BigInteger
+	 * Unsigned integer of up to 4096 bits stored on the stack, which is used to compare long decimals to doubles.
+	 */
+	class BigInteger
+	{
+	private:
+		// Count of 32 bit words
+		enum { WORDS = 128 };
+
+		// Words starting with the least significant one
+		uint32_t m_words[WORDS];
+		// Count of used words
+		size_t m_size;
+
+	public:
+		/**
+		 * Constructor which creates a big integer from a 64 bit integer.
+		 * @param	value	Initial value
+		 */
+		BigInteger(uint64_t value);
+
+		/**
+		 * Multiplies the big integer by a factor and adds a summand.
+		 * @param	factor	Factor to multiply by
+		 * @param	summand	Summand to add
+		 */
+		void multiplyAdd(uint32_t factor, uint32_t summand = 0);
+
+		/**
+		 * Multiplies the big integer by a power of 5.
+		 * @param	exponent	Exponent of the power of 5
+		 */
+		void multiplyPow5(uint32_t exponent);
+
+		/**
+		 * Multiplies the big integer by a power of 2.
+		 * @param	exponent	Exponent of the power of 2
+		 */
+		void shiftLeft(uint32_t exponent);
+
+		/**
+		 * Compares the big integer to another one.
+		 * @param	other	Big integer to compare to
+		 * @return		Negative, zero or positive if the big integer is less than, equal to or greater than other
+		 */
+		int compare(const BigInteger& other) const;
+	};
+
+	/**
+	 * Returns the table of the decimal representations of 0 to 99 as pairs of characters.
+	 * @return	Table of 200 characters
+	 */
+	static const char* digitPairs();
+
+	/**
+	 * Returns the table of the powers 5^0 to 5^325 normalized to 125 bits, rounded down.
+	 * @return	Table of low and high words
+	 */
+	static const uint64_t (*pow5Table())[2];
+
+	/**
+	 * Returns the table of the inverse powers 5^0 to 5^-341 normalized to 125 bits, rounded up.
+	 * @return	Table of low and high words
+	 */
+	static const uint64_t (*pow5InverseTable())[2];
+
+	/**
+	 * Calculates the count of bits of 5^exponent.
+	 * @param	exponent	Exponent from 0 to 3528
+	 * @return			ceil(log2(5^exponent)), 1 for 0
+	 */
+	static int32_t pow5Bits(int32_t exponent);
+
+	/**
+	 * Calculates floor(log2(5^exponent)).
+	 * @param	exponent	Exponent from 0 to 3528
+	 * @return			floor(log2(5^exponent))
+	 */
+	static int32_t log2Pow5(int32_t exponent);
+
+	/**
+	 * Calculates floor(log10(2^exponent)).
+	 * @param	exponent	Exponent from 0 to 1650
+	 * @return			floor(log10(2^exponent))
+	 */
+	static int32_t log10Pow2(int32_t exponent);
+
+	/**
+	 * Calculates floor(log10(5^exponent)).
+	 * @param	exponent	Exponent from 0 to 2620
+	 * @return			floor(log10(5^exponent))
+	 */
+	static int32_t log10Pow5(int32_t exponent);
+
+	/**
+	 * Calculates floor(log2(value)).
+	 * @param	value	Non-zero value
+	 * @return		Index of the highest set bit
+	 */
+	static int32_t log2(uint64_t value);
+
+	/**
+	 * Checks if a value is divisible by a power of 5.
+	 * @param	value		Non-zero value to check
+	 * @param	exponent	Exponent of the power of 5
+	 * @return			true if value is divisible by 5^exponent, otherwise false
+	 */
+	static bool multipleOfPow5(uint64_t value, int32_t exponent);
+
+	/**
+	 * Checks if a value is divisible by a power of 2.
+	 * @param	value		Value to check
+	 * @param	exponent	Exponent of the power of 2 below 64
+	 * @return			true if value is divisible by 2^exponent, otherwise false
+	 */
+	static bool multipleOfPow2(uint64_t value, int32_t exponent);
+
+	/**
+	 * Multiplies two 64 bit words.
+	 * @param	a	First factor
+	 * @param	b	Second factor
+	 * @param	high	High word of the product
+	 * @return		Low word of the product
+	 */
+	static uint64_t multiply(uint64_t a, uint64_t b, uint64_t& high);
+
+	/**
+	 * Multiplies a value by a 128 bit factor and shifts the product right.
+	 * @param	value	Value to multiply
+	 * @param	factor	Factor as low and high word
+	 * @param	shift	Count of bits to shift the product right, at least 64
+	 * @return		Shifted product
+	 */
+	static uint64_t multiplyShift(uint64_t value, const uint64_t* factor, int32_t shift);
+
+	/**
+	 * Converts a positive double to its shortest decimal representation that parses back to the same double.
+	 * @param	bits	Bits of the double without the sign
+	 * @return		Shortest decimal representation
+	 */
+	static Decimal toDecimal(uint64_t bits);
+
+	/**
+	 * Converts a positive decimal of up to 17 digits to the nearest double.
+	 * @param	mantissa	Non-zero decimal digits
+	 * @param	exponent	Power of 10 of the last digit
+	 * @return			Bits of the nearest double
+	 */
+	static uint64_t toDouble(uint64_t mantissa, int32_t exponent);
+
+	/**
+	 * Compares a decimal to the halfway point between a double and the next larger double.
+	 * @param	digits		Digits of the decimal, which may include a decimal point
+	 * @param	end		End of the digits
+	 * @param	exponent	Power of 10 of the first digit
+	 * @param	bits		Bits of the double without the sign
+	 * @return			Negative, zero or positive if the decimal is less than, equal to or greater than the
+	 *				halfway point
+	 */
+	template<class TChar>
+	static int compareHalfway(const TChar* digits, const TChar* end, int32_t exponent, uint64_t bits);
+
+	/**
+	 * Parses decimal digits into an unsigned integer.
+	 * @param	str	Characters to parse
+	 * @param	end	End of the characters
+	 * @param	value	Parsed value
+	 * @return		true if there is at least one character, all of them are digits and the value fits, otherwise
+	 *			false
+	 */
+	template<class TChar>
+	static bool parseDigits(const TChar* str, const TChar* end, uint64_t& value);
+
+	/**
+	 * Checks if a string equals an ASCII word ignoring the case.
+	 * @param	str	String to check
+	 * @param	length	Length of the string
+	 * @param	word	Lower-case word to compare to
+	 * @return		true if the string equals the word, otherwise false
+	 */
+	template<class TChar>
+	static bool equalsIgnoreCase(const TChar* str, size_t length, const char* word);
+
+	/**
+	 * Writes the digits of a value right-aligned in front of a position.
+	 * @param	value	Value to write
+	 * @param	end	Position behind the last digit
+	 */
+	template<class TChar>
+	static void writeDigits(uint64_t value, TChar* end);
+
+public:
+	// Maximum length of a formatted integer including the sign and of a formatted double like -0.0000012345678901234567
+	enum { MAX_INTEGER_LENGTH = 20, MAX_DOUBLE_LENGTH = 25 };
+
+	/**
+	 * Calculates the count of decimal digits of a value.
+	 * @param	value	Value to count the digits of
+	 * @return		Count of digits, 1 for 0
+	 */
+	static size_t digitCount(uint64_t value);
+
+	/**
+	 * Writes the decimal representation of an unsigned integer.
+	 * @param	value	Value to write
+	 * @param	target	Buffer for at least MAX_INTEGER_LENGTH characters
+	 * @return		Count of written characters, no terminating 0 is written
+	 */
+	template<class TChar>
+	static size_t formatUInt(uint64_t value, TChar* target);
+
+	/**
+	 * Writes the decimal representation of a signed integer.
+	 * @param	value	Value to write
+	 * @param	target	Buffer for at least MAX_INTEGER_LENGTH characters
+	 * @return		Count of written characters, no terminating 0 is written
+	 */
+	template<class TChar>
+	static size_t formatInt(int64_t value, TChar* target);
+
+	/**
+	 * Writes the shortest decimal representation of a double which parses back to the same double. Infinity and
+	 * NaN are written as inf, -inf and nan.
+	 * @param	value	Value to write
+	 * @param	target	Buffer for at least MAX_DOUBLE_LENGTH characters
+	 * @return		Count of written characters, no terminating 0 is written
+	 */
+	template<class TChar>
+	static size_t formatDouble(double value, TChar* target);
+
+	/**
+	 * Parses an unsigned integer consisting of an optional + sign and decimal digits only.
+	 * @param	str	Characters to parse
+	 * @param	length	Count of characters
+	 * @param	value	Parsed value, unchanged if the characters are no valid integer or it overflows
+	 * @return		true if the characters were parsed, otherwise false
+	 */
+	template<class TChar>
+	static bool parseUInt(const TChar* str, size_t length, uint64_t& value);
+
+	/**
+	 * Parses a signed integer consisting of an optional sign and decimal digits only.
+	 * @param	str	Characters to parse
+	 * @param	length	Count of characters
+	 * @param	value	Parsed value, unchanged if the characters are no valid integer or it overflows
+	 * @return		true if the characters were parsed, otherwise false
+	 */
+	template<class TChar>
+	static bool parseInt(const TChar* str, size_t length, int64_t& value);
+
+	/**
+	 * Parses a double consisting of an optional sign, decimal digits with an optional decimal point and an optional
+	 * exponent, or inf, infinity and nan ignoring the case. The result is rounded to the nearest double, ties to
+	 * even, values too large for a double become infinity.
+	 * @param	str	Characters to parse
+	 * @param	length	Count of characters
+	 * @param	value	Parsed value, unchanged if the characters are no valid double
+	 * @return		true if the characters were parsed, otherwise false
+	 */
+	template<class TChar>
+	static bool parseDouble(const TChar* str, size_t length, double& value);
+};
+
+
+// Include StringNumber class implementation
+#include "StringNumber.tpp"
+
+
+#endif // #ifndef STRINGNUMBER_HPP
@@ -0,0 +1,305 @@
+/**
+ * @file StringParallel.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGPARALLEL_HPP
+#define STRINGPARALLEL_HPP
+
+
+// For std::max
+#include <algorithm>
+// For the count of unfinished tasks
+#include <atomic>
+// For waking up idle workers
+#include <condition_variable>
+// For the task queues
+#include <deque>
+// For std::function
+#include <functional>
+// For locking the task queues
+#include <mutex>
+// For the worker threads
+#include <thread>
+// For the chunks and lines
+#include <vector>
+#include "String.hpp"
+// For searching the chunks
+#include "StringSearch.hpp"
+
+
+// Minimum length of a chunk processed by one task in characters, shorter inputs are processed sequentially
+#ifndef STRING_PARALLEL_CHUNK_SIZE
+#define STRING_PARALLEL_CHUNK_SIZE 4194304
+#endif
+// Count of chunks per thread, more chunks balance uneven work better at the cost of more tasks
+#define STRING_PARALLEL_CHUNKS_PER_THREAD 4
+// Minimum count of strings hashed by one task
+#define STRING_PARALLEL_MIN_STRINGS 4096
+
+
+/**
+ * @class StringThreadPool
+ * Work-stealing thread pool running the tasks of StringParallel. Every worker has its own queue, which it takes tasks
+ * from at the back, and steals tasks from the front of the other queues when its own one is empty. A thread waiting
+ * for its tasks runs queued tasks meanwhile, so tasks may start tasks themselves.
+ */
+class StringThreadPool
+{
+private:
+	/**
+	 * @struct Queue
+	 * Task queue of a worker.
+	 */
+	struct Queue
+	{
+		// Lock of the queue
+		std::mutex mutex;
+		// Queued tasks
+		std::deque<std::function<void()> > tasks;
+		// Keeps the locks of neighbouring queues on different cache lines
+		char padding[64];
+	};
+
+	// Queues of the workers, the first one is used by threads outside of the pool
+	std::vector<Queue> m_queues;
+	// Worker threads
+	std::vector<std::thread> m_threads;
+	// Minimum length of a chunk in characters
+	size_t m_chunkSize;
+	// Count of queued tasks
+	std::atomic<size_t> m_queued;
+	// Lock of m_stop and of waiting for tasks
+	std::mutex m_mutex;
+	// Wakes up idle workers
+	std::condition_variable m_condition;
+	// Whether the workers are stopped
+	bool m_stop;
+
+	/**
+	 * Runs a task of the own queue or steals one from another queue.
+	 * @param	index	Index of the own queue
+	 * @return		true if a task was run, otherwise false
+	 */
+	bool runTask(size_t index);
+
+	/**
+	 * Main loop of a worker thread.
+	 * @param	index	Index of the queue of the worker
+	 */
+	void work(size_t index);
+
+	// The pool owns its threads, so it can neither be copied nor assigned
+	StringThreadPool(const StringThreadPool&);
+	StringThreadPool& operator=(const StringThreadPool&);
+
+public:
+	/**
+	 * Constructor for instances of the class StringThreadPool, which starts the worker threads.
+	 * @param	threads		Count of threads working on a call of run including the calling thread, 0 for the count of
+	 *				hardware threads
+	 * @param	chunkSize	Minimum length of a chunk processed by one task in characters
+	 */
+	explicit StringThreadPool(size_t threads = 0, size_t chunkSize = STRING_PARALLEL_CHUNK_SIZE);
+
+	/**
+	 * Destructor for instances of the class StringThreadPool. Runs the remaining tasks and stops the worker threads.
+	 */
+	~StringThreadPool();
+
+	/**
+	 * Returns the count of threads working on a call of run.
+	 * @return	Count of worker threads plus the calling thread
+	 */
+	size_t concurrency() const;
+
+	/**
+	 * Returns the minimum length of a chunk processed by one task.
+	 * @return	Minimum length of a chunk in characters
+	 */
+	size_t chunkSize() const;
+
+	/**
+	 * Calls a function for every index below a count in parallel and waits until all calls returned.
+	 * @param	count		Count of calls
+	 * @param	function	Function called with every index, concurrently from several threads
+	 */
+	template<class TFunction>
+	void run(size_t count, TFunction function);
+
+	/**
+	 * Returns the pool used by default, which uses all hardware threads and is created on first use.
+	 * @return	Shared pool
+	 */
+	static StringThreadPool& shared();
+};
+
+/**
+ * @class StringParallel
+ * Parallel variants of bulk string algorithms for large inputs, which split their input into chunks processed by the
+ * threads of a StringThreadPool. Inputs shorter than two chunks are processed sequentially by the calling thread.
+ * Chunks never split a UTF-8 sequence of AString or a UTF-16 surrogate pair of 2 byte wide strings. The results equal
+ * the ones of the sequential methods of String and StringView.
+ */
+class StringParallel
+{
+private:
+	/**
+	 * @struct Chunk
+	 * Chunk of a search, which counts the non-overlapping matches starting inside it.
+	 */
+	struct Chunk
+	{
+		// Start of the chunk
+		size_t begin;
+		// End of the chunk, matches starting before it belong to the chunk
+		size_t end;
+		// Position the matches were searched from, behind the last match of the previous chunks
+		size_t start;
+		// Position of the first match, NOT_FOUND if there is none
+		size_t first;
+		// End of the last match, start if there is none
+		size_t last;
+		// Count of matches
+		size_t count;
+	};
+
+	/**
+	 * Calculates the start of a chunk of characters split into chunks of equal length. The start is moved back to the
+	 * start of a character, so UTF-8 sequences and surrogate pairs are not split.
+	 * @param	data	Characters to split
+	 * @param	length	Count of characters
+	 * @param	count	Count of chunks
+	 * @param	index	Index of the chunk, count for the end of the last chunk
+	 * @return		Start of the chunk
+	 */
+	template<class TChar>
+	static size_t boundary(const TChar* data, size_t length, size_t count, size_t index);
+
+	/**
+	 * Splits characters into chunks for the threads of a pool.
+	 * @param	length	Count of characters to split
+	 * @param	pool	Pool to process the chunks
+	 * @return		Count of chunks, 1 if the characters are processed sequentially
+	 */
+	static size_t chunkCount(size_t length, const StringThreadPool& pool);
+
+	/**
+	 * Splits a search into chunks and counts the matches of every chunk in parallel. Chunks whose first match
+	 * overlaps the last match of the previous chunk are searched again behind it.
+	 * @param	haystack	String to search in
+	 * @param	searcher	Searcher of the needle
+	 * @param	length		Length of the needle, at least 1
+	 * @param	chunks		Chunks with their matches
+	 * @param	pool		Pool to search with
+	 */
+	template<class TChar>
+	static void searchChunks(const StringView<TChar>& haystack, const Searcher<TChar>& searcher, size_t length,
+		std::vector<Chunk>& chunks, StringThreadPool& pool);
+
+	/**
+	 * Counts the non-overlapping matches starting inside a chunk from a position on.
+	 * @param	haystack	String to search in
+	 * @param	searcher	Searcher of the needle
+	 * @param	length		Length of the needle
+	 * @param	chunk		Chunk to search, its start, first, last and count are updated
+	 * @param	start		Position to search from
+	 */
+	template<class TChar>
+	static void searchChunk(const StringView<TChar>& haystack, const Searcher<TChar>& searcher, size_t length,
+		Chunk& chunk, size_t start);
+
+public:
+	/**
+	 * Calls a function for chunks of a string in parallel, which are split at character boundaries.
+	 * @param	str		String to split
+	 * @param	function	Function called with the index and the view of every chunk, concurrently from several
+	 *				threads
+	 * @param	pool		Pool to run the function
+	 * @return			Count of chunks
+	 */
+	template<class TChar, class TFunction>
+	static size_t forEachChunk(const StringView<TChar>& str, TFunction function,
+		StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Searches the first occurrence of a string, see StringView::find.
+	 * @param	haystack	String to search in
+	 * @param	needle		String to search
+	 * @param	pool		Pool to search with
+	 * @return			Position of the string, NOT_FOUND if it does not occur
+	 */
+	template<class TChar>
+	static size_t find(const StringView<TChar>& haystack, const StringView<TChar>& needle,
+		StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Counts the non-overlapping occurrences of a string, see StringView::count.
+	 * @param	haystack	String to search in
+	 * @param	needle		String to count
+	 * @param	pool		Pool to count with
+	 * @return			Count of occurrences
+	 */
+	template<class TChar>
+	static size_t count(const StringView<TChar>& haystack, const StringView<TChar>& needle,
+		StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Replaces all non-overlapping occurrences of a string from left to right. The matches are counted in parallel
+	 * first, then the result is allocated once and every chunk is copied to its position in parallel.
+	 * @param	str		String to replace the occurrences in
+	 * @param	needle		String to replace, nothing is replaced if it is empty
+	 * @param	replacement	String to insert instead
+	 * @param	pool		Pool to replace with
+	 * @return			Count of replaced occurrences
+	 */
+	template<class TChar, class TAllocator>
+	static size_t replaceAll(String<TChar, TAllocator>& str, const StringView<TChar>& needle,
+		const StringView<TChar>& replacement, StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Converts the ASCII letters of a string to lower case, other characters are kept.
+	 * @param	str	String to convert
+	 * @param	pool	Pool to convert with
+	 */
+	template<class TChar, class TAllocator>
+	static void toLower(String<TChar, TAllocator>& str, StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Converts the ASCII letters of a string to upper case, other characters are kept.
+	 * @param	str	String to convert
+	 * @param	pool	Pool to convert with
+	 */
+	template<class TChar, class TAllocator>
+	static void toUpper(String<TChar, TAllocator>& str, StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Splits a string into lines at '\n', which is not part of the lines. A last line without '\n' is added if it is
+	 * not empty, like StringLineReader does.
+	 * @param	str	String to split
+	 * @param	lines	Vector receiving the views of the lines in order, which is cleared first
+	 * @param	pool	Pool to split with
+	 */
+	template<class TChar>
+	static void splitLines(const StringView<TChar>& str, std::vector<StringView<TChar> >& lines,
+		StringThreadPool& pool = StringThreadPool::shared());
+
+	/**
+	 * Calculates the hashes of many strings, see StringView::hash.
+	 * @param	strings	Strings to hash, which may be Strings, views or anything else providing hash()
+	 * @param	count	Count of strings
+	 * @param	hashes	Buffer for count hashes
+	 * @param	pool	Pool to hash with
+	 */
+	template<class TString>
+	static void hash(const TString* strings, size_t count, size_t* hashes,
+		StringThreadPool& pool = StringThreadPool::shared());
+};
+
+
+// Include StringParallel class implementation
+#include "StringParallel.tpp"
+
+
+#endif // #ifndef STRINGPARALLEL_HPP
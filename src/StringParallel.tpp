@@ -0,0 +1,445 @@
+/**
+ * @file StringParallel.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGPARALLEL_HPP
+#error STRINGPARALLEL_HPP undefined
+#endif
+
+inline StringThreadPool::StringThreadPool(size_t threads, size_t chunkSize)
+	: m_queues(threads ? threads : std::max<size_t>(1, std::thread::hardware_concurrency())),
+	m_chunkSize(chunkSize ? chunkSize : 1), m_queued(0), m_stop(false)
+{
+	// The thread calling run works as well and uses the first queue, so one thread less is started
+	for (size_t i = 1; i < m_queues.size(); i++)
+	{
+		m_threads.push_back(std::thread(&StringThreadPool::work, this, i));
+	}
+}
+
+inline StringThreadPool::~StringThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_all();
+	for (size_t i = 0; i < m_threads.size(); i++)
+	{
+		m_threads[i].join();
+	}
+}
+
+inline bool StringThreadPool::runTask(size_t index)
+{
+	std::function<void()> task;
+	size_t count = m_queues.size();
+	for (size_t i = 0; i < count && !task; i++)
+	{
+		// Take the newest task of the own queue or steal the oldest one of another queue
+		Queue& queue = m_queues[(index + i) % count];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+		{
+			continue;
+		}
+		if (!i)
+		{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+		}
+		else
+		{
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+		}
+	}
+	if (!task)
+	{
+		return false;
+	}
+
+	m_queued.fetch_sub(1);
+	task();
+	return true;
+}
+
+inline void StringThreadPool::work(size_t index)
+{
+	for (;;)
+	{
+		if (runTask(index))
+		{
+			continue;
+		}
+
+		// Sleep until tasks are queued, remaining tasks are run before stopping
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_stop && !m_queued.load())
+		{
+			m_condition.wait(lock);
+		}
+		if (m_stop && !m_queued.load())
+		{
+			return;
+		}
+	}
+}
+
+inline size_t StringThreadPool::concurrency() const
+{
+	return m_queues.size();
+}
+
+inline size_t StringThreadPool::chunkSize() const
+{
+	return m_chunkSize;
+}
+
+template<class TFunction>
+void StringThreadPool::run(size_t count, TFunction function)
+{
+	// Run single calls and pools without workers in the calling thread
+	if (count < 2 || m_threads.empty())
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			function(i);
+		}
+		return;
+	}
+
+	// Count the tasks before queuing them, so workers do not fall asleep while they are queued
+	std::atomic<size_t> remaining(count);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queued.fetch_add(count);
+	}
+	// Spread the tasks over the queues, so every worker starts with its own share
+	for (size_t i = 0; i < count; i++)
+	{
+		Queue& queue = m_queues[i % m_queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back([&function, &remaining, i]()
+		{
+			function(i);
+			remaining.fetch_sub(1, std::memory_order_release);
+		});
+	}
+	m_condition.notify_all();
+
+	// Help running tasks until the ones of this call are done, which may be run by other threads
+	while (remaining.load(std::memory_order_acquire))
+	{
+		if (!runTask(0))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+inline StringThreadPool& StringThreadPool::shared()
+{
+	static StringThreadPool pool;
+	return pool;
+}
+
+template<class TChar>
+size_t StringParallel::boundary(const TChar* data, size_t length, size_t count, size_t index)
+{
+	if (!index || index >= count)
+	{
+		return index ? length : 0;
+	}
+
+	size_t position = length / count * index;
+	if (1 == sizeof(TChar))
+	{
+		// Move back over up to 3 UTF-8 continuation bytes 10xxxxxx
+		for (size_t i = 0; i < 3 && position && 0x80 == (static_cast<unsigned char>(data[position]) & 0xC0); i++)
+		{
+			position--;
+		}
+	}
+	else if (2 == sizeof(TChar))
+	{
+		// Do not separate a low surrogate from its high surrogate
+		if (0xDC00 == (static_cast<uint16_t>(data[position]) & 0xFC00))
+		{
+			position--;
+		}
+	}
+	return position;
+}
+
+inline size_t StringParallel::chunkCount(size_t length, const StringThreadPool& pool)
+{
+	size_t threads = pool.concurrency();
+	size_t count = length / pool.chunkSize();
+	size_t maximum = threads * STRING_PARALLEL_CHUNKS_PER_THREAD;
+	return threads < 2 || count < 2 ? 1 : (count < maximum ? count : maximum);
+}
+
+template<class TChar>
+void StringParallel::searchChunk(const StringView<TChar>& haystack, const Searcher<TChar>& searcher, size_t length,
+	Chunk& chunk, size_t start)
+{
+	// Matches must start inside the chunk but may end behind it
+	StringView<TChar> region = haystack.substr(0, chunk.end + length - 1);
+	chunk.start = start;
+	chunk.first = StringView<TChar>::NOT_FOUND;
+	chunk.last = start;
+	chunk.count = 0;
+	for (size_t pos = searcher.find(region, start); pos != StringView<TChar>::NOT_FOUND;
+		pos = searcher.find(region, pos + length))
+	{
+		if (!chunk.count)
+		{
+			chunk.first = pos;
+		}
+		chunk.last = pos + length;
+		chunk.count++;
+	}
+}
+
+template<class TChar>
+void StringParallel::searchChunks(const StringView<TChar>& haystack, const Searcher<TChar>& searcher, size_t length,
+	std::vector<Chunk>& chunks, StringThreadPool& pool)
+{
+	size_t count = chunkCount(haystack.length(), pool);
+	chunks.resize(count);
+	pool.run(count, [&](size_t i)
+	{
+		Chunk& chunk = chunks[i];
+		chunk.begin = boundary(haystack.data(), haystack.length(), count, i);
+		chunk.end = boundary(haystack.data(), haystack.length(), count, i + 1);
+		searchChunk(haystack, searcher, length, chunk, chunk.begin);
+	});
+
+	// Continue the matches of the previous chunks, only needles overlapping themselves have to be searched again
+	size_t last = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		Chunk& chunk = chunks[i];
+		if (last > chunk.begin)
+		{
+			if (chunk.count && chunk.first < last)
+			{
+				searchChunk(haystack, searcher, length, chunk, last);
+			}
+			else
+			{
+				chunk.start = last;
+				chunk.last = chunk.count ? chunk.last : last;
+			}
+		}
+		last = chunk.last;
+	}
+}
+
+template<class TChar, class TFunction>
+size_t StringParallel::forEachChunk(const StringView<TChar>& str, TFunction function, StringThreadPool& pool)
+{
+	size_t count = chunkCount(str.length(), pool);
+	pool.run(count, [&](size_t i)
+	{
+		size_t begin = boundary(str.data(), str.length(), count, i);
+		size_t end = boundary(str.data(), str.length(), count, i + 1);
+		function(i, str.substr(begin, end - begin));
+	});
+	return count;
+}
+
+template<class TChar>
+size_t StringParallel::find(const StringView<TChar>& haystack, const StringView<TChar>& needle, StringThreadPool& pool)
+{
+	size_t count = chunkCount(haystack.length(), pool);
+	if (1 == count || !needle.length())
+	{
+		return haystack.find(needle);
+	}
+
+	// Chunks behind an occurrence found by another chunk are skipped
+	Searcher<TChar> searcher(needle);
+	std::atomic<size_t> result(StringView<TChar>::NOT_FOUND);
+	pool.run(count, [&](size_t i)
+	{
+		size_t begin = boundary(haystack.data(), haystack.length(), count, i);
+		if (begin >= result.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		size_t end = boundary(haystack.data(), haystack.length(), count, i + 1);
+		size_t pos = searcher.find(haystack.substr(0, end + needle.length() - 1), begin);
+		size_t current = result.load(std::memory_order_relaxed);
+		while (pos < current && !result.compare_exchange_weak(current, pos, std::memory_order_relaxed))
+		{
+			// Retry with the position stored by another chunk
+		}
+	});
+	return result.load();
+}
+
+template<class TChar>
+size_t StringParallel::count(const StringView<TChar>& haystack, const StringView<TChar>& needle, StringThreadPool& pool)
+{
+	if (!needle.length())
+	{
+		return 0;
+	}
+
+	Searcher<TChar> searcher(needle);
+	std::vector<Chunk> chunks;
+	searchChunks(haystack, searcher, needle.length(), chunks, pool);
+	size_t result = 0;
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		result += chunks[i].count;
+	}
+	return result;
+}
+
+template<class TChar, class TAllocator>
+size_t StringParallel::replaceAll(String<TChar, TAllocator>& str, const StringView<TChar>& needle,
+	const StringView<TChar>& replacement, StringThreadPool& pool)
+{
+	if (!needle.length())
+	{
+		return 0;
+	}
+
+	// Count the matches of every chunk first to know where its characters are moved to
+	StringView<TChar> source(str);
+	Searcher<TChar> searcher(needle);
+	std::vector<Chunk> chunks;
+	searchChunks(source, searcher, needle.length(), chunks, pool);
+	std::vector<size_t> targets(chunks.size());
+	size_t matches = 0;
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		targets[i] = chunks[i].start - matches * needle.length() + matches * replacement.length();
+		matches += chunks[i].count;
+	}
+	if (!matches)
+	{
+		return 0;
+	}
+
+	// Copy every chunk from its start to the start of the next one, replacing its matches
+	size_t length = source.length() - matches * needle.length() + matches * replacement.length();
+	String<TChar, TAllocator> result(length);
+	TChar* buffer = result.data();
+	pool.run(chunks.size(), [&](size_t i)
+	{
+		const Chunk& chunk = chunks[i];
+		StringView<TChar> region = source.substr(0, chunk.end + needle.length() - 1);
+		size_t end = i + 1 < chunks.size() ? chunks[i + 1].start : source.length();
+		TChar* target = buffer + targets[i];
+		size_t pos = chunk.start;
+		for (size_t found = searcher.find(region, pos); found != StringView<TChar>::NOT_FOUND;
+			found = searcher.find(region, pos))
+		{
+			memcpy(target, source.data() + pos, (found - pos) * sizeof(TChar));
+			target += found - pos;
+			memcpy(target, replacement.data(), replacement.length() * sizeof(TChar));
+			target += replacement.length();
+			pos = found + needle.length();
+		}
+		memcpy(target, source.data() + pos, (end - pos) * sizeof(TChar));
+	});
+	buffer[length] = 0;
+	result.setLength(length);
+	str = std::move(result);
+	return matches;
+}
+
+template<class TChar, class TAllocator>
+void StringParallel::toLower(String<TChar, TAllocator>& str, StringThreadPool& pool)
+{
+	// Copy a shared buffer once before the chunks are converted
+	TChar* data = str.data();
+	forEachChunk(StringView<TChar>(data, str.length()), [data](size_t, const StringView<TChar>& chunk)
+	{
+		StringKernels<TChar>::toLower(data + (chunk.data() - data), chunk.length());
+	}, pool);
+}
+
+template<class TChar, class TAllocator>
+void StringParallel::toUpper(String<TChar, TAllocator>& str, StringThreadPool& pool)
+{
+	// Copy a shared buffer once before the chunks are converted
+	TChar* data = str.data();
+	forEachChunk(StringView<TChar>(data, str.length()), [data](size_t, const StringView<TChar>& chunk)
+	{
+		StringKernels<TChar>::toUpper(data + (chunk.data() - data), chunk.length());
+	}, pool);
+}
+
+template<class TChar>
+void StringParallel::splitLines(const StringView<TChar>& str, std::vector<StringView<TChar> >& lines,
+	StringThreadPool& pool)
+{
+	// Move the boundaries of the chunks behind the next '\n', so every chunk consists of whole lines
+	size_t count = chunkCount(str.length(), pool);
+	std::vector<size_t> bounds(count + 1, str.length());
+	bounds[0] = 0;
+	for (size_t i = 1; i < count; i++)
+	{
+		size_t pos = str.length() / count * i;
+		pos = str.find('\n', pos > bounds[i - 1] ? pos : bounds[i - 1]);
+		if (StringView<TChar>::NOT_FOUND == pos)
+		{
+			break;
+		}
+		bounds[i] = pos + 1;
+	}
+
+	std::vector<std::vector<StringView<TChar> > > chunks(count);
+	pool.run(count, [&](size_t i)
+	{
+		std::vector<StringView<TChar> >& chunk = chunks[i];
+		for (size_t pos = bounds[i]; pos < bounds[i + 1];)
+		{
+			size_t end = str.find('\n', pos);
+			if (end >= bounds[i + 1])
+			{
+				// Only the last chunk may end with a line without '\n'
+				chunk.push_back(str.substr(pos, bounds[i + 1] - pos));
+				break;
+			}
+			chunk.push_back(str.substr(pos, end - pos));
+			pos = end + 1;
+		}
+	});
+
+	// Join the lines of the chunks in order
+	size_t total = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		total += chunks[i].size();
+	}
+	lines.clear();
+	lines.reserve(total);
+	for (size_t i = 0; i < count; i++)
+	{
+		lines.insert(lines.end(), chunks[i].begin(), chunks[i].end());
+	}
+}
+
+template<class TString>
+void StringParallel::hash(const TString* strings, size_t count, size_t* hashes, StringThreadPool& pool)
+{
+	size_t tasks = count / STRING_PARALLEL_MIN_STRINGS;
+	size_t maximum = pool.concurrency() * STRING_PARALLEL_CHUNKS_PER_THREAD;
+	tasks = tasks < 1 ? 1 : (tasks < maximum ? tasks : maximum);
+	pool.run(tasks, [&](size_t i)
+	{
+		size_t end = i + 1 < tasks ? count / tasks * (i + 1) : count;
+		for (size_t j = count / tasks * i; j < end; j++)
+		{
+			hashes[j] = strings[j].hash();
+		}
+	});
+}
@@ -0,0 +1,230 @@
+/**
+ * @file StringPool.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGPOOL_HPP
+#define STRINGPOOL_HPP
+
+
+// For std::hash
+#include <functional>
+// For std::mutex
+#include <mutex>
+// For std::vector
+#include <vector>
+#include "String.hpp"
+
+
+// Size of the slabs the interned strings are stored in, longer strings get a slab of their own
+#define STRING_INTERN_SLAB_SIZE 65536
+// Count of independently locked shards of a StringPool, must be a power of 2
+#define STRING_INTERN_SHARDS 16
+
+
+// Declaration of the class StringPool, which creates interned strings
+template<class TChar>
+class StringPool;
+
+
+/**
+ * @class InternedString
+ * Handle of an immutable string interned by a StringPool. A handle is a single pointer: equal strings interned by the
+ * same pool share the pointer, so comparing and hashing handles takes O(1) regardless of the length of the strings.
+ * Handles stay valid as long as their pool exists. A default constructed handle is the empty string.
+ */
+template<class TChar>
+class InternedString
+{
+	friend class StringPool<TChar>;
+
+private:
+	// Header of an interned string, which is followed by its zero-terminated characters
+	struct Entry
+	{
+		// Hash of the characters
+		size_t hash;
+		// Length of the string in characters
+		size_t length;
+	};
+
+	// Interned string, 0 for the empty string
+	const Entry* m_entry;
+
+	/**
+	 * Constructor which creates a handle of an interned string.
+	 * @param	entry	Interned string
+	 */
+	explicit InternedString(const Entry* entry);
+
+public:
+	/**
+	 * Default constructor for instances of the class InternedString. Constructs the empty string.
+	 */
+	InternedString();
+
+	/**
+	 * Returns a pointer to the zero-terminated characters of the string.
+	 * @return	Pointer to the characters
+	 */
+	const TChar* c_str() const;
+
+	/**
+	 * Returns the length of the string.
+	 * @return	Length of the string in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Returns the hash of the characters, which was calculated once while interning the string and equals
+	 * String::hash, also for the empty string.
+	 * @return	Hash of the string
+	 */
+	size_t hash() const;
+
+	/**
+	 * Returns a view of the string.
+	 * @return	View of the characters
+	 */
+	operator StringView<TChar>() const;
+
+	/**
+	 * Equal operator. Compares the pointers of both handles, which must stem from the same pool.
+	 * @param	other	Handle to compare to
+	 * @return		true if both strings are equal, otherwise false
+	 */
+	bool operator==(const InternedString<TChar>& other) const;
+
+	/**
+	 * Unequal operator. Compares the pointers of both handles, which must stem from the same pool.
+	 * @param	other	Handle to compare to
+	 * @return		true if both strings are unequal, otherwise false
+	 */
+	bool operator!=(const InternedString<TChar>& other) const;
+
+	/**
+	 * Less operator. Orders the handles by their pointers, which is not the lexicographical order of the strings.
+	 * @param	other	Handle to compare to
+	 * @return		true if the handle is ordered before other, otherwise false
+	 */
+	bool operator<(const InternedString<TChar>& other) const;
+};
+
+
+/**
+ * @class StringPool
+ * Thread-safe pool storing a single immutable copy of every interned string. The copies are packed into large slabs
+ * and only freed with the pool. The pool is split into shards selected by the hash of a string, each one with its
+ * own lock and hash table, so threads interning different strings rarely wait for each other.
+ */
+template<class TChar>
+class StringPool
+{
+private:
+	// Header of an interned string
+	typedef typename InternedString<TChar>::Entry Entry;
+
+	struct Shard
+	{
+		// Lock of the shard
+		std::mutex mutex;
+		// Open addressing hash table of the interned strings, its size is a power of 2
+		std::vector<const Entry*> table;
+		// Count of interned strings
+		size_t count;
+		// Slabs storing the interned strings
+		std::vector<char*> slabs;
+		// Next free byte of the current slab
+		char* current;
+		// End of the current slab
+		char* end;
+		// Count of bytes allocated for slabs
+		size_t memoryUsage;
+		// Keeps the locks of neighbouring shards on different cache lines
+		char padding[64];
+	};
+
+	// Shards of the pool
+	Shard m_shards[STRING_INTERN_SHARDS];
+
+	/**
+	 * Copies a string into the slabs of a shard.
+	 * @param	shard	Shard to store the string in
+	 * @param	str	String to copy
+	 * @param	hash	Hash of the string
+	 * @return		Interned string
+	 */
+	static const Entry* store(Shard& shard, const StringView<TChar>& str, size_t hash);
+
+	/**
+	 * Doubles the size of the hash table of a shard.
+	 * @param	shard	Shard to grow
+	 */
+	static void grow(Shard& shard);
+
+	// The pool owns the slabs, so it can neither be copied nor assigned
+	StringPool(const StringPool<TChar>&);
+	StringPool<TChar>& operator=(const StringPool<TChar>&);
+
+public:
+	/**
+	 * Default constructor for instances of the class StringPool. Constructs an empty pool.
+	 */
+	StringPool();
+
+	/**
+	 * Destructor for instances of the class StringPool. Frees all interned strings.
+	 */
+	~StringPool();
+
+	/**
+	 * Interns a string. The string is copied into the pool the first time it is interned, later calls return the
+	 * same handle.
+	 * @param	str	String to intern
+	 * @return		Handle of the interned string
+	 */
+	InternedString<TChar> intern(const StringView<TChar>& str);
+
+	/**
+	 * Returns the count of interned strings.
+	 * @return	Count of distinct interned strings
+	 */
+	size_t size();
+
+	/**
+	 * Returns the memory allocated for the slabs.
+	 * @return	Count of bytes allocated for slabs
+	 */
+	size_t memoryUsage();
+};
+
+
+// Include StringPool class implementation
+#include "StringPool.tpp"
+
+
+/**
+ * Specialization of std::hash for InternedString, returning the hash calculated while interning.
+ */
+namespace std
+{
+	template<class TChar>
+	struct hash<InternedString<TChar> >
+	{
+		size_t operator()(const InternedString<TChar>& str) const
+		{
+			return str.hash();
+		}
+	};
+}
+
+
+// Typedef of the frequently used StringPool classes
+typedef StringPool<char> AStringPool;
+typedef StringPool<wchar_t> WStringPool;
+typedef InternedString<char> AInternedString;
+typedef InternedString<wchar_t> WInternedString;
+
+
+#endif // #ifndef STRINGPOOL_HPP
@@ -0,0 +1,211 @@
+/**
+ * @file StringPool.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGPOOL_HPP
+#error STRINGPOOL_HPP undefined
+#endif
+
+template<class TChar>
+InternedString<TChar>::InternedString(const Entry* entry)
+	: m_entry(entry)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+InternedString<TChar>::InternedString()
+	: m_entry(0)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+const TChar* InternedString<TChar>::c_str() const
+{
+	static const TChar empty = static_cast<TChar>(0);
+	return m_entry ? reinterpret_cast<const TChar*>(m_entry + 1) : &empty;
+}
+
+template<class TChar>
+size_t InternedString<TChar>::length() const
+{
+	return m_entry ? m_entry->length : 0;
+}
+
+template<class TChar>
+size_t InternedString<TChar>::hash() const
+{
+	// The empty string is not interned, but hashes like an empty String
+	return m_entry ? m_entry->hash : StringView<TChar>().hash();
+}
+
+template<class TChar>
+InternedString<TChar>::operator StringView<TChar>() const
+{
+	return StringView<TChar>(c_str(), length());
+}
+
+template<class TChar>
+bool InternedString<TChar>::operator==(const InternedString<TChar>& other) const
+{
+	return m_entry == other.m_entry;
+}
+
+template<class TChar>
+bool InternedString<TChar>::operator!=(const InternedString<TChar>& other) const
+{
+	return m_entry != other.m_entry;
+}
+
+template<class TChar>
+bool InternedString<TChar>::operator<(const InternedString<TChar>& other) const
+{
+	return std::less<const Entry*>()(m_entry, other.m_entry);
+}
+
+
+
+template<class TChar>
+const typename StringPool<TChar>::Entry* StringPool<TChar>::store(Shard& shard, const StringView<TChar>& str, size_t hash)
+{
+	// Keep the entries aligned for their header
+	size_t size = sizeof(Entry) + (str.length() + 1) * sizeof(TChar);
+	size = (size + sizeof(Entry) - 1) / sizeof(Entry) * sizeof(Entry);
+
+	char* memory;
+	if (size > STRING_INTERN_SLAB_SIZE / 4)
+	{
+		// Long strings get a slab of their own, the current slab stays in use
+		memory = static_cast<char*>(::operator new(size));
+		shard.slabs.push_back(memory);
+		shard.memoryUsage += size;
+	}
+	else
+	{
+		if (static_cast<size_t>(shard.end - shard.current) < size)
+		{
+			shard.current = static_cast<char*>(::operator new(STRING_INTERN_SLAB_SIZE));
+			shard.end = shard.current + STRING_INTERN_SLAB_SIZE;
+			shard.slabs.push_back(shard.current);
+			shard.memoryUsage += STRING_INTERN_SLAB_SIZE;
+		}
+		memory = shard.current;
+		shard.current += size;
+	}
+
+	Entry* entry = reinterpret_cast<Entry*>(memory);
+	entry->hash = hash;
+	entry->length = str.length();
+	TChar* chars = reinterpret_cast<TChar*>(entry + 1);
+	memcpy(chars, str.data(), str.length() * sizeof(TChar));
+	chars[str.length()] = static_cast<TChar>(0);
+	return entry;
+}
+
+template<class TChar>
+void StringPool<TChar>::grow(Shard& shard)
+{
+	std::vector<const Entry*> table(shard.table.size() * 2, static_cast<const Entry*>(0));
+	size_t mask = table.size() - 1;
+	for (size_t i = 0; i < shard.table.size(); i++)
+	{
+		const Entry* entry = shard.table[i];
+		if (entry)
+		{
+			size_t index = entry->hash & mask;
+			while (table[index])
+			{
+				index = (index + 1) & mask;
+			}
+			table[index] = entry;
+		}
+	}
+	shard.table.swap(table);
+}
+
+template<class TChar>
+StringPool<TChar>::StringPool()
+{
+	for (size_t i = 0; i < STRING_INTERN_SHARDS; i++)
+	{
+		m_shards[i].table.assign(64, static_cast<const Entry*>(0));
+		m_shards[i].count = 0;
+		m_shards[i].current = 0;
+		m_shards[i].end = 0;
+		m_shards[i].memoryUsage = 0;
+	}
+}
+
+template<class TChar>
+StringPool<TChar>::~StringPool()
+{
+	for (size_t i = 0; i < STRING_INTERN_SHARDS; i++)
+	{
+		for (size_t j = 0; j < m_shards[i].slabs.size(); j++)
+		{
+			::operator delete(m_shards[i].slabs[j]);
+		}
+	}
+}
+
+template<class TChar>
+InternedString<TChar> StringPool<TChar>::intern(const StringView<TChar>& str)
+{
+	if (!str.length())
+	{
+		return InternedString<TChar>();
+	}
+
+	// The high bits select the shard, the low bits the slot in its table
+	size_t hash = str.hash();
+	Shard& shard = m_shards[(hash >> (sizeof(size_t) * 8 - 8)) & (STRING_INTERN_SHARDS - 1)];
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	size_t mask = shard.table.size() - 1;
+	size_t index = hash & mask;
+	while (const Entry* entry = shard.table[index])
+	{
+		if (entry->hash == hash && entry->length == str.length() &&
+			StringKernels<TChar>::equal(reinterpret_cast<const TChar*>(entry + 1), str.data(), str.length()))
+		{
+			return InternedString<TChar>(entry);
+		}
+		index = (index + 1) & mask;
+	}
+
+	// Insert a copy, keeping the table at most half full
+	const Entry* entry = store(shard, str, hash);
+	shard.table[index] = entry;
+	if (++shard.count * 2 > shard.table.size())
+	{
+		grow(shard);
+	}
+	return InternedString<TChar>(entry);
+}
+
+template<class TChar>
+size_t StringPool<TChar>::size()
+{
+	size_t size = 0;
+	for (size_t i = 0; i < STRING_INTERN_SHARDS; i++)
+	{
+		std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+		size += m_shards[i].count;
+	}
+	return size;
+}
+
+template<class TChar>
+size_t StringPool<TChar>::memoryUsage()
+{
+	size_t memoryUsage = 0;
+	for (size_t i = 0; i < STRING_INTERN_SHARDS; i++)
+	{
+		std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+		memoryUsage += m_shards[i].memoryUsage;
+	}
+	return memoryUsage;
+}
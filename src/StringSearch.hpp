@@ -0,0 +1,102 @@
+/**
+ * @file StringSearch.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGSEARCH_HPP
+#define STRINGSEARCH_HPP
+
+
+// For the vectorized search kernels
+#include "StringKernels.hpp"
+#include "StringView.hpp"
+
+
+// Needles of at least this length are searched using Boyer-Moore-Horspool instead of the vectorized filter
+#define STRING_SEARCH_HORSPOOL_LENGTH 64
+
+
+/**
+ * @class Searcher
+ * Precompiled search for a single needle, which can be reused for any count of haystacks. The algorithm is selected
+ * by the length of the needle: short needles are found by the vectorized first and last character filter of
+ * StringKernels, long ones by Boyer-Moore-Horspool, whose shift tables are built once by the constructor. The shifts
+ * are looked up by pairs of characters instead of single ones, which keeps them long on text of a small alphabet. The
+ * needle is not copied and must outlive the searcher.
+ */
+template<class TChar>
+class Searcher
+{
+private:
+	// Count of entries of the shift tables, pairs of characters are mapped to the entries by a hash
+	enum { TABLE_SIZE = 256 };
+
+	// Needle to search
+	StringView<TChar> m_needle;
+	// true if Boyer-Moore-Horspool is used
+	bool m_horspool;
+	// Shift for searching forwards by the last two characters of a window, only used by Boyer-Moore-Horspool
+	size_t m_shift[TABLE_SIZE];
+	// Shift for searching backwards by the first two characters of a window, only used by Boyer-Moore-Horspool
+	size_t m_reverseShift[TABLE_SIZE];
+	// Shift after a failed comparison of a window searching forwards
+	size_t m_matchShift;
+	// Shift after a failed comparison of a window searching backwards
+	size_t m_reverseMatchShift;
+
+	/**
+	 * Returns the entry of the shift tables for a pair of characters.
+	 * @param	pair	Pointer to the first character of the pair
+	 * @return		Index of the entry
+	 */
+	static size_t tableIndex(const TChar* pair);
+
+public:
+	/**
+	 * Constructor for instances of the class Searcher. Selects the algorithm and prepares it for the needle.
+	 * @param	needle	String to search
+	 */
+	explicit Searcher(const StringView<TChar>& needle);
+
+	/**
+	 * Returns the name of the algorithm selected for the needle.
+	 * @return	"horspool" or "filter"
+	 */
+	const char* algorithm() const;
+
+	/**
+	 * Searches the first occurrence of the needle.
+	 * @param	haystack	String to search in
+	 * @param	pos		Position to start searching at
+	 * @return			Position of the needle, StringView<TChar>::NOT_FOUND if it does not occur
+	 */
+	size_t find(const StringView<TChar>& haystack, size_t pos = 0) const;
+
+	/**
+	 * Searches the last occurrence of the needle.
+	 * @param	haystack	String to search in
+	 * @param	pos		Last position the needle may start at
+	 * @return			Position of the needle, StringView<TChar>::NOT_FOUND if it does not occur
+	 */
+	size_t rfind(const StringView<TChar>& haystack, size_t pos = StringView<TChar>::NOT_FOUND) const;
+
+	/**
+	 * Counts the non-overlapping occurrences of the needle. An empty needle is never counted.
+	 * @param	haystack	String to search in
+	 * @return			Count of occurrences
+	 */
+	size_t count(const StringView<TChar>& haystack) const;
+};
+
+
+// Include Searcher class implementation
+#include "StringSearch.tpp"
+
+
+// Typedef of the frequently used Searcher classes
+typedef Searcher<char> ASearcher;
+typedef Searcher<wchar_t> WSearcher;
+
+
+#endif // #ifndef STRINGSEARCH_HPP
@@ -0,0 +1,167 @@
+/**
+ * @file StringSearch.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGSEARCH_HPP
+#error STRINGSEARCH_HPP undefined
+#endif
+
+template<class TChar>
+size_t Searcher<TChar>::tableIndex(const TChar* pair)
+{
+	return ((static_cast<size_t>(pair[0]) << 3) ^ static_cast<size_t>(pair[1])) & (TABLE_SIZE - 1);
+}
+
+template<class TChar>
+Searcher<TChar>::Searcher(const StringView<TChar>& needle)
+	: m_needle(needle), m_horspool(needle.length() >= STRING_SEARCH_HORSPOOL_LENGTH && needle.length() > 1),
+	m_matchShift(0), m_reverseMatchShift(0)
+{
+	if (m_horspool)
+	{
+		// Shift a window until its last or first pair of characters is aligned to the nearest one in the needle
+		const TChar* data = needle.data();
+		size_t last = needle.length() - 1;
+		for (size_t i = 0; i < TABLE_SIZE; i++)
+		{
+			m_shift[i] = last;
+			m_reverseShift[i] = last;
+		}
+		for (size_t i = 1; i < last; i++)
+		{
+			m_shift[tableIndex(data + i - 1)] = last - i;
+		}
+		for (size_t i = last - 1; i > 0; i--)
+		{
+			m_reverseShift[tableIndex(data + i)] = i;
+		}
+
+		// Windows ending or starting with the pair of the needle are compared, a shift of 0 marks them
+		size_t lastPair = tableIndex(data + last - 1);
+		m_matchShift = m_shift[lastPair];
+		m_shift[lastPair] = 0;
+		size_t firstPair = tableIndex(data);
+		m_reverseMatchShift = m_reverseShift[firstPair];
+		m_reverseShift[firstPair] = 0;
+	}
+}
+
+template<class TChar>
+const char* Searcher<TChar>::algorithm() const
+{
+	return m_horspool ? "horspool" : "filter";
+}
+
+template<class TChar>
+size_t Searcher<TChar>::find(const StringView<TChar>& haystack, size_t pos) const
+{
+	size_t length = m_needle.length();
+	if (pos > haystack.length() || length > haystack.length() - pos)
+	{
+		return StringView<TChar>::NOT_FOUND;
+	}
+	if (!length)
+	{
+		return pos;
+	}
+
+	const TChar* text = haystack.data();
+	const TChar* needle = m_needle.data();
+	if (!m_horspool)
+	{
+		if (1 == length)
+		{
+			return haystack.find(needle[0], pos);
+		}
+		size_t found = StringKernels<TChar>::find(text + pos, haystack.length() - pos, needle, length);
+		return StringKernels<TChar>::NOT_FOUND == found ? StringView<TChar>::NOT_FOUND : pos + found;
+	}
+
+	// Shift by the last pair of characters of the window until it matches the one of the needle
+	size_t last = length - 1;
+	for (size_t end = haystack.length() - length; pos <= end;)
+	{
+		size_t shift = m_shift[tableIndex(text + pos + last - 1)];
+		if (!shift)
+		{
+			if (StringKernels<TChar>::equal(text + pos, needle, length))
+			{
+				return pos;
+			}
+			shift = m_matchShift;
+		}
+		pos += shift;
+	}
+	return StringView<TChar>::NOT_FOUND;
+}
+
+template<class TChar>
+size_t Searcher<TChar>::rfind(const StringView<TChar>& haystack, size_t pos) const
+{
+	size_t length = m_needle.length();
+	if (length > haystack.length())
+	{
+		return StringView<TChar>::NOT_FOUND;
+	}
+	if (pos > haystack.length() - length)
+	{
+		pos = haystack.length() - length;
+	}
+	if (!length)
+	{
+		return pos;
+	}
+
+	const TChar* text = haystack.data();
+	const TChar* needle = m_needle.data();
+	if (!m_horspool)
+	{
+		TChar firstChar = needle[0];
+		for (size_t i = pos + 1; i-- > 0;)
+		{
+			if (text[i] == firstChar && StringKernels<TChar>::equal(text + i + 1, needle + 1, length - 1))
+			{
+				return i;
+			}
+		}
+		return StringView<TChar>::NOT_FOUND;
+	}
+
+	// Shift by the first pair of characters of the window until it matches the one of the needle
+	for (;;)
+	{
+		size_t shift = m_reverseShift[tableIndex(text + pos)];
+		if (!shift)
+		{
+			if (StringKernels<TChar>::equal(text + pos, needle, length))
+			{
+				return pos;
+			}
+			shift = m_reverseMatchShift;
+		}
+		if (pos < shift)
+		{
+			return StringView<TChar>::NOT_FOUND;
+		}
+		pos -= shift;
+	}
+}
+
+template<class TChar>
+size_t Searcher<TChar>::count(const StringView<TChar>& haystack) const
+{
+	size_t length = m_needle.length();
+	if (!length)
+	{
+		return 0;
+	}
+
+	size_t count = 0;
+	for (size_t pos = find(haystack); StringView<TChar>::NOT_FOUND != pos; pos = find(haystack, pos + length))
+	{
+		count++;
+	}
+	return count;
+}
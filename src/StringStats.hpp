@@ -0,0 +1,315 @@
+/**
+ * @file StringStats.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGSTATS_HPP
+#define STRINGSTATS_HPP
+
+
+// For the counters updated by several threads
+#include <atomic>
+// For size_t
+#include <cstddef>
+// For uint64_t
+#include <cstdint>
+// For dumping the statistics
+#include <cstdio>
+
+
+// Enables the instrumentation of String, which counts allocations, reallocations and the final lengths and capacities
+// of strings in StringStats. Without it, the counters stay 0 and STRING_STATS_SITE expands to nothing.
+#ifndef STRING_STATS
+#define STRING_STATS 0
+#endif
+
+// Attributes the allocations and reallocations of String on the calling thread to a named call site until the end of
+// the enclosing block, e.g. STRING_STATS_SITE("parseRequest");
+#if STRING_STATS
+#define STRING_STATS_SITE(name) \
+	static StringStats::Site stringStatsSite(name, __FILE__, __LINE__); \
+	StringStats::Scope stringStatsScope(stringStatsSite)
+#else
+#define STRING_STATS_SITE(name)
+#endif
+
+
+/**
+ * @class StringStats
+ * Process-wide statistics of String used to tune STRING_SSO_BUFFER_CAPACITY and STRING_BUFFER_GROWTH_FACTOR from
+ * production data. Using STRING_STATS, String counts its heap allocations and the reallocations replacing a dynamically
+ * allocated buffer together with the bytes copied by them, and records the length and capacity of every destroyed
+ * string. Moved-from strings are counted as empty strings. Allocations and reallocations are additionally attributed
+ * to the innermost call site entered by STRING_STATS_SITE on the same thread. All counters are updated using relaxed
+ * atomics, so the statistics may be read and reset while other threads use strings.
+ */
+class StringStats
+{
+public:
+	enum
+	{
+		// Lengths counted exactly, which covers all sensible SSO capacities
+		SHORT_LENGTHS = 64,
+		// Count of length buckets, bucket 0 holds empty strings and bucket i lengths from 2^(i-1) to 2^i-1
+		LENGTH_BUCKETS = 65
+	};
+
+	/**
+	 * @struct Bucket
+	 * Destroyed strings of a length bucket.
+	 */
+	struct Bucket
+	{
+		// Count of strings
+		uint64_t strings;
+		// Count of strings using a dynamically allocated buffer
+		uint64_t heapStrings;
+		// Sum of the lengths of the strings using a dynamically allocated buffer in characters
+		uint64_t heapLength;
+		// Sum of the capacities of the strings using a dynamically allocated buffer in characters
+		uint64_t heapCapacity;
+	};
+
+	/**
+	 * @struct Snapshot
+	 * Copy of the counters at one point in time.
+	 */
+	struct Snapshot
+	{
+		// Count of dynamically allocated buffers
+		uint64_t allocations;
+		// Sum of the sizes of the allocated buffers in bytes
+		uint64_t allocatedBytes;
+		// Count of dynamically allocated buffers replaced by larger ones
+		uint64_t reallocations;
+		// Bytes copied from the replaced buffers
+		uint64_t copiedBytes;
+		// Count of destroyed strings which were empty
+		uint64_t emptyStrings;
+		// Count of destroyed non-empty strings stored in the SSO buffer
+		uint64_t ssoStrings;
+		// Count of destroyed strings using a dynamically allocated buffer
+		uint64_t heapStrings;
+		// Count of destroyed strings of every length below SHORT_LENGTHS
+		uint64_t shortLengths[SHORT_LENGTHS];
+		// Destroyed strings by the bucket of their length
+		Bucket buckets[LENGTH_BUCKETS];
+	};
+
+	/**
+	 * @class Site
+	 * Call site with its own allocation counters. Sites are usually static variables created by STRING_STATS_SITE,
+	 * they register themselves on construction and must live until the end of the process.
+	 */
+	class Site
+	{
+	private:
+		friend class StringStats;
+
+		// Name of the site
+		const char* m_name;
+		// Source file of the site
+		const char* m_file;
+		// Source line of the site
+		int m_line;
+		// Count of dynamically allocated buffers
+		std::atomic<uint64_t> m_allocations;
+		// Sum of the sizes of the allocated buffers in bytes
+		std::atomic<uint64_t> m_allocatedBytes;
+		// Count of dynamically allocated buffers replaced by larger ones
+		std::atomic<uint64_t> m_reallocations;
+		// Bytes copied from the replaced buffers
+		std::atomic<uint64_t> m_copiedBytes;
+		// Previously registered site
+		Site* m_next;
+
+		Site(const Site&);
+		Site& operator=(const Site&);
+
+	public:
+		/**
+		 * Constructor registering a call site.
+		 * @param	name	Name of the site
+		 * @param	file	Source file of the site
+		 * @param	line	Source line of the site
+		 */
+		Site(const char* name, const char* file, int line);
+
+		/**
+		 * Returns the name of the site.
+		 * @return	Name of the site
+		 */
+		const char* name() const;
+
+		/**
+		 * Returns the source file of the site.
+		 * @return	Source file of the site
+		 */
+		const char* file() const;
+
+		/**
+		 * Returns the source line of the site.
+		 * @return	Source line of the site
+		 */
+		int line() const;
+
+		/**
+		 * Returns the count of buffers allocated inside the site.
+		 * @return	Count of allocations
+		 */
+		uint64_t allocations() const;
+
+		/**
+		 * Returns the sum of the sizes of the buffers allocated inside the site.
+		 * @return	Allocated bytes
+		 */
+		uint64_t allocatedBytes() const;
+
+		/**
+		 * Returns the count of buffers replaced by larger ones inside the site.
+		 * @return	Count of reallocations
+		 */
+		uint64_t reallocations() const;
+
+		/**
+		 * Returns the count of bytes copied by the reallocations inside the site.
+		 * @return	Copied bytes
+		 */
+		uint64_t copiedBytes() const;
+
+		/**
+		 * Returns the previously registered site.
+		 * @return	Next site of the list returned by StringStats::sites, 0 for the last one
+		 */
+		const Site* next() const;
+	};
+
+	/**
+	 * @class Scope
+	 * Attributes the allocations of the calling thread to a site for the lifetime of the instance. Scopes can be
+	 * nested, the previous site is restored on destruction.
+	 */
+	class Scope
+	{
+	private:
+		// Site active before the scope was entered
+		Site* m_previous;
+
+		Scope(const Scope&);
+		Scope& operator=(const Scope&);
+
+	public:
+		/**
+		 * Constructor activating a site for the calling thread.
+		 * @param	site	Site to activate
+		 */
+		explicit Scope(Site& site);
+
+		/**
+		 * Destructor restoring the previously active site.
+		 */
+		~Scope();
+	};
+
+private:
+	/**
+	 * @struct Counters
+	 * Process-wide counters, see Snapshot.
+	 */
+	struct Counters
+	{
+		std::atomic<uint64_t> allocations;
+		std::atomic<uint64_t> allocatedBytes;
+		std::atomic<uint64_t> reallocations;
+		std::atomic<uint64_t> copiedBytes;
+		std::atomic<uint64_t> emptyStrings;
+		std::atomic<uint64_t> ssoStrings;
+		std::atomic<uint64_t> heapStrings;
+		std::atomic<uint64_t> shortLengths[SHORT_LENGTHS];
+		// Strings, heap strings, heap length and heap capacity of every bucket
+		std::atomic<uint64_t> buckets[LENGTH_BUCKETS][4];
+		// Most recently registered site
+		std::atomic<Site*> sites;
+	};
+
+	/**
+	 * Returns the process-wide counters, which are zero-initialized before any constructor runs.
+	 * @return	Counters
+	 */
+	static Counters& counters();
+
+	/**
+	 * Returns the site active for the calling thread.
+	 * @return	Reference to the pointer to the active site, 0 if no site is active
+	 */
+	static Site*& activeSite();
+
+	/**
+	 * Calculates the bucket of a length.
+	 * @param	length	Length of a string
+	 * @return		0 for empty strings, otherwise floor(log2(length)) + 1
+	 */
+	static size_t bucket(size_t length);
+
+	/**
+	 * Calculates a share in percent.
+	 * @param	part	Part of the total
+	 * @param	total	Total, may be 0
+	 * @return		Share in percent, 0 if total is 0
+	 */
+	static double percent(uint64_t part, uint64_t total);
+
+public:
+	/**
+	 * Counts a dynamically allocated buffer, called by String.
+	 * @param	bytes	Size of the buffer in bytes
+	 */
+	static void recordAllocation(size_t bytes);
+
+	/**
+	 * Counts a dynamically allocated buffer replaced by a larger one, called by String.
+	 * @param	copiedBytes	Bytes copied from the replaced buffer
+	 */
+	static void recordReallocation(size_t copiedBytes);
+
+	/**
+	 * Counts a destroyed string, called by String.
+	 * @param	length		Length of the string in characters
+	 * @param	capacity	Capacity of the string in characters
+	 * @param	dynamic		Whether the string uses a dynamically allocated buffer
+	 */
+	static void recordDestruction(size_t length, size_t capacity, bool dynamic);
+
+	/**
+	 * Copies the process-wide counters.
+	 * @return	Snapshot of the counters
+	 */
+	static Snapshot snapshot();
+
+	/**
+	 * Returns the registered call sites.
+	 * @return	Most recently registered site, the others follow using Site::next, 0 if there is none
+	 */
+	static const Site* sites();
+
+	/**
+	 * Sets all counters including the ones of the sites to 0. The sites stay registered.
+	 */
+	static void reset();
+
+	/**
+	 * Writes a report of the counters: allocations and reallocations, the share of strings fitting SSO buffers of
+	 * different capacities, the unused capacity of strings using a dynamically allocated buffer by length and the
+	 * counters of the call sites, the most recently registered one first.
+	 * @param	file	File to write to, e.g. stderr
+	 */
+	static void dump(FILE* file);
+};
+
+
+// Include StringStats class implementation
+#include "StringStats.tpp"
+
+
+#endif // #ifndef STRINGSTATS_HPP
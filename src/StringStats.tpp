@@ -0,0 +1,276 @@
+/**
+ * @file StringStats.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGSTATS_HPP
+#error STRINGSTATS_HPP undefined
+#endif
+
+inline StringStats::Site::Site(const char* name, const char* file, int line)
+	: m_name(name), m_file(file), m_line(line), m_allocations(0), m_allocatedBytes(0), m_reallocations(0),
+	m_copiedBytes(0), m_next(0)
+{
+	// Push the site onto the list of registered sites
+	std::atomic<Site*>& sites = counters().sites;
+	m_next = sites.load(std::memory_order_relaxed);
+	while (!sites.compare_exchange_weak(m_next, this, std::memory_order_release, std::memory_order_relaxed))
+	{
+		// m_next was updated to the current list, try again
+	}
+}
+
+inline const char* StringStats::Site::name() const
+{
+	return m_name;
+}
+
+inline const char* StringStats::Site::file() const
+{
+	return m_file;
+}
+
+inline int StringStats::Site::line() const
+{
+	return m_line;
+}
+
+inline uint64_t StringStats::Site::allocations() const
+{
+	return m_allocations.load(std::memory_order_relaxed);
+}
+
+inline uint64_t StringStats::Site::allocatedBytes() const
+{
+	return m_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+inline uint64_t StringStats::Site::reallocations() const
+{
+	return m_reallocations.load(std::memory_order_relaxed);
+}
+
+inline uint64_t StringStats::Site::copiedBytes() const
+{
+	return m_copiedBytes.load(std::memory_order_relaxed);
+}
+
+inline const StringStats::Site* StringStats::Site::next() const
+{
+	return m_next;
+}
+
+inline StringStats::Scope::Scope(Site& site)
+	: m_previous(activeSite())
+{
+	activeSite() = &site;
+}
+
+inline StringStats::Scope::~Scope()
+{
+	activeSite() = m_previous;
+}
+
+inline StringStats::Counters& StringStats::counters()
+{
+	// Atomics are trivially constructible, so the counters are initialized statically without a guard
+	static Counters counters;
+	return counters;
+}
+
+inline StringStats::Site*& StringStats::activeSite()
+{
+	static thread_local Site* site = 0;
+	return site;
+}
+
+inline size_t StringStats::bucket(size_t length)
+{
+	size_t bucket = 0;
+	while (length)
+	{
+		length >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+inline double StringStats::percent(uint64_t part, uint64_t total)
+{
+	return total ? 100.0 * static_cast<double>(part) / static_cast<double>(total) : 0.0;
+}
+
+inline void StringStats::recordAllocation(size_t bytes)
+{
+	Counters& counters = StringStats::counters();
+	counters.allocations.fetch_add(1, std::memory_order_relaxed);
+	counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+	Site* site = activeSite();
+	if (site)
+	{
+		site->m_allocations.fetch_add(1, std::memory_order_relaxed);
+		site->m_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+}
+
+inline void StringStats::recordReallocation(size_t copiedBytes)
+{
+	Counters& counters = StringStats::counters();
+	counters.reallocations.fetch_add(1, std::memory_order_relaxed);
+	counters.copiedBytes.fetch_add(copiedBytes, std::memory_order_relaxed);
+	Site* site = activeSite();
+	if (site)
+	{
+		site->m_reallocations.fetch_add(1, std::memory_order_relaxed);
+		site->m_copiedBytes.fetch_add(copiedBytes, std::memory_order_relaxed);
+	}
+}
+
+inline void StringStats::recordDestruction(size_t length, size_t capacity, bool dynamic)
+{
+	Counters& counters = StringStats::counters();
+	if (dynamic)
+	{
+		counters.heapStrings.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (length)
+	{
+		counters.ssoStrings.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		counters.emptyStrings.fetch_add(1, std::memory_order_relaxed);
+	}
+	if (length < SHORT_LENGTHS)
+	{
+		counters.shortLengths[length].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::atomic<uint64_t>* bucket = counters.buckets[StringStats::bucket(length)];
+	bucket[0].fetch_add(1, std::memory_order_relaxed);
+	if (dynamic)
+	{
+		bucket[1].fetch_add(1, std::memory_order_relaxed);
+		bucket[2].fetch_add(length, std::memory_order_relaxed);
+		bucket[3].fetch_add(capacity, std::memory_order_relaxed);
+	}
+}
+
+inline StringStats::Snapshot StringStats::snapshot()
+{
+	Counters& counters = StringStats::counters();
+	Snapshot snapshot;
+	snapshot.allocations = counters.allocations.load(std::memory_order_relaxed);
+	snapshot.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+	snapshot.reallocations = counters.reallocations.load(std::memory_order_relaxed);
+	snapshot.copiedBytes = counters.copiedBytes.load(std::memory_order_relaxed);
+	snapshot.emptyStrings = counters.emptyStrings.load(std::memory_order_relaxed);
+	snapshot.ssoStrings = counters.ssoStrings.load(std::memory_order_relaxed);
+	snapshot.heapStrings = counters.heapStrings.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < SHORT_LENGTHS; i++)
+	{
+		snapshot.shortLengths[i] = counters.shortLengths[i].load(std::memory_order_relaxed);
+	}
+	for (size_t i = 0; i < LENGTH_BUCKETS; i++)
+	{
+		snapshot.buckets[i].strings = counters.buckets[i][0].load(std::memory_order_relaxed);
+		snapshot.buckets[i].heapStrings = counters.buckets[i][1].load(std::memory_order_relaxed);
+		snapshot.buckets[i].heapLength = counters.buckets[i][2].load(std::memory_order_relaxed);
+		snapshot.buckets[i].heapCapacity = counters.buckets[i][3].load(std::memory_order_relaxed);
+	}
+	return snapshot;
+}
+
+inline const StringStats::Site* StringStats::sites()
+{
+	return counters().sites.load(std::memory_order_acquire);
+}
+
+inline void StringStats::reset()
+{
+	Counters& counters = StringStats::counters();
+	counters.allocations.store(0, std::memory_order_relaxed);
+	counters.allocatedBytes.store(0, std::memory_order_relaxed);
+	counters.reallocations.store(0, std::memory_order_relaxed);
+	counters.copiedBytes.store(0, std::memory_order_relaxed);
+	counters.emptyStrings.store(0, std::memory_order_relaxed);
+	counters.ssoStrings.store(0, std::memory_order_relaxed);
+	counters.heapStrings.store(0, std::memory_order_relaxed);
+	for (size_t i = 0; i < SHORT_LENGTHS; i++)
+	{
+		counters.shortLengths[i].store(0, std::memory_order_relaxed);
+	}
+	for (size_t i = 0; i < LENGTH_BUCKETS; i++)
+	{
+		for (size_t j = 0; j < 4; j++)
+		{
+			counters.buckets[i][j].store(0, std::memory_order_relaxed);
+		}
+	}
+	for (Site* site = counters.sites.load(std::memory_order_acquire); site; site = site->m_next)
+	{
+		site->m_allocations.store(0, std::memory_order_relaxed);
+		site->m_allocatedBytes.store(0, std::memory_order_relaxed);
+		site->m_reallocations.store(0, std::memory_order_relaxed);
+		site->m_copiedBytes.store(0, std::memory_order_relaxed);
+	}
+}
+
+inline void StringStats::dump(FILE* file)
+{
+	typedef unsigned long long Count;
+	Snapshot snapshot = StringStats::snapshot();
+	uint64_t strings = snapshot.emptyStrings + snapshot.ssoStrings + snapshot.heapStrings;
+
+	fprintf(file, "String statistics\n");
+	fprintf(file, "  allocations:   %llu (%llu bytes)\n", static_cast<Count>(snapshot.allocations),
+		static_cast<Count>(snapshot.allocatedBytes));
+	fprintf(file, "  reallocations: %llu (%llu bytes copied, %.2f per string on the heap)\n",
+		static_cast<Count>(snapshot.reallocations), static_cast<Count>(snapshot.copiedBytes),
+		snapshot.heapStrings ? static_cast<double>(snapshot.reallocations) / snapshot.heapStrings : 0.0);
+	fprintf(file, "  destroyed:     %llu strings, %llu empty, %llu in the SSO buffer, %llu on the heap\n",
+		static_cast<Count>(strings), static_cast<Count>(snapshot.emptyStrings), static_cast<Count>(snapshot.ssoStrings),
+		static_cast<Count>(snapshot.heapStrings));
+
+	// Share of the strings an SSO buffer of a capacity would hold
+	static const size_t capacities[] = { 7, 15, 23, 31, 47, 63 };
+	fprintf(file, "  SSO capacity   fitting strings\n");
+	uint64_t fitting = 0;
+	size_t length = 0;
+	for (size_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); i++)
+	{
+		for (; length <= capacities[i]; length++)
+		{
+			fitting += snapshot.shortLengths[length];
+		}
+		fprintf(file, "  %12u %16.1f%%\n", static_cast<unsigned>(capacities[i]), percent(fitting, strings));
+	}
+
+	// Unused capacity of the dynamically allocated buffers by length
+	fprintf(file, "  %21s %12s %12s %12s %8s\n", "length", "strings", "on heap", "capacity", "slack");
+	for (size_t i = 0; i < LENGTH_BUCKETS; i++)
+	{
+		const Bucket& bucket = snapshot.buckets[i];
+		if (bucket.strings)
+		{
+			Count first = i ? static_cast<Count>(1) << (i - 1) : 0;
+			Count last = i ? (first << 1) - 1 : 0;
+			fprintf(file, "  %10llu - %8llu %12llu %12llu %12llu %7.1f%%\n", first, last, static_cast<Count>(bucket.strings),
+				static_cast<Count>(bucket.heapStrings), static_cast<Count>(bucket.heapCapacity),
+				percent(bucket.heapCapacity - bucket.heapLength, bucket.heapCapacity));
+		}
+	}
+
+	// Call sites
+	if (sites())
+	{
+		fprintf(file, "  %-24s %12s %14s %14s %14s\n", "site", "allocations", "bytes", "reallocations", "copied bytes");
+		for (const Site* site = sites(); site; site = site->next())
+		{
+			fprintf(file, "  %-24s %12llu %14llu %14llu %14llu  %s:%d\n", site->name(), static_cast<Count>(site->allocations()),
+				static_cast<Count>(site->allocatedBytes()), static_cast<Count>(site->reallocations()),
+				static_cast<Count>(site->copiedBytes()), site->file(), site->line());
+		}
+	}
+}
@@ -0,0 +1,131 @@
+/**
+ * @file StringUtf.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGUTF_HPP
+#define STRINGUTF_HPP
+
+
+// For uint32_t
+#include <cstdint>
+// For the SIMD configuration
+#include "StringKernels.hpp"
+#include "String.hpp"
+
+
+/**
+ * @class StringUtf
+ * Validating transcoding between UTF-8 strings stored in AString and wide strings, which are UTF-16 if the wide
+ * character type has 2 bytes like wchar_t on Windows and UTF-32 if it has 4 bytes like wchar_t on Linux. The target
+ * String is resized once for the worst case and written directly. Runs of ASCII characters are converted 16
+ * characters at a time using SSE2, other characters are decoded one by one up to the next ASCII character. Invalid
+ * input, including overlong sequences, surrogate code points and unpaired UTF-16 surrogates, is rejected.
+ */
+class StringUtf
+{
+private:
+#if STRING_SIMD
+	/**
+	 * Calculates the length of the ASCII prefix of a block of 16 characters.
+	 * @param	mask	Mask with one bit per character set for ASCII characters, at least one bit is cleared
+	 * @return		Count of ASCII characters before the first non-ASCII one
+	 */
+	static size_t asciiPrefix(unsigned int mask);
+#endif
+
+	/**
+	 * Decodes and validates a UTF-8 sequence.
+	 * @param	bytes		Sequence to decode
+	 * @param	length		Count of bytes available
+	 * @param	codePoint	Decoded code point
+	 * @return			Length of the sequence in bytes, 0 if it is invalid
+	 */
+	static size_t decodeUtf8(const unsigned char* bytes, size_t length, uint32_t& codePoint);
+
+	/**
+	 * Encodes a code point as UTF-8.
+	 * @param	codePoint	Valid code point to encode
+	 * @param	bytes		Buffer for at least 4 bytes
+	 * @return			Length of the sequence in bytes
+	 */
+	static size_t encodeUtf8(uint32_t codePoint, char* bytes);
+
+	/**
+	 * Converts a run of ASCII characters from UTF-8 to a wide encoding.
+	 * @param	bytes	Bytes to convert
+	 * @param	length	Count of bytes available
+	 * @param	target	Buffer for at least length converted characters, which may be written behind the run
+	 * @return		Count of converted characters
+	 */
+	template<class TWide>
+	static size_t widenAscii(const unsigned char* bytes, size_t length, TWide* target);
+
+	/**
+	 * Converts a run of ASCII characters from a wide encoding to UTF-8.
+	 * @param	str	Characters to convert
+	 * @param	length	Count of characters available
+	 * @param	target	Buffer for at least length converted characters, which may be written behind the run
+	 * @return		Count of converted characters
+	 */
+	template<class TWide>
+	static size_t narrowAscii(const TWide* str, size_t length, char* target);
+
+	/**
+	 * Skips a run of ASCII characters.
+	 * @param	bytes	Bytes to check
+	 * @param	length	Count of bytes available
+	 * @return		Count of ASCII characters skipped
+	 */
+	static size_t skipAscii(const unsigned char* bytes, size_t length);
+
+public:
+	/**
+	 * Checks if a string is valid UTF-8.
+	 * @param	str	String to check
+	 * @return		true if the string is valid UTF-8, otherwise false
+	 */
+	static bool validate(const StringView<char>& str);
+
+	/**
+	 * Counts the code points of a valid UTF-8 string by counting the bytes which are no continuation bytes.
+	 * @param	str	Valid UTF-8 string
+	 * @return		Count of code points
+	 */
+	static size_t countCodePoints(const StringView<char>& str);
+
+	/**
+	 * Converts a UTF-8 string to UTF-16 or UTF-32 depending on the size of TWide.
+	 * @param	source	UTF-8 string to convert
+	 * @param	target	String receiving the converted string, empty if source is invalid
+	 * @return		true if source is valid UTF-8, otherwise false
+	 */
+	template<class TWide, class TAllocator>
+	static bool fromUtf8(const StringView<char>& source, String<TWide, TAllocator>& target);
+
+	/**
+	 * Converts a UTF-16 or UTF-32 string depending on the size of TWide to UTF-8.
+	 * @param	source	Wide string to convert
+	 * @param	target	String receiving the converted string, empty if source is invalid
+	 * @return		true if source is valid, otherwise false
+	 */
+	template<class TWide, class TAllocator>
+	static bool toUtf8(const StringView<TWide>& source, String<char, TAllocator>& target);
+
+	/**
+	 * Converts a UTF-16 or UTF-32 string depending on the size of TWide to UTF-8.
+	 * @param	source	Wide string to convert
+	 * @param	target	String receiving the converted string, empty if source is invalid
+	 * @return		true if source is valid, otherwise false
+	 */
+	template<class TWide, class TSourceAllocator, class TAllocator>
+	static bool toUtf8(const String<TWide, TSourceAllocator>& source, String<char, TAllocator>& target);
+};
+
+
+// Include StringUtf class implementation
+#include "StringUtf.tpp"
+
+
+#endif // #ifndef STRINGUTF_HPP
@@ -0,0 +1,406 @@
+/**
+ * @file StringUtf.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGUTF_HPP
+#error STRINGUTF_HPP undefined
+#endif
+
+#if STRING_SIMD
+inline size_t StringUtf::asciiPrefix(unsigned int mask)
+{
+	// The first cleared bit of the mask marks the first non-ASCII character
+	mask = ~mask;
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+inline size_t StringUtf::decodeUtf8(const unsigned char* bytes, size_t length, uint32_t& codePoint)
+{
+	unsigned char lead = bytes[0];
+	if (lead < 0x80)
+	{
+		codePoint = lead;
+		return 1;
+	}
+
+	// Leads below 0xC2 are continuation bytes or start overlong sequences, leads above 0xF4 exceed U+10FFFF
+	size_t size;
+	uint32_t minimum;
+	if (lead < 0xC2)
+	{
+		return 0;
+	}
+	else if (lead < 0xE0)
+	{
+		size = 2;
+		minimum = 0x80;
+		codePoint = lead & 0x1F;
+	}
+	else if (lead < 0xF0)
+	{
+		size = 3;
+		minimum = 0x800;
+		codePoint = lead & 0x0F;
+	}
+	else if (lead < 0xF5)
+	{
+		size = 4;
+		minimum = 0x10000;
+		codePoint = lead & 0x07;
+	}
+	else
+	{
+		return 0;
+	}
+	if (size > length)
+	{
+		return 0;
+	}
+
+	for (size_t i = 1; i < size; i++)
+	{
+		if ((bytes[i] & 0xC0) != 0x80)
+		{
+			return 0;
+		}
+		codePoint = (codePoint << 6) | (bytes[i] & 0x3F);
+	}
+	if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+	{
+		return 0;
+	}
+	return size;
+}
+
+inline size_t StringUtf::encodeUtf8(uint32_t codePoint, char* bytes)
+{
+	if (codePoint < 0x80)
+	{
+		bytes[0] = static_cast<char>(codePoint);
+		return 1;
+	}
+	if (codePoint < 0x800)
+	{
+		bytes[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+		bytes[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	if (codePoint < 0x10000)
+	{
+		bytes[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+		bytes[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		bytes[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+	bytes[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+	bytes[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+	bytes[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+	bytes[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+	return 4;
+}
+
+template<class TWide>
+size_t StringUtf::widenAscii(const unsigned char* bytes, size_t length, TWide* target)
+{
+	size_t i = 0;
+#if STRING_SIMD
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= length; i += 16)
+	{
+		// Zero-extend the bytes to the size of the wide characters, a block with non-ASCII bytes is stored as well but
+		// only its ASCII prefix is counted, the rest is overwritten later
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(chunk));
+		__m128i low = _mm_unpacklo_epi8(chunk, zero);
+		__m128i high = _mm_unpackhi_epi8(chunk, zero);
+		__m128i* out = reinterpret_cast<__m128i*>(target + i);
+		if (sizeof(TWide) == 2)
+		{
+			_mm_storeu_si128(out, low);
+			_mm_storeu_si128(out + 1, high);
+		}
+		else
+		{
+			_mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+			_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+			_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+			_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+		}
+		if (mask)
+		{
+			return i + asciiPrefix(~mask & 0xFFFF);
+		}
+	}
+#else
+	for (; i < length && bytes[i] < 0x80; i++)
+	{
+		target[i] = static_cast<TWide>(bytes[i]);
+	}
+#endif
+	return i;
+}
+
+template<class TWide>
+size_t StringUtf::narrowAscii(const TWide* str, size_t length, char* target)
+{
+	size_t i = 0;
+#if STRING_SIMD
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i nonAscii = sizeof(TWide) == 2 ? _mm_set1_epi16(static_cast<short>(0xFF80)) : _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+	for (; i + 16 <= length; i += 16)
+	{
+		// Mark the ASCII characters by one byte each and pack the characters to bytes, which is only correct for the
+		// ASCII prefix of the block
+		const __m128i* in = reinterpret_cast<const __m128i*>(str + i);
+		__m128i ascii;
+		__m128i chunk;
+		if (sizeof(TWide) == 2)
+		{
+			__m128i low = _mm_loadu_si128(in);
+			__m128i high = _mm_loadu_si128(in + 1);
+			ascii = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(low, nonAscii), zero), _mm_cmpeq_epi16(_mm_and_si128(high, nonAscii), zero));
+			chunk = _mm_packus_epi16(low, high);
+		}
+		else
+		{
+			__m128i part0 = _mm_loadu_si128(in);
+			__m128i part1 = _mm_loadu_si128(in + 1);
+			__m128i part2 = _mm_loadu_si128(in + 2);
+			__m128i part3 = _mm_loadu_si128(in + 3);
+			ascii = _mm_packs_epi16(
+				_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(part0, nonAscii), zero), _mm_cmpeq_epi32(_mm_and_si128(part1, nonAscii), zero)),
+				_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(part2, nonAscii), zero), _mm_cmpeq_epi32(_mm_and_si128(part3, nonAscii), zero)));
+			chunk = _mm_packus_epi16(_mm_packs_epi32(part0, part1), _mm_packs_epi32(part2, part3));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), chunk);
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(ascii));
+		if (mask != 0xFFFF)
+		{
+			return i + asciiPrefix(mask);
+		}
+	}
+#else
+	for (; i < length && static_cast<uint32_t>(str[i]) < 0x80; i++)
+	{
+		target[i] = static_cast<char>(str[i]);
+	}
+#endif
+	return i;
+}
+
+inline size_t StringUtf::skipAscii(const unsigned char* bytes, size_t length)
+{
+	size_t i = 0;
+#if STRING_SIMD
+	for (; i + 64 <= length; i += 64)
+	{
+		const __m128i* in = reinterpret_cast<const __m128i*>(bytes + i);
+		__m128i all = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(in), _mm_loadu_si128(in + 1)),
+			_mm_or_si128(_mm_loadu_si128(in + 2), _mm_loadu_si128(in + 3)));
+		if (_mm_movemask_epi8(all))
+		{
+			break;
+		}
+	}
+	for (; i + 16 <= length; i += 16)
+	{
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i))));
+		if (mask)
+		{
+			return i + asciiPrefix(~mask & 0xFFFF);
+		}
+	}
+#else
+	while (i < length && bytes[i] < 0x80)
+	{
+		i++;
+	}
+#endif
+	return i;
+}
+
+inline bool StringUtf::validate(const StringView<char>& str)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(str.data());
+	size_t length = str.length();
+	size_t i = 0;
+	while (i < length)
+	{
+		i += skipAscii(bytes + i, length - i);
+
+		// Decode the characters one by one until the next ASCII character
+		while (i < length)
+		{
+			uint32_t codePoint;
+			size_t size = decodeUtf8(bytes + i, length - i, codePoint);
+			if (!size)
+			{
+				return false;
+			}
+			i += size;
+			if (codePoint < 0x80)
+			{
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+inline size_t StringUtf::countCodePoints(const StringView<char>& str)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(str.data());
+	size_t length = str.length();
+	size_t count = 0;
+	size_t i = 0;
+#if STRING_SIMD
+	// Continuation bytes are 0x80 to 0xBF, which are the signed bytes up to -65
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i threshold = _mm_set1_epi8(-65);
+	while (i + 16 <= length)
+	{
+		// Count per byte lane for at most 255 blocks before the lanes could overflow
+		__m128i counts = zero;
+		for (size_t blocks = 0; blocks < 255 && i + 16 <= length; blocks++, i += 16)
+		{
+			__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+			counts = _mm_sub_epi8(counts, _mm_cmpgt_epi8(chunk, threshold));
+		}
+		__m128i sums = _mm_sad_epu8(counts, zero);
+		count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+	}
+#endif
+	for (; i < length; i++)
+	{
+		count += (bytes[i] & 0xC0) != 0x80 ? 1 : 0;
+	}
+	return count;
+}
+
+template<class TWide, class TAllocator>
+bool StringUtf::fromUtf8(const StringView<char>& source, String<TWide, TAllocator>& target)
+{
+	static_assert(sizeof(TWide) == 2 || sizeof(TWide) == 4, "Wide characters have to be UTF-16 or UTF-32 code units");
+
+	// Every byte becomes at most one code unit, 4 byte sequences become 2 UTF-16 code units
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(source.data());
+	size_t length = source.length();
+	target.setLength(0);
+	target.setCapacity(length);
+	TWide* out = target.data();
+
+	size_t i = 0;
+	size_t written = 0;
+	while (i < length)
+	{
+		size_t ascii = widenAscii(bytes + i, length - i, out + written);
+		i += ascii;
+		written += ascii;
+
+		// Decode the characters one by one until the next ASCII character
+		while (i < length)
+		{
+			uint32_t codePoint;
+			size_t size = decodeUtf8(bytes + i, length - i, codePoint);
+			if (!size)
+			{
+				out[0] = static_cast<TWide>(0);
+				target.setLength(0);
+				return false;
+			}
+			i += size;
+
+			if (sizeof(TWide) == 2 && codePoint >= 0x10000)
+			{
+				// Split into a surrogate pair
+				codePoint -= 0x10000;
+				out[written++] = static_cast<TWide>(0xD800 | (codePoint >> 10));
+				out[written++] = static_cast<TWide>(0xDC00 | (codePoint & 0x3FF));
+			}
+			else
+			{
+				out[written++] = static_cast<TWide>(codePoint);
+				if (codePoint < 0x80)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	out[written] = static_cast<TWide>(0);
+	target.setLength(written);
+	return true;
+}
+
+template<class TWide, class TAllocator>
+bool StringUtf::toUtf8(const StringView<TWide>& source, String<char, TAllocator>& target)
+{
+	static_assert(sizeof(TWide) == 2 || sizeof(TWide) == 4, "Wide characters have to be UTF-16 or UTF-32 code units");
+
+	// A UTF-16 code unit becomes at most 3 bytes, a surrogate pair 4 bytes, a UTF-32 code unit at most 4 bytes
+	const TWide* str = source.data();
+	size_t length = source.length();
+	target.setLength(0);
+	target.setCapacity(length * (sizeof(TWide) == 2 ? 3 : 4));
+	char* out = target.data();
+
+	size_t i = 0;
+	size_t written = 0;
+	while (i < length)
+	{
+		size_t ascii = narrowAscii(str + i, length - i, out + written);
+		i += ascii;
+		written += ascii;
+
+		// Encode the characters one by one until the next ASCII character
+		for (; i < length; i++)
+		{
+			uint32_t codePoint = sizeof(TWide) == 2 ? static_cast<uint16_t>(str[i]) : static_cast<uint32_t>(str[i]);
+			if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+			{
+				// Only UTF-16 allows surrogates, a high one followed by a low one
+				uint32_t low = i + 1 < length ? static_cast<uint16_t>(str[i + 1]) : 0;
+				if (sizeof(TWide) != 2 || codePoint > 0xDBFF || low < 0xDC00 || low > 0xDFFF)
+				{
+					out[0] = 0;
+					target.setLength(0);
+					return false;
+				}
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				i++;
+			}
+			else if (codePoint > 0x10FFFF)
+			{
+				out[0] = 0;
+				target.setLength(0);
+				return false;
+			}
+			written += encodeUtf8(codePoint, out + written);
+			if (codePoint < 0x80)
+			{
+				i++;
+				break;
+			}
+		}
+	}
+
+	out[written] = 0;
+	target.setLength(written);
+	return true;
+}
+
+template<class TWide, class TSourceAllocator, class TAllocator>
+bool StringUtf::toUtf8(const String<TWide, TSourceAllocator>& source, String<char, TAllocator>& target)
+{
+	return toUtf8(StringView<TWide>(source), target);
+}
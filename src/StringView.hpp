@@ -0,0 +1,325 @@
+/**
+ * @file StringView.hpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGVIEW_HPP
+#define STRINGVIEW_HPP
+
+
+// For memchr
+#include <cstring>
+// For std::hash
+#include <functional>
+// For std::make_unsigned
+#include <type_traits>
+// For the vectorized c-string routines
+#include "StringKernels.hpp"
+// For hashing the characters
+#include "StringHash.hpp"
+// For parsing numbers
+#include "StringNumber.hpp"
+
+
+// Declaration of the class String, which can be viewed without copying
+template<class TChar, class TAllocator>
+class String;
+
+// Declaration of the class Searcher, which implements the search methods
+template<class TChar>
+class Searcher;
+
+
+/**
+ * @class StringView
+ * Non-owning view of a sequence of characters consisting of a pointer and a length. A view is not required to be
+ * zero-terminated and never allocates, so substrings, searches and tokenization of a String or any other buffer
+ * are free of copies. The viewed characters must outlive the view.
+ */
+template<class TChar>
+class StringView
+{
+private:
+	// Pointer to the first viewed character
+	const TChar* m_data;
+	// Count of viewed characters
+	size_t m_length;
+
+public:
+	// Position returned by the search methods if nothing was found
+	static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+	/**
+	 * @class TokenIterator
+	 * Splits a view lazily into the tokens separated by a delimiter or any of a set of delimiters. Tokens are views
+	 * into the split view, nothing is allocated.
+	 */
+	class TokenIterator
+	{
+	private:
+		// Not yet tokenized rest of the view
+		StringView<TChar> m_rest;
+		// Set of delimiters
+		StringView<TChar> m_delimiters;
+		// Single delimiter, used if the set of delimiters is empty
+		TChar m_delimiter;
+		// true if empty tokens are skipped
+		bool m_skipEmpty;
+		// true if all tokens were returned
+		bool m_done;
+
+	public:
+		/**
+		 * Constructor for tokens separated by a single delimiter.
+		 * @param	text		View to split
+		 * @param	delimiter	Delimiter separating the tokens
+		 * @param	skipEmpty	true to skip empty tokens between consecutive delimiters
+		 */
+		TokenIterator(const StringView<TChar>& text, TChar delimiter, bool skipEmpty = false);
+
+		/**
+		 * Constructor for tokens separated by any of a set of delimiters.
+		 * @param	text		View to split
+		 * @param	delimiters	Characters separating the tokens
+		 * @param	skipEmpty	true to skip empty tokens between consecutive delimiters
+		 */
+		TokenIterator(const StringView<TChar>& text, const StringView<TChar>& delimiters, bool skipEmpty = false);
+
+		/**
+		 * Returns the next token.
+		 * @param	token	Receives the next token
+		 * @return		true if a token was returned, false if all tokens were returned
+		 */
+		bool next(StringView<TChar>& token);
+	};
+
+	/**
+	 * Default constructor for instances of the class StringView. Constructs an empty view.
+	 */
+	StringView();
+
+	/**
+	 * Constructor which creates a view of a zero-terminated c-string.
+	 * @param	str	C-string to view
+	 */
+	StringView(const TChar* str);
+
+	/**
+	 * Constructor which creates a view of a buffer.
+	 * @param	data	Pointer to the first character to view
+	 * @param	length	Count of characters to view
+	 */
+	StringView(const TChar* data, size_t length);
+
+	/**
+	 * Constructor which creates a view of the string stored in a String.
+	 * @param	str	String to view
+	 */
+	template<class TAllocator>
+	StringView(const String<TChar, TAllocator>& str);
+
+	/**
+	 * Returns a pointer to the first viewed character. The characters are not necessarily zero-terminated.
+	 * @return	Pointer to the first viewed character
+	 */
+	const TChar* data() const;
+
+	/**
+	 * Returns the count of viewed characters.
+	 * @return	Length of the view in characters
+	 */
+	size_t length() const;
+
+	/**
+	 * Returns a viewed character.
+	 * @param	pos	Position of the character, must be less than length()
+	 * @return		Character at pos
+	 */
+	TChar operator[](size_t pos) const;
+
+	/**
+	 * Returns a view of a part of the view.
+	 * @param	pos	Position of the first character, clamped to the length
+	 * @param	len	Count of characters, clamped to the end of the view
+	 * @return		View of the part
+	 */
+	StringView<TChar> substr(size_t pos, size_t len = NOT_FOUND) const;
+
+	/**
+	 * Searches the first occurrence of a character.
+	 * @param	c	Character to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the character, NOT_FOUND if it does not occur
+	 */
+	size_t find(TChar c, size_t pos = 0) const;
+
+	/**
+	 * Searches the first occurrence of a string.
+	 * @param	needle	String to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the string, NOT_FOUND if it does not occur
+	 */
+	size_t find(const StringView<TChar>& needle, size_t pos = 0) const;
+
+	/**
+	 * Searches the last occurrence of a string.
+	 * @param	needle	String to search
+	 * @param	pos	Last position the string may start at
+	 * @return		Position of the string, NOT_FOUND if it does not occur
+	 */
+	size_t rfind(const StringView<TChar>& needle, size_t pos = NOT_FOUND) const;
+
+	/**
+	 * Searches the first occurrence of any character of a set.
+	 * @param	set	Characters to search
+	 * @param	pos	Position to start searching at
+	 * @return		Position of the first character contained in set, NOT_FOUND if none occurs
+	 */
+	size_t findFirstOf(const StringView<TChar>& set, size_t pos = 0) const;
+
+	/**
+	 * Checks if a string occurs in the view.
+	 * @param	needle	String to search
+	 * @return		true if needle occurs, otherwise false
+	 */
+	bool contains(const StringView<TChar>& needle) const;
+
+	/**
+	 * Counts the non-overlapping occurrences of a string. An empty string is never counted.
+	 * @param	needle	String to count
+	 * @return		Count of occurrences
+	 */
+	size_t count(const StringView<TChar>& needle) const;
+
+	/**
+	 * Checks if the view starts with a string.
+	 * @param	prefix	String to check
+	 * @return		true if the view starts with prefix, otherwise false
+	 */
+	bool startsWith(const StringView<TChar>& prefix) const;
+
+	/**
+	 * Checks if the view ends with a string.
+	 * @param	suffix	String to check
+	 * @return		true if the view ends with suffix, otherwise false
+	 */
+	bool endsWith(const StringView<TChar>& suffix) const;
+
+	/**
+	 * Compares the view lexicographically to another one. Characters are compared as unsigned values, so the order of
+	 * char strings matches std::string and memcmp.
+	 * @param	other	View to compare to
+	 * @return		0 if both views are equal, -1 if the view is ordered before other, otherwise 1
+	 */
+	int compare(const StringView<TChar>& other) const;
+
+	/**
+	 * Calculates the hash of the characters using StringHash. Equal strings have equal hashes regardless of whether
+	 * they are stored in a String, a view or a StringPool.
+	 * @return	Hash of the view
+	 */
+	size_t hash() const;
+
+	/**
+	 * Calls a function for every token separated by a delimiter, including empty ones.
+	 * @param	delimiter	Delimiter separating the tokens
+	 * @param	function	Function called with every token as a StringView
+	 * @return			Count of tokens
+	 */
+	template<class TFunction>
+	size_t split(TChar delimiter, TFunction function) const;
+
+	/**
+	 * Parses the whole view as a signed decimal integer, see StringNumber::parseInt.
+	 * @param	value	Parsed value, unchanged if the view is no valid integer
+	 * @return		true if the view was parsed, otherwise false
+	 */
+	bool parseInt(int64_t& value) const;
+
+	/**
+	 * Parses the whole view as an unsigned decimal integer, see StringNumber::parseUInt.
+	 * @param	value	Parsed value, unchanged if the view is no valid integer
+	 * @return		true if the view was parsed, otherwise false
+	 */
+	bool parseUInt(uint64_t& value) const;
+
+	/**
+	 * Parses the whole view as a double rounded correctly, see StringNumber::parseDouble.
+	 * @param	value	Parsed value, unchanged if the view is no valid double
+	 * @return		true if the view was parsed, otherwise false
+	 */
+	bool parseDouble(double& value) const;
+
+	/**
+	 * Equal operator. Checks if two views contain the same characters.
+	 * @param	other	View to compare to
+	 * @return		true if both views are equal, otherwise false
+	 */
+	bool operator==(const StringView<TChar>& other) const;
+
+	/**
+	 * Unequal operator. Checks if two views contain different characters.
+	 * @param	other	View to compare to
+	 * @return		true if both views are unequal, otherwise false
+	 */
+	bool operator!=(const StringView<TChar>& other) const;
+
+	/**
+	 * Less operator. Checks if the view is ordered lexicographically before another one.
+	 * @param	other	View to compare to
+	 * @return		true if the view is ordered before other, otherwise false
+	 */
+	bool operator<(const StringView<TChar>& other) const;
+
+	/**
+	 * Less or equal operator. Checks if the view is not ordered lexicographically after another one.
+	 * @param	other	View to compare to
+	 * @return		true if the view is not ordered after other, otherwise false
+	 */
+	bool operator<=(const StringView<TChar>& other) const;
+
+	/**
+	 * Greater operator. Checks if the view is ordered lexicographically after another one.
+	 * @param	other	View to compare to
+	 * @return		true if the view is ordered after other, otherwise false
+	 */
+	bool operator>(const StringView<TChar>& other) const;
+
+	/**
+	 * Greater or equal operator. Checks if the view is not ordered lexicographically before another one.
+	 * @param	other	View to compare to
+	 * @return		true if the view is not ordered before other, otherwise false
+	 */
+	bool operator>=(const StringView<TChar>& other) const;
+};
+
+
+// Include StringView class implementation
+#include "StringView.tpp"
+// Include the Searcher class used by the search methods
+#include "StringSearch.hpp"
+
+
+/**
+ * Specialization of std::hash for StringView, hashing the characters.
+ */
+namespace std
+{
+	template<class TChar>
+	struct hash<StringView<TChar> >
+	{
+		size_t operator()(const StringView<TChar>& str) const
+		{
+			return str.hash();
+		}
+	};
+}
+
+
+// Typedef of the frequently used StringView classes
+typedef StringView<char> AStringView;
+typedef StringView<wchar_t> WStringView;
+
+
+#endif // #ifndef STRINGVIEW_HPP
@@ -0,0 +1,284 @@
+/**
+ * @file StringView.tpp
+ * @date 17.10.2026
+ * @author Christian Hlsmann (christian_huelsmann@gmx.de)
+ */
+
+#ifndef STRINGVIEW_HPP
+#error STRINGVIEW_HPP undefined
+#endif
+
+template<class TChar>
+const size_t StringView<TChar>::NOT_FOUND;
+
+template<class TChar>
+StringView<TChar>::TokenIterator::TokenIterator(const StringView<TChar>& text, TChar delimiter, bool skipEmpty)
+	: m_rest(text), m_delimiter(delimiter), m_skipEmpty(skipEmpty), m_done(false)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+StringView<TChar>::TokenIterator::TokenIterator(const StringView<TChar>& text, const StringView<TChar>& delimiters, bool skipEmpty)
+	: m_rest(text), m_delimiters(delimiters), m_delimiter(static_cast<TChar>(0)), m_skipEmpty(skipEmpty), m_done(false)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+bool StringView<TChar>::TokenIterator::next(StringView<TChar>& token)
+{
+	while (!m_done)
+	{
+		// Search the end of the next token
+		size_t end = m_delimiters.length() ? m_rest.findFirstOf(m_delimiters) : m_rest.find(m_delimiter);
+
+		if (NOT_FOUND == end)
+		{
+			// The rest is the last token
+			token = m_rest;
+			m_done = true;
+		}
+		else
+		{
+			token = m_rest.substr(0, end);
+			m_rest = m_rest.substr(end + 1);
+		}
+
+		if (token.length() || !m_skipEmpty)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+template<class TChar>
+StringView<TChar>::StringView()
+	: m_data(0), m_length(0)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+StringView<TChar>::StringView(const TChar* str)
+	: m_data(str), m_length(str ? StringKernels<TChar>::length(str) : 0)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+StringView<TChar>::StringView(const TChar* data, size_t length)
+	: m_data(data), m_length(length)
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+template<class TAllocator>
+StringView<TChar>::StringView(const String<TChar, TAllocator>& str)
+	: m_data(str.c_str()), m_length(str.length())
+{
+	// Nothing to do yet
+}
+
+template<class TChar>
+const TChar* StringView<TChar>::data() const
+{
+	return m_data;
+}
+
+template<class TChar>
+size_t StringView<TChar>::length() const
+{
+	return m_length;
+}
+
+template<class TChar>
+TChar StringView<TChar>::operator[](size_t pos) const
+{
+	return m_data[pos];
+}
+
+template<class TChar>
+StringView<TChar> StringView<TChar>::substr(size_t pos, size_t len) const
+{
+	if (pos > m_length)
+	{
+		pos = m_length;
+	}
+	if (len > m_length - pos)
+	{
+		len = m_length - pos;
+	}
+	return StringView<TChar>(m_data + pos, len);
+}
+
+template<class TChar>
+size_t StringView<TChar>::find(TChar c, size_t pos) const
+{
+	if (pos >= m_length)
+	{
+		return NOT_FOUND;
+	}
+	if (sizeof(TChar) == 1)
+	{
+		const void* found = memchr(m_data + pos, static_cast<unsigned char>(c), m_length - pos);
+		return found ? static_cast<const TChar*>(found) - m_data : NOT_FOUND;
+	}
+	size_t found = StringKernels<TChar>::find(m_data + pos, m_length - pos, &c, 1);
+	return StringKernels<TChar>::NOT_FOUND == found ? NOT_FOUND : pos + found;
+}
+
+template<class TChar>
+size_t StringView<TChar>::find(const StringView<TChar>& needle, size_t pos) const
+{
+	return Searcher<TChar>(needle).find(*this, pos);
+}
+
+template<class TChar>
+size_t StringView<TChar>::rfind(const StringView<TChar>& needle, size_t pos) const
+{
+	return Searcher<TChar>(needle).rfind(*this, pos);
+}
+
+template<class TChar>
+size_t StringView<TChar>::findFirstOf(const StringView<TChar>& set, size_t pos) const
+{
+	if (1 == set.m_length)
+	{
+		return find(set.m_data[0], pos);
+	}
+
+	// Mark the characters of the set by their lowest byte, wider characters are confirmed by searching the set
+	bool marked[256] = {};
+	for (size_t i = 0; i < set.m_length; i++)
+	{
+		marked[static_cast<size_t>(set.m_data[i]) & 255] = true;
+	}
+	for (size_t i = pos; i < m_length; i++)
+	{
+		if (marked[static_cast<size_t>(m_data[i]) & 255] && (sizeof(TChar) == 1 || NOT_FOUND != set.find(m_data[i])))
+		{
+			return i;
+		}
+	}
+	return NOT_FOUND;
+}
+
+template<class TChar>
+bool StringView<TChar>::contains(const StringView<TChar>& needle) const
+{
+	return NOT_FOUND != find(needle);
+}
+
+template<class TChar>
+size_t StringView<TChar>::count(const StringView<TChar>& needle) const
+{
+	return Searcher<TChar>(needle).count(*this);
+}
+
+template<class TChar>
+bool StringView<TChar>::startsWith(const StringView<TChar>& prefix) const
+{
+	return prefix.m_length <= m_length && StringKernels<TChar>::equal(m_data, prefix.m_data, prefix.m_length);
+}
+
+template<class TChar>
+bool StringView<TChar>::endsWith(const StringView<TChar>& suffix) const
+{
+	return suffix.m_length <= m_length && StringKernels<TChar>::equal(m_data + m_length - suffix.m_length, suffix.m_data, suffix.m_length);
+}
+
+template<class TChar>
+int StringView<TChar>::compare(const StringView<TChar>& other) const
+{
+	// Order the characters as unsigned values like memcmp, so UTF-8 strings sort by code points
+	typedef typename std::make_unsigned<TChar>::type Unsigned;
+	size_t length = m_length < other.m_length ? m_length : other.m_length;
+	size_t index = StringKernels<TChar>::mismatchBuffer(m_data, other.m_data, length);
+	if (index < length)
+	{
+		return static_cast<Unsigned>(m_data[index]) < static_cast<Unsigned>(other.m_data[index]) ? -1 : 1;
+	}
+	if (m_length == other.m_length)
+	{
+		return 0;
+	}
+	return m_length < other.m_length ? -1 : 1;
+}
+
+template<class TChar>
+size_t StringView<TChar>::hash() const
+{
+	return static_cast<size_t>(StringHash::hash(m_data, m_length * sizeof(TChar)));
+}
+
+template<class TChar>
+template<class TFunction>
+size_t StringView<TChar>::split(TChar delimiter, TFunction function) const
+{
+	size_t count = 0;
+	StringView<TChar> token;
+	TokenIterator iterator(*this, delimiter);
+	while (iterator.next(token))
+	{
+		function(token);
+		count++;
+	}
+	return count;
+}
+
+template<class TChar>
+bool StringView<TChar>::parseInt(int64_t& value) const
+{
+	return StringNumber::parseInt(m_data, m_length, value);
+}
+
+template<class TChar>
+bool StringView<TChar>::parseUInt(uint64_t& value) const
+{
+	return StringNumber::parseUInt(m_data, m_length, value);
+}
+
+template<class TChar>
+bool StringView<TChar>::parseDouble(double& value) const
+{
+	return StringNumber::parseDouble(m_data, m_length, value);
+}
+
+template<class TChar>
+bool StringView<TChar>::operator==(const StringView<TChar>& other) const
+{
+	return m_length == other.m_length && StringKernels<TChar>::equal(m_data, other.m_data, m_length);
+}
+
+template<class TChar>
+bool StringView<TChar>::operator!=(const StringView<TChar>& other) const
+{
+	return !(*this == other);
+}
+
+template<class TChar>
+bool StringView<TChar>::operator<(const StringView<TChar>& other) const
+{
+	return compare(other) < 0;
+}
+
+template<class TChar>
+bool StringView<TChar>::operator<=(const StringView<TChar>& other) const
+{
+	return compare(other) <= 0;
+}
+
+template<class TChar>
+bool StringView<TChar>::operator>(const StringView<TChar>& other) const
+{
+	return compare(other) > 0;
+}
+
+template<class TChar>
+bool StringView<TChar>::operator>=(const StringView<TChar>& other) const
+{
+	return compare(other) >= 0;
+}
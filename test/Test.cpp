@@ -4,8 +4,99 @@
  * @author Christian Hülsmann (christian_huelsmann@gmx.de)
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+// Some C libraries define PAGE_SIZE in <limits.h>, which must not break the headers
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 4096
+#endif
 #include "../src/String.hpp"
+#include "../src/FixedString.hpp"
+#include "../src/HashedString.hpp"
+#include "../src/MultiMatcher.hpp"
+#include "../src/StringParallel.hpp"
+#include "../src/Rope.hpp"
+#include "../src/StringPool.hpp"
+#include "../src/StringUtf.hpp"
+#include "../src/StringView.hpp"
+
+#if defined(__unix__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if STRING_POSIX_IO
+#include "../src/StringFile.hpp"
+#endif
+
+// Count of calls to operator new[], which is used by String to allocate its dynamic buffer, on all threads
+static std::atomic<size_t> g_arrayAllocations(0);
+
+/**
+ * Replacement of the global operator new[] counting the allocations done by String. The replaced array operators only
+ * forward to the scalar ones of the standard library, so every pointer is released by the matching deallocation function.
+ * @param	size	Size of the memory block to allocate in bytes
+ * @return		Pointer to the allocated memory block
+ */
+void* operator new[](size_t size)
+{
+	g_arrayAllocations++;
+	return ::operator new(size);
+}
+
+/**
+ * Replacement of the global non-throwing operator new[] counting the allocations.
+ * @param	size	Size of the memory block to allocate in bytes
+ * @param	tag		Tag selecting the non-throwing version
+ * @return		Pointer to the allocated memory block or nullptr on failure
+ */
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+	g_arrayAllocations++;
+	return ::operator new(size, tag);
+}
+
+/**
+ * Replacement of the global operator delete[] matching the replaced operator new[].
+ * @param	memory	Pointer to the memory block to deallocate
+ */
+void operator delete[](void* memory) noexcept
+{
+	::operator delete(memory);
+}
+
+/**
+ * Replacement of the global non-throwing operator delete[] matching the replaced operator new[].
+ * @param	memory	Pointer to the memory block to deallocate
+ * @param	tag		Tag selecting the non-throwing version
+ */
+void operator delete[](void* memory, const std::nothrow_t& tag) noexcept
+{
+	::operator delete(memory, tag);
+}
+
+#if defined(__cpp_sized_deallocation)
+/**
+ * Replacement of the global sized operator delete[] matching the replaced operator new[].
+ * @param	memory	Pointer to the memory block to deallocate
+ * @param	size	Size of the memory block in bytes
+ */
+void operator delete[](void* memory, size_t size) noexcept
+{
+	::operator delete(memory, size);
+}
+#endif
 
 /**
  * Prints an error message to the standart error stream if a given expression is false.
@@ -20,6 +111,29 @@ static void dynamic_assert(const bool expression, const char* errorMessage)
 	}
 }
 
+/**
+ * Tests if a string created without an initial capacity has the expected capacity, which is the capacity of the SSO
+ * buffer if the string fits into it.
+ * @param	string	String to test
+ * @return		True if the capacity is the expected one
+ */
+template<class TString>
+static bool hasInitialCapacity(const TString& string)
+{
+	return string.length() <= TString::ssoCapacity() ? TString::ssoCapacity() == string.capacity() : string.length() <= string.capacity();
+}
+
+/**
+ * Generates deterministic pseudo random numbers.
+ * @param	state	State of the generator, updated by the call
+ * @return		Pseudo random number
+ */
+static size_t nextRandom(size_t& state)
+{
+	state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return static_cast<size_t>(state >> 33);
+}
+
 /** 
  * Tests the constructos of the class String.
  */
@@ -33,9 +147,9 @@ static void TestConstructors()
 	dynamic_assert(0 == astring1.length(), "Error, length of astring is not zero after instantiation via the default constructor");
 	dynamic_assert(0 == wstring1.length(), "Error, length of wstring is not zero after instantiation via the default constructor");
 
-	// Test if initial capacity is STRING_SSO_BUFFER_CAPACITY
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == astring1.capacity(), "Error, capacity of astring is not the expected initial capacity after instantiation via the default constructor");
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == wstring1.capacity(), "Error, capacity of wstring is not the expected initial capacity after instantiation via the default constructor");
+	// Test if initial capacity is the capacity of the SSO buffer
+	dynamic_assert(AString::ssoCapacity() == astring1.capacity(), "Error, capacity of astring is not the expected initial capacity after instantiation via the default constructor");
+	dynamic_assert(WString::ssoCapacity() == wstring1.capacity(), "Error, capacity of wstring is not the expected initial capacity after instantiation via the default constructor");
 
 
 	// Test String(size_t initialCapacity) constructor
@@ -61,9 +175,9 @@ static void TestConstructors()
 	dynamic_assert(14 == astring3.length(), "Error in the constructor taking a c-string as a parameter");
 	dynamic_assert(14 == wstring3.length(), "Error in the constructor taking a c-string as a parameter");
 
-	// Test if initial capacity is STRING_SSO_BUFFER_CAPACITY
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == astring3.capacity(), "Error, capacity of astring is not the expected initial capacity after instantiation via the constructor taking a c-string as a parameter");
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == wstring3.capacity(), "Error, capacity of wstring is not the expected initial capacity after instantiation via the constructor taking a c-string as a parameter");
+	// Test if initial capacity is the capacity of the SSO buffer if the string fits into it
+	dynamic_assert(hasInitialCapacity(astring3), "Error, capacity of astring is not the expected initial capacity after instantiation via the constructor taking a c-string as a parameter");
+	dynamic_assert(hasInitialCapacity(wstring3), "Error, capacity of wstring is not the expected initial capacity after instantiation via the constructor taking a c-string as a parameter");
 
 	// Try passing pos and len
 	AString astring4(toCopyA, 1, 5);
@@ -90,9 +204,9 @@ static void TestConstructors()
 	dynamic_assert(14 == astring6.length(), "Error in the copy-constructor, astring has an unexpected length");
 	dynamic_assert(14 == wstring6.length(), "Error in the copy-constructor, wstring has an unexpected length");
 
-	// Test if initial capacity is STRING_SSO_BUFFER_CAPACITY
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == astring6.capacity(), "Error, capacity of astring is not the expected initial capacity after instantiation via the copy-constructor");
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == wstring6.capacity(), "Error, capacity of wstring is not the expected initial capacity after instantiation via the copy-constructor");
+	// Test if initial capacity is the capacity of the SSO buffer if the string fits into it
+	dynamic_assert(hasInitialCapacity(astring6), "Error, capacity of astring is not the expected initial capacity after instantiation via the copy-constructor");
+	dynamic_assert(hasInitialCapacity(wstring6), "Error, capacity of wstring is not the expected initial capacity after instantiation via the copy-constructor");
 
 	// Test copy-constructor passing pos and len
 	AString astring7(astring3, 1, 5);
@@ -102,9 +216,9 @@ static void TestConstructors()
 	dynamic_assert(5 == astring7.length(), "Error in the copy-constructor, astring has an unexpected length when passing pos and len");
 	dynamic_assert(5 == wstring7.length(), "Error in the copy-constructor, wstring has an unexpected length when passing pos and len");
 
-	// Test if initial capacity is STRING_SSO_BUFFER_CAPACITY
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == astring7.capacity(), "Error, capacity of astring is not the expected initial capacity after instantiation via the copy-constructor when passing pos and len");
-	dynamic_assert(STRING_SSO_BUFFER_CAPACITY == wstring7.capacity(), "Error, capacity of wstring is not the expected initial capacity after instantiation via the copy-constructor when passing pos and len");
+	// Test if initial capacity is the capacity of the SSO buffer if the string fits into it
+	dynamic_assert(hasInitialCapacity(astring7), "Error, capacity of astring is not the expected initial capacity after instantiation via the copy-constructor when passing pos and len");
+	dynamic_assert(hasInitialCapacity(wstring7), "Error, capacity of wstring is not the expected initial capacity after instantiation via the copy-constructor when passing pos and len");
 
 	// Test copy-constructor passing pos and len initialMaxLength
 	AString astring8(astring3, 1, 5, 64);
@@ -127,25 +241,32 @@ static void TestSetLengthAndSetCapacity()
 	AString astring1;
 	WString wstring1;
 
-	// Test setLength
-	astring1.setLength(64);
-	wstring1.setLength(64);
-
-	dynamic_assert(64 == astring1.length(), "Error in setLength for AString");
-	dynamic_assert(64 == wstring1.length(), "Error in setLength for WString");
-
 	// Test setCapacity
 	astring1.setCapacity(64);
 	wstring1.setCapacity(64);
 
-	size_t expectedCapacity = STRING_SSO_BUFFER_CAPACITY;
-	while (expectedCapacity < 64)
+	size_t expectedCapacityA = AString::ssoCapacity();
+	while (expectedCapacityA < 64)
+	{
+		size_t grown = static_cast<size_t>(STRING_BUFFER_GROWTH_FACTOR * expectedCapacityA);
+		expectedCapacityA = grown > expectedCapacityA ? grown : expectedCapacityA + 1;
+	}
+	size_t expectedCapacityW = WString::ssoCapacity();
+	while (expectedCapacityW < 64)
 	{
-		expectedCapacity = static_cast<size_t>(STRING_BUFFER_GROWTH_FACTOR * expectedCapacity);
+		size_t grown = static_cast<size_t>(STRING_BUFFER_GROWTH_FACTOR * expectedCapacityW);
+		expectedCapacityW = grown > expectedCapacityW ? grown : expectedCapacityW + 1;
 	}
 
-	dynamic_assert(expectedCapacity == astring1.capacity(), "Error in setCapacity for AString");
-	dynamic_assert(expectedCapacity == wstring1.capacity(), "Error in setCapacity for WString");
+	dynamic_assert(expectedCapacityA == astring1.capacity(), "Error in setCapacity for AString");
+	dynamic_assert(expectedCapacityW == wstring1.capacity(), "Error in setCapacity for WString");
+
+	// Test setLength, the length must not exceed the capacity
+	astring1.setLength(64);
+	wstring1.setLength(64);
+
+	dynamic_assert(64 == astring1.length(), "Error in setLength for AString");
+	dynamic_assert(64 == wstring1.length(), "Error in setLength for WString");
 }
 
 /** 
@@ -225,6 +346,1938 @@ static void testAppend()
 	dynamic_assert(wstring1 == wstring3, "Error in append or operator+= of WString");
 }
 
+/**
+ * Tests the move-constructor, move-assign operator, swap and the rvalue overloads of append, operator+= and
+ * operator+ of the class String. None of them may allocate a buffer if a dynamically allocated one can be taken over.
+ */
+static void TestMoveSemantics()
+{
+	char longTextA[] = "This text is too long for the SSO buffer";
+	wchar_t longTextW[] = L"This text is too long for the SSO buffer";
+	char shortTextA[] = "short";
+	wchar_t shortTextW[] = L"short";
+
+	// Test move-constructor with a dynamically allocated buffer
+	AString astring1(longTextA);
+	WString wstring1(longTextW);
+	size_t allocations = g_arrayAllocations;
+	AString astring2(std::move(astring1));
+	WString wstring2(std::move(wstring1));
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, the move-constructor allocated a buffer");
+	dynamic_assert(astring2 == longTextA, "Error in the move-constructor of AString");
+	dynamic_assert(wstring2 == longTextW, "Error in the move-constructor of WString");
+	dynamic_assert(0 == astring1.length() && astring1 == "", "Error, the moved-from AString is not empty");
+	dynamic_assert(0 == wstring1.length() && wstring1 == L"", "Error, the moved-from WString is not empty");
+
+	// Test move-constructor with the SSO buffer
+	AString astring3(shortTextA);
+	AString astring4(std::move(astring3));
+
+	dynamic_assert(astring4 == shortTextA, "Error in the move-constructor of AString using the SSO buffer");
+	dynamic_assert(0 == astring3.length(), "Error, the moved-from AString using the SSO buffer is not empty");
+
+	// Test move-assign operator
+	allocations = g_arrayAllocations;
+	astring1 = std::move(astring2);
+	wstring1 = std::move(wstring2);
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, the move-assign operator allocated a buffer");
+	dynamic_assert(astring1 == longTextA, "Error in the move-assign operator of AString");
+	dynamic_assert(wstring1 == longTextW, "Error in the move-assign operator of WString");
+
+	// Test swap
+	AString astring5(shortTextA);
+	WString wstring5(shortTextW);
+	allocations = g_arrayAllocations;
+	swap(astring1, astring5);
+	wstring1.swap(wstring5);
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, swap allocated a buffer");
+	dynamic_assert(astring1 == shortTextA && astring5 == longTextA, "Error in swap of AString");
+	dynamic_assert(wstring1 == shortTextW && wstring5 == longTextW, "Error in swap of WString");
+
+	// Test append taking over the buffer of other
+	AString astring6(longTextA, 0, 0, 128);
+	allocations = g_arrayAllocations;
+	astring1 += std::move(astring6);
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, append of an rvalue did not take over its buffer");
+	dynamic_assert(astring1 == "shortThis text is too long for the SSO buffer", "Error in append of an rvalue AString");
+
+	// Test operator+ reusing the buffer of the left-hand string
+	AString astring7(shortTextA, 0, 0, 128);
+	AString astring8(longTextA);
+	allocations = g_arrayAllocations;
+	AString astring9 = std::move(astring7) + astring8 + shortTextA;
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, operator+ did not reuse the buffer of an rvalue");
+	dynamic_assert(astring9 == "shortThis text is too long for the SSO buffershort", "Error in operator+ of AString");
+
+	// Test operator+ of two lvalues allocating exactly once
+	allocations = g_arrayAllocations;
+	AString astring10 = astring8 + astring8;
+
+	dynamic_assert(allocations + 1 == g_arrayAllocations, "Error, operator+ of two lvalues allocated more than once");
+	dynamic_assert(astring10.length() == 2 * astring8.length(), "Error in operator+ of two lvalues");
+
+	// Test growing a vector of strings, which must move the strings instead of copying them
+	std::vector<AString> strings;
+	allocations = g_arrayAllocations;
+	for (size_t i = 0; i < 1000; i++)
+	{
+		strings.push_back(AString(longTextA));
+	}
+
+	dynamic_assert(allocations + 1000 == g_arrayAllocations, "Error, growing a vector of strings copied the strings");
+	dynamic_assert(strings.front() == longTextA && strings.back() == longTextA, "Error, growing a vector of strings changed the strings");
+
+	// Test prepending parts of the string itself, which must be copied before the buffer is moved or reallocated
+	AString astring11("abc");
+	astring11.prepend(astring11.c_str() + 1);
+	AString astring12("abcdefghijklmnopqrstuvwxyz");
+	astring12.prepend(astring12);
+	AString astring13(shortTextA);
+	astring13 = astring13 + std::move(astring13);
+	AString astring14(longTextA);
+	astring14 = astring14.c_str() + 5 + std::move(astring14);
+
+	dynamic_assert(astring11 == "bcabc", "Error in prepend of a part of the string itself");
+	dynamic_assert(astring12 == "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz", "Error in prepend of the string itself");
+	dynamic_assert(astring13 == "shortshort", "Error in operator+ of a string and the string itself as rvalue");
+	dynamic_assert(astring14 == "text is too long for the SSO bufferThis text is too long for the SSO buffer",
+		"Error in operator+ of a part of a string and the string itself as rvalue");
+}
+
+/**
+ * Tests the layout of the class String. Using the compact layout AString must fit into three words and use the
+ * remaining storage for the SSO buffer, while WString keeps the configured SSO capacity.
+ */
+static void TestLayout()
+{
+	dynamic_assert(WString::ssoCapacity() >= STRING_SSO_BUFFER_CAPACITY, "Error, WString has a SSO buffer smaller than configured");
+
+#if STRING_COMPACT_LAYOUT
+	dynamic_assert(3 * sizeof(size_t) == sizeof(AString), "Error, AString does not fit into three words using the compact layout");
+	dynamic_assert(3 * sizeof(size_t) - 1 == AString::ssoCapacity(), "Error, AString does not use all of its storage for the SSO buffer");
+
+	// Fill the SSO buffer completely, the last character becomes the terminating 0
+	char fullTextA[] = "0123456789abcdefghijklm";
+	AString astring1(fullTextA, 0, AString::ssoCapacity());
+	size_t allocations = g_arrayAllocations;
+	AString astring2(astring1);
+
+	dynamic_assert(allocations == g_arrayAllocations, "Error, a full SSO buffer allocated a buffer");
+	dynamic_assert(AString::ssoCapacity() == astring2.length() && 0 == astring2.c_str()[astring2.length()], "Error, a full SSO buffer is not zero-terminated");
+
+	// Grow into the dynamically allocated buffer and shrink back by moving
+	astring2 += "n";
+	AString astring3(std::move(astring2));
+
+	dynamic_assert(AString::ssoCapacity() + 1 == astring3.length() && astring3.capacity() > AString::ssoCapacity(), "Error in the compact layout using the dynamically allocated buffer");
+	dynamic_assert(0 == astring2.length() && AString::ssoCapacity() == astring2.capacity(), "Error in the compact layout after moving from a string");
+#endif
+}
+
+/**
+ * Tests the length, mismatch and equal kernels for every alignment and length against the scalar kernels.
+ * @param	name	Name of the tested character type for error messages
+ */
+template<class TChar>
+static void TestKernelsForType(const char* name)
+{
+	const size_t maxLength = 200;
+	const size_t maxOffset = 40;
+	std::vector<TChar> buffer1(maxOffset + maxLength + 64);
+	std::vector<TChar> buffer2(maxOffset + maxLength + 64);
+	bool lengthOk = true;
+	bool mismatchOk = true;
+	bool equalOk = true;
+
+	for (size_t offset = 0; offset < maxOffset; offset++)
+	{
+		for (size_t length = 0; length < maxLength; length++)
+		{
+			TChar* str1 = &buffer1[offset];
+			TChar* str2 = &buffer2[maxOffset - offset];
+			for (size_t i = 0; i < length; i++)
+			{
+				str1[i] = static_cast<TChar>('a' + i % 26);
+				str2[i] = str1[i];
+			}
+			str1[length] = static_cast<TChar>(0);
+			str2[length] = static_cast<TChar>(0);
+
+			lengthOk = lengthOk && length == StringKernels<TChar>::length(str1) && length == StringKernels<TChar>::length(str2);
+			mismatchOk = mismatchOk && length == StringKernels<TChar>::mismatch(str1, str2);
+			equalOk = equalOk && StringKernels<TChar>::equal(str1, str2, length);
+#if STRING_SIMD
+			lengthOk = lengthOk && length == StringKernels<TChar>::lengthSse2(str1);
+			mismatchOk = mismatchOk && length == StringKernels<TChar>::mismatchSse2(str1, str2);
+			equalOk = equalOk && StringKernels<TChar>::equalSse2(str1, str2, length);
+#endif
+
+			// Change the last character, which has to be detected by mismatch and equal
+			if (length)
+			{
+				str2[length - 1] = static_cast<TChar>('#');
+				mismatchOk = mismatchOk && length - 1 == StringKernels<TChar>::mismatch(str1, str2);
+				equalOk = equalOk && !StringKernels<TChar>::equal(str1, str2, length);
+#if STRING_SIMD
+				mismatchOk = mismatchOk && length - 1 == StringKernels<TChar>::mismatchSse2(str1, str2);
+				equalOk = equalOk && !StringKernels<TChar>::equalSse2(str1, str2, length);
+#endif
+			}
+		}
+	}
+
+	if (!lengthOk || !mismatchOk || !equalOk)
+	{
+		std::cerr << "Error in the " << StringKernels<TChar>::implementation() << " kernels for " << name << std::endl;
+	}
+	dynamic_assert(lengthOk, "Error in StringKernels::length");
+	dynamic_assert(mismatchOk, "Error in StringKernels::mismatch");
+	dynamic_assert(equalOk, "Error in StringKernels::equal");
+
+	// Convert all byte values at every offset and length, the character behind the buffer must not be touched
+	bool caseOk = true;
+	for (size_t offset = 0; offset < maxOffset; offset++)
+	{
+		for (size_t length = 0; length < maxLength; length++)
+		{
+			TChar* str = &buffer1[offset];
+			for (int run = 0; run < 4; run++)
+			{
+				for (size_t i = 0; i < length; i++)
+				{
+					str[i] = static_cast<TChar>((i * 7 + length) % 256);
+				}
+				str[length] = static_cast<TChar>('A');
+				bool upper = run % 2 != 0;
+#if STRING_SIMD
+				if (run >= 2)
+				{
+					StringKernels<TChar>::convertCaseSse2(str, length, static_cast<TChar>(upper ? 'a' : 'A'));
+				}
+				else
+#endif
+				if (upper)
+				{
+					StringKernels<TChar>::toUpper(str, length);
+				}
+				else
+				{
+					StringKernels<TChar>::toLower(str, length);
+				}
+				for (size_t i = 0; i < length; i++)
+				{
+					TChar c = static_cast<TChar>((i * 7 + length) % 256);
+					TChar first = static_cast<TChar>(upper ? 'a' : 'A');
+					caseOk = caseOk && str[i] == (c >= first && c < first + 26 ? static_cast<TChar>(c ^ 0x20) : c);
+				}
+				caseOk = caseOk && str[length] == static_cast<TChar>('A');
+			}
+		}
+	}
+	dynamic_assert(caseOk, "Error in StringKernels::toLower or StringKernels::toUpper");
+
+#if defined(__unix__)
+	// Place strings at the end of a page followed by an inaccessible page, the kernels must not touch it
+	size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	char* pages = static_cast<char*>(mmap(0, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	if (pages != MAP_FAILED && 0 == mprotect(pages + pageSize, pageSize, PROT_NONE))
+	{
+		TChar* end = reinterpret_cast<TChar*>(pages + pageSize);
+		TChar* other = reinterpret_cast<TChar*>(pages);
+		for (size_t length = 0; length < 100; length++)
+		{
+			TChar* str = end - length - 1;
+			for (size_t i = 0; i < length; i++)
+			{
+				str[i] = static_cast<TChar>('x');
+				other[i] = static_cast<TChar>('x');
+			}
+			str[length] = static_cast<TChar>(0);
+			other[length] = static_cast<TChar>(0);
+
+			dynamic_assert(length == StringKernels<TChar>::length(str), "Error in StringKernels::length at a page boundary");
+			dynamic_assert(length == StringKernels<TChar>::mismatch(str, other), "Error in StringKernels::mismatch at a page boundary");
+			dynamic_assert(length == StringKernels<TChar>::mismatch(other, str), "Error in StringKernels::mismatch at a page boundary");
+		}
+	}
+	if (pages != MAP_FAILED)
+	{
+		munmap(pages, 2 * pageSize);
+	}
+#endif
+}
+
+/**
+ * Tests the kernels used by the class String for char and wchar_t strings.
+ */
+static void TestKernels()
+{
+	TestKernelsForType<char>("char");
+	TestKernelsForType<wchar_t>("wchar_t");
+
+	// Test String operations running on the kernels, comparing strings of equal length
+	AString astring1("This is a string long enough for multiple vectors of the kernels");
+	AString astring2(astring1);
+	WString wstring1(L"This is a string long enough for multiple vectors of the kernels");
+	WString wstring2(wstring1);
+
+	dynamic_assert(astring1 == astring2 && wstring1 == wstring2, "Error, operator== reports equal strings to be unequal");
+
+	astring2.data()[astring2.length() - 1] = '?';
+	wstring2.data()[wstring2.length() - 1] = L'?';
+
+	dynamic_assert(astring1 != astring2 && wstring1 != wstring2, "Error, operator!= reports unequal strings to be equal");
+	dynamic_assert(astring1.compare(astring2.c_str()) > 0 && wstring1.compare(wstring2.c_str()) > 0, "Error, compare returns the wrong order");
+}
+
+/**
+ * Tests the pool and arena allocators of the class String.
+ */
+static void TestAllocators()
+{
+	typedef String<char, StringPoolAllocator<char> > PoolString;
+	typedef String<char, StringArenaAllocator<char> > ArenaString;
+	char longTextA[] = "This text is too long for the SSO buffer";
+
+	// Test the pool allocator, which must round the capacity up to its size class and reuse freed blocks
+	size_t allocations = g_arrayAllocations;
+	const char* buffer = 0;
+	{
+		PoolString pstring1(longTextA);
+		buffer = pstring1.c_str();
+
+#if STRING_SHARED_BUFFER
+		// The reference count of a shared buffer takes a word of the block
+		size_t blockSize = pstring1.capacity() + 1 + sizeof(size_t);
+#else
+		size_t blockSize = pstring1.capacity() + 1;
+#endif
+
+		dynamic_assert(pstring1 == longTextA, "Error in String using StringPoolAllocator");
+		dynamic_assert(0 == (blockSize & (blockSize - 1)), "Error, StringPoolAllocator did not round the capacity up to its size class");
+	}
+	PoolString pstring2(longTextA);
+
+	dynamic_assert(buffer == pstring2.c_str(), "Error, StringPoolAllocator did not reuse a freed block");
+	dynamic_assert(allocations == g_arrayAllocations, "Error, StringPoolAllocator allocated a small buffer using new[]");
+
+	pstring2.setCapacity(10000);
+	pstring2 += "appended to a large buffer";
+
+	dynamic_assert(pstring2.length() == 66 && pstring2.capacity() >= 10000, "Error in String using StringPoolAllocator for large buffers");
+
+	// A producer handing its strings to a consumer gets its blocks back instead of allocating new slabs
+	size_t slabs = StringPoolAllocator<char>::slabs();
+	size_t maxSlabs = slabs;
+	std::mutex mutex;
+	std::condition_variable changed;
+	std::vector<PoolString> queue;
+	bool produced = false;
+	std::thread consumer([&]()
+	{
+		std::vector<PoolString> batch;
+		std::unique_lock<std::mutex> lock(mutex);
+		while (!produced || !queue.empty())
+		{
+			changed.wait(lock, [&]() { return produced || !queue.empty(); });
+			batch.swap(queue);
+			changed.notify_all();
+			lock.unlock();
+			batch.clear();
+			lock.lock();
+		}
+	});
+	std::thread producer([&]()
+	{
+		for (size_t i = 0; i < 100000; i++)
+		{
+			PoolString line(longTextA);
+			std::unique_lock<std::mutex> lock(mutex);
+			changed.wait(lock, [&]() { return queue.size() < 1000; });
+			queue.push_back(std::move(line));
+			if (maxSlabs < StringPoolAllocator<char>::slabs())
+			{
+				maxSlabs = StringPoolAllocator<char>::slabs();
+			}
+			changed.notify_all();
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		produced = true;
+		changed.notify_all();
+	});
+	producer.join();
+	consumer.join();
+
+	dynamic_assert(maxSlabs <= slabs + 8, "Error, StringPoolAllocator did not take back the blocks freed by another thread");
+	dynamic_assert(StringPoolAllocator<char>::slabs() == slabs, "Error, StringPoolAllocator did not free the slabs of an exited thread");
+
+	// A slab of an exited thread is freed with its last block
+	PoolString survivor;
+	std::thread([&]()
+	{
+		survivor = PoolString(longTextA);
+	}).join();
+	dynamic_assert(survivor == longTextA && StringPoolAllocator<char>::slabs() == slabs + 1, "Error, StringPoolAllocator freed a slab in use");
+	survivor = PoolString();
+	dynamic_assert(StringPoolAllocator<char>::slabs() == slabs, "Error, StringPoolAllocator did not free an orphaned slab");
+
+	// Test the arena allocator
+	allocations = g_arrayAllocations;
+	StringArena arena(1024);
+	{
+		StringArena::Scope scope(arena);
+		ArenaString astring1(longTextA);
+		ArenaString astring2(astring1);
+		astring2.setCapacity(5000);
+		astring2 += astring1;
+
+		dynamic_assert(&arena == StringArena::active(), "Error, StringArena::Scope did not activate the arena");
+		dynamic_assert(astring2 == "This text is too long for the SSO bufferThis text is too long for the SSO buffer", "Error in String using StringArenaAllocator");
+		dynamic_assert(arena.usedBytes() >= 5000, "Error, String using StringArenaAllocator did not allocate from the arena");
+		dynamic_assert(allocations == g_arrayAllocations, "Error, StringArenaAllocator allocated a buffer using new[]");
+
+		// Test nested scopes
+		StringArena innerArena;
+		{
+			StringArena::Scope innerScope(innerArena);
+			ArenaString astring3(longTextA);
+
+			dynamic_assert(innerArena.usedBytes() > 0, "Error, nested StringArena::Scope did not activate the inner arena");
+		}
+		dynamic_assert(&arena == StringArena::active(), "Error, StringArena::Scope did not restore the previous arena");
+	}
+	dynamic_assert(0 == StringArena::active(), "Error, StringArena::Scope did not deactivate the arena");
+
+	arena.reset();
+	dynamic_assert(0 == arena.usedBytes(), "Error in StringArena::reset");
+
+	// Test allocating without an active arena
+	bool thrown = false;
+	try
+	{
+		ArenaString astring4(longTextA);
+	}
+	catch (const std::bad_alloc&)
+	{
+		thrown = true;
+	}
+	dynamic_assert(thrown, "Error, StringArenaAllocator allocated without an active arena");
+}
+
+/**
+ * Tests the class Rope against the same operations on AString.
+ */
+static void TestRope()
+{
+	// Build a rope of short fragments merged into chunks and long strings taken over as chunks
+	ARope rope;
+	AString expected;
+	size_t state = 7;
+	for (size_t i = 0; i < 2000; i++)
+	{
+		state = state * 1103515245 + 12345;
+		AString fragment;
+		size_t fragmentLength = (state >> 8) % 7 ? 1 + (state >> 12) % 40 : 300 + (state >> 12) % 500;
+		for (size_t j = 0; j < fragmentLength; j++)
+		{
+			fragment += (j % 2) ? "a" : "b";
+		}
+		fragment.data()[0] = static_cast<char>('A' + i % 26);
+		expected += fragment;
+		if (i % 3)
+		{
+			rope += std::move(fragment);
+		}
+		else
+		{
+			rope += ARope(fragment);
+		}
+	}
+
+	size_t chunks = 0;
+	rope.forEachChunk([&](const char*, size_t) { chunks++; });
+	size_t maxHeight = 2;
+	for (size_t count = 1; count < chunks; count *= 2)
+	{
+		maxHeight += 2;
+	}
+
+	dynamic_assert(expected.length() == rope.length(), "Error, the length of the rope is wrong");
+	dynamic_assert(rope.height() <= maxHeight, "Error, the tree of the rope is not balanced");
+	dynamic_assert(expected == rope.flatten(), "Error in Rope::flatten");
+	dynamic_assert(expected.c_str()[12345] == rope.at(12345), "Error in Rope::at");
+
+	// Test chunk iteration without flattening
+	AString concatenated;
+	ARope::ChunkIterator iterator(rope);
+	const char* data;
+	size_t length;
+	while (iterator.next(data, length))
+	{
+		concatenated.append(data, 0, length);
+	}
+
+	dynamic_assert(expected == concatenated, "Error in Rope::ChunkIterator");
+
+	// Test split and substr at positions inside and at the borders of chunks
+	bool splitOk = true;
+	for (size_t pos = 1; pos < expected.length(); pos += 997)
+	{
+		ARope left;
+		ARope right;
+		rope.split(pos, left, right);
+		splitOk = splitOk && left.length() == pos && AString(expected, 0, pos) == left.flatten() && AString(expected, pos) == right.flatten();
+
+		ARope part = rope.substr(pos, 1500);
+		size_t partLength = expected.length() - pos < 1500 ? expected.length() - pos : 1500;
+		splitOk = splitOk && AString(expected, pos, partLength) == part.flatten();
+	}
+
+	dynamic_assert(splitOk, "Error in Rope::split or Rope::substr");
+
+	// Test c_str, which flattens a copy without changing the shared chunks of the original
+	ARope copy(rope);
+	AString flat(copy.c_str());
+
+	dynamic_assert(expected == flat && 1 == copy.height(), "Error in Rope::c_str");
+	dynamic_assert(rope.height() > 1 && expected == rope.flatten(), "Error, Rope::c_str of a copy changed the original");
+
+	// Test operator+ and wide ropes
+	WRope wrope1(L"Hello, ");
+	WRope wrope2(L"World!");
+	WRope wrope3 = wrope1 + wrope2;
+
+	dynamic_assert(WString(L"Hello, World!") == wrope3.c_str(), "Error in operator+ of Rope");
+	dynamic_assert(0 == ARope().length() && 0 == ARope().c_str()[0], "Error, an empty rope is not empty");
+	dynamic_assert(0 == ARope().at(0) && 0 == rope.at(rope.length()), "Error in Rope::at at the end of the rope");
+}
+
+/**
+ * Tests the class StringView and the methods of String accepting views.
+ */
+static void TestStringView()
+{
+	AString str("key=value;;other=42;last");
+	AStringView view(str);
+
+	dynamic_assert(view.data() == str.c_str() && view.length() == str.length(), "Error, a StringView does not view the String");
+	dynamic_assert(AStringView("value") == view.substr(4, 5) && view.substr(4, 5).data() == str.c_str() + 4, "Error in StringView::substr");
+	dynamic_assert(0 == view.substr(100).length() && AStringView("last") == view.substr(20, 100), "Error, StringView::substr does not clamp");
+	dynamic_assert(4 == view.find("value") && 15 == view.find('r') && 19 == view.find(';', 11), "Error in StringView::find");
+	dynamic_assert(AStringView::NOT_FOUND == view.find("values") && AStringView::NOT_FOUND == view.find('x'), "Error, StringView::find found a missing string");
+	dynamic_assert(view.startsWith("key=") && !view.startsWith("value") && view.endsWith(";last") && !view.endsWith("key"), "Error in StringView::startsWith or StringView::endsWith");
+	dynamic_assert(view.compare("key") > 0 && AStringView("ab").compare("b") < 0 && 0 == view.compare(str.c_str()), "Error in StringView::compare");
+
+	// Test splitting and tokenizing without allocations
+	std::vector<AStringView> parts;
+	parts.reserve(8);
+	size_t allocations = g_arrayAllocations;
+	size_t count = view.split(';', [&](const AStringView& part) { parts.push_back(part); });
+
+	dynamic_assert(4 == count && AStringView("key=value") == parts[0] && 0 == parts[1].length() && AStringView("last") == parts[3], "Error in StringView::split");
+	dynamic_assert(allocations == g_arrayAllocations, "Error, StringView::split allocated memory");
+
+	AStringView token;
+	AStringView::TokenIterator iterator(view, "=;", true);
+	AString joined;
+	while (iterator.next(token))
+	{
+		joined.append(token);
+		joined += " ";
+	}
+
+	dynamic_assert(AString("key value other 42 last ") == joined, "Error in StringView::TokenIterator");
+
+	AStringView::TokenIterator empty(AStringView(), ',');
+	dynamic_assert(empty.next(token) && 0 == token.length() && !empty.next(token), "Error, an empty view is not a single empty token");
+
+	allocations = g_arrayAllocations;
+	size_t fields = 0;
+	AStringView::TokenIterator fieldIterator(view, ';');
+	while (fieldIterator.next(token))
+	{
+		fields += token.startsWith("other") ? 1 : 0;
+	}
+
+	dynamic_assert(1 == fields && allocations == g_arrayAllocations, "Error, tokenizing allocated memory");
+
+	// Test the String methods accepting views
+	AString copy(view.substr(4, 5));
+	dynamic_assert(AString("value") == copy, "Error in the StringView constructor of String");
+
+	copy.copy(view.substr(0, 3));
+	copy.append(view.substr(17, 2));
+	dynamic_assert(AString("key42") == copy && copy.compare(AStringView("key42")) == 0 && copy.compare(view) < 0, "Error in String::copy, String::append or String::compare with a StringView");
+
+	copy.copy(AStringView());
+	dynamic_assert(0 == copy.length() && 0 == copy.c_str()[0], "Error, copying an empty view did not clear the String");
+
+	// Views may refer to the String they are appended to or copied into
+	AString self("0123456789");
+	while (self.length() < 200)
+	{
+		self.append(AStringView(self).substr(self.length() - 10));
+	}
+	self.copy(AStringView(self).substr(195));
+
+	dynamic_assert(AString("56789") == self, "Error, appending or copying a view of the String itself failed");
+
+	WString wide(L"a b  c");
+	WStringView wideToken;
+	size_t wideTokens = 0;
+	WStringView::TokenIterator wideIterator(wide, L' ', true);
+	while (wideIterator.next(wideToken))
+	{
+		wideTokens++;
+	}
+
+	dynamic_assert(3 == wideTokens && WStringView(L"c") == wideToken && 1 == WStringView(wide).find(L" b"), "Error in WStringView");
+}
+
+/**
+ * Searches a needle naively as reference for the search methods.
+ * @param	haystack	String to search in
+ * @param	length		Length of the haystack in characters
+ * @param	needle		String to search
+ * @param	needleLength	Length of the needle in characters
+ * @param	reverse		true to search the last occurrence
+ * @return			Position of the needle, StringView<TChar>::NOT_FOUND if it does not occur
+ */
+template<class TChar>
+static size_t naiveFind(const TChar* haystack, size_t length, const TChar* needle, size_t needleLength, bool reverse)
+{
+	size_t found = StringView<TChar>::NOT_FOUND;
+	for (size_t pos = 0; pos + needleLength <= length; pos++)
+	{
+		size_t i = 0;
+		while (i < needleLength && haystack[pos + i] == needle[i])
+		{
+			i++;
+		}
+		if (i == needleLength)
+		{
+			found = pos;
+			if (!reverse)
+			{
+				break;
+			}
+		}
+	}
+	return found;
+}
+
+/**
+ * Tests the search kernels and the class Searcher using random strings of a small alphabet against a naive search.
+ * @param	name	Name of the tested character type for error messages
+ */
+template<class TChar>
+static void TestSearchForType(const char* name)
+{
+	bool findOk = true;
+	bool rfindOk = true;
+	bool kernelOk = true;
+	bool countOk = true;
+	size_t state = 11;
+	std::vector<TChar> haystack(400);
+	std::vector<TChar> needle(100);
+
+	for (size_t run = 0; run < 3000; run++)
+	{
+		size_t length = nextRandom(state) % haystack.size();
+		size_t needleLength = 1 + nextRandom(state) % (run % 2 ? 8 : needle.size());
+		for (size_t i = 0; i < length; i++)
+		{
+			haystack[i] = static_cast<TChar>('a' + nextRandom(state) % 3);
+		}
+		for (size_t i = 0; i < needleLength; i++)
+		{
+			needle[i] = static_cast<TChar>('a' + nextRandom(state) % 3);
+		}
+
+		// Use a part of the haystack as needle in most runs, so the needle occurs
+		if (run % 4 && needleLength <= length)
+		{
+			size_t pos = nextRandom(state) % (length - needleLength + 1);
+			for (size_t i = 0; i < needleLength; i++)
+			{
+				needle[i] = haystack[pos + i];
+			}
+		}
+
+		StringView<TChar> haystackView(haystack.data(), length);
+		StringView<TChar> needleView(needle.data(), needleLength);
+		Searcher<TChar> searcher(needleView);
+		size_t expected = naiveFind(haystack.data(), length, needle.data(), needleLength, false);
+		size_t expectedLast = naiveFind(haystack.data(), length, needle.data(), needleLength, true);
+		size_t start = length ? nextRandom(state) % length : 0;
+
+		findOk = findOk && expected == searcher.find(haystackView) && expected == haystackView.find(needleView);
+		findOk = findOk && naiveFind(haystack.data(), length, needle.data(), needleLength, false) == searcher.find(haystackView, 0);
+		size_t expectedFrom = naiveFind(haystack.data() + start, length - start, needle.data(), needleLength, false);
+		findOk = findOk && (StringView<TChar>::NOT_FOUND == expectedFrom ? StringView<TChar>::NOT_FOUND : start + expectedFrom) == searcher.find(haystackView, start);
+		rfindOk = rfindOk && expectedLast == searcher.rfind(haystackView);
+		size_t expectedBefore = naiveFind(haystack.data(), start + needleLength < length ? start + needleLength : length, needle.data(), needleLength, true);
+		rfindOk = rfindOk && expectedBefore == searcher.rfind(haystackView, start);
+
+		kernelOk = kernelOk && expected == StringKernels<TChar>::findScalar(haystack.data(), length, needle.data(), needleLength);
+		kernelOk = kernelOk && expected == StringKernels<TChar>::find(haystack.data(), length, needle.data(), needleLength);
+#if STRING_SIMD
+		kernelOk = kernelOk && expected == StringKernels<TChar>::findSse2(haystack.data(), length, needle.data(), needleLength);
+#endif
+
+		size_t expectedCount = 0;
+		for (size_t pos = expected; StringView<TChar>::NOT_FOUND != pos; expectedCount++)
+		{
+			size_t next = naiveFind(haystack.data() + pos + needleLength, length - pos - needleLength, needle.data(), needleLength, false);
+			pos = StringView<TChar>::NOT_FOUND == next ? next : pos + needleLength + next;
+		}
+		countOk = countOk && expectedCount == searcher.count(haystackView);
+	}
+
+	if (!findOk || !rfindOk || !kernelOk || !countOk)
+	{
+		std::cerr << "Error in the search for " << name << std::endl;
+	}
+	dynamic_assert(findOk, "Error in Searcher::find");
+	dynamic_assert(rfindOk, "Error in Searcher::rfind");
+	dynamic_assert(kernelOk, "Error in StringKernels::find");
+	dynamic_assert(countOk, "Error in Searcher::count");
+
+#if defined(__unix__)
+	// Place haystacks without terminator at the end of a page followed by an inaccessible page
+	size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	char* pages = static_cast<char*>(mmap(0, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	if (pages != MAP_FAILED && 0 == mprotect(pages + pageSize, pageSize, PROT_NONE))
+	{
+		TChar* end = reinterpret_cast<TChar*>(pages + pageSize);
+		const TChar missing[] = { static_cast<TChar>('x'), static_cast<TChar>('y'), static_cast<TChar>('z') };
+		for (size_t length = 0; length < 100; length++)
+		{
+			TChar* str = end - length;
+			for (size_t i = 0; i < length; i++)
+			{
+				str[i] = static_cast<TChar>('x');
+			}
+
+			dynamic_assert(StringKernels<TChar>::NOT_FOUND == StringKernels<TChar>::find(str, length, missing, 3), "Error in StringKernels::find at a page boundary");
+			dynamic_assert(StringView<TChar>::NOT_FOUND == StringView<TChar>(str, length).find(missing[2]), "Error in StringView::find at a page boundary");
+		}
+	}
+	if (pages != MAP_FAILED)
+	{
+		munmap(pages, 2 * pageSize);
+	}
+#endif
+}
+
+/**
+ * Tests the search methods of the classes String and StringView for char and wchar_t strings.
+ */
+static void TestSearch()
+{
+	TestSearchForType<char>("char");
+	TestSearchForType<wchar_t>("wchar_t");
+
+	AString log("2026-10-17 12:00:01 INFO request done\n2026-10-17 12:00:02 ERROR timeout talking to backend-17\n2026-10-17 12:00:03 ERROR timeout\n");
+	AString longNeedle("ERROR timeout talking to backend-17");
+
+	dynamic_assert(0 == strcmp(ASearcher("ERROR").algorithm(), "filter") && 0 == strcmp(ASearcher(AStringView(log).substr(0, 80)).algorithm(), "horspool"), "Error, Searcher selected the wrong algorithm");
+	dynamic_assert(58 == log.find("ERROR") && 58 == log.find(longNeedle) && AString::NOT_FOUND == log.find("FATAL"), "Error in String::find");
+	dynamic_assert(114 == log.rfind("ERROR") && 58 == log.rfind("ERROR", 113) && 58 == log.rfind(longNeedle), "Error in String::rfind");
+	dynamic_assert(38 == log.find(AStringView(log).substr(38, 70)) && 38 == log.rfind(AStringView(log).substr(38, 70)), "Error in String::find or String::rfind with a long needle");
+	dynamic_assert(10 == log.find(' ') && 10 == log.findFirstOf(" :") && 13 == log.findFirstOf(":", 11), "Error in String::findFirstOf");
+	dynamic_assert(log.contains("backend-17") && !log.contains("backend-18") && 2 == log.count("ERROR") && 3 == log.count("\n"), "Error in String::contains or String::count");
+	dynamic_assert(3 == AString("aaaaaaa").count("aa") && 0 == log.count(""), "Error, String::count counted overlapping or empty needles");
+
+	// Reuse one searcher for many haystacks
+	ASearcher searcher(longNeedle);
+	size_t matches = 0;
+	AStringView line;
+	AStringView::TokenIterator lines(log, '\n');
+	while (lines.next(line))
+	{
+		matches += searcher.find(line) != AStringView::NOT_FOUND ? 1 : 0;
+	}
+
+	dynamic_assert(1 == matches, "Error, a reused Searcher failed");
+
+	WString wide(L"\x263A smile \x263A and \x263A");
+	dynamic_assert(3 == wide.count(L"\x263A") && 8 == wide.findFirstOf(L"a\x263A", 1) && 0 == wide.find(L'\x263A'), "Error in the search methods of WString");
+}
+
+/**
+ * Tests the class MultiMatcher against searching every pattern on its own.
+ * @param	name	Name of the tested character type for error messages
+ */
+template<class TChar>
+static void TestMultiMatcherForType(const char* name)
+{
+	bool matchesOk = true;
+	bool streamOk = true;
+	size_t state = 3;
+	for (size_t run = 0; run < 200; run++)
+	{
+		// Patterns of a small alphabet share prefixes and suffixes and overlap in the text
+		std::vector<String<TChar> > patterns(1 + nextRandom(state) % 20);
+		for (size_t k = 0; k < patterns.size(); k++)
+		{
+			for (size_t i = 0, length = 1 + nextRandom(state) % 6; i < length; i++)
+			{
+				TChar c[2] = { static_cast<TChar>(run % 2 ? 'a' + nextRandom(state) % 3 : 0x263A + nextRandom(state) % 3), 0 };
+				patterns[k].append(c);
+			}
+		}
+		String<TChar> text;
+		for (size_t i = 0, length = nextRandom(state) % 300; i < length; i++)
+		{
+			TChar c[2] = { static_cast<TChar>(run % 2 ? 'a' + nextRandom(state) % 3 : 0x263A + nextRandom(state) % 3), 0 };
+			text.append(c);
+		}
+
+		std::vector<size_t> expected(patterns.size() * (text.length() + 1), 0);
+		size_t expectedCount = 0;
+		for (size_t k = 0; k < patterns.size(); k++)
+		{
+			for (size_t pos = text.find(patterns[k]); AString::NOT_FOUND != pos; pos = text.find(patterns[k], pos + 1))
+			{
+				expected[k * (text.length() + 1) + pos]++;
+				expectedCount++;
+			}
+		}
+
+		MultiMatcher<TChar> matcher(patterns.begin(), patterns.end());
+		std::vector<size_t> found(expected.size(), 0);
+		size_t count = matcher.findAll(text, [&](size_t pattern, size_t pos) { found[pattern * (text.length() + 1) + pos]++; });
+		matchesOk = matchesOk && expectedCount == count && expected == found;
+
+		// Split the text into chunks of random lengths
+		std::vector<size_t> streamed(expected.size(), 0);
+		typename MultiMatcher<TChar>::Stream stream(matcher);
+		size_t streamCount = 0;
+		for (size_t pos = 0; pos < text.length();)
+		{
+			size_t length = 1 + nextRandom(state) % 7;
+			streamCount += stream.feed(StringView<TChar>(text).substr(pos, length), [&](size_t pattern, size_t start) { streamed[pattern * (text.length() + 1) + start]++; });
+			pos += length;
+		}
+		streamOk = streamOk && expectedCount == streamCount && expected == streamed;
+	}
+
+	if (!matchesOk || !streamOk)
+	{
+		std::cerr << "Error in MultiMatcher for " << name << std::endl;
+	}
+	dynamic_assert(matchesOk, "Error in MultiMatcher::findAll");
+	dynamic_assert(streamOk, "Error in MultiMatcher::Stream");
+}
+
+/**
+ * Tests the class MultiMatcher for char and wchar_t strings.
+ */
+static void TestMultiMatcher()
+{
+	TestMultiMatcherForType<char>("char");
+	TestMultiMatcherForType<wchar_t>("wchar_t");
+
+	const char* const keywords[] = { "he", "she", "his", "hers", "" };
+	AMultiMatcher matcher(keywords, keywords + 5);
+	AString matches;
+	matcher.findAll("ushers", [&](size_t pattern, size_t pos)
+	{
+		char position[] = { '@', static_cast<char>('0' + pos), ' ', 0 };
+		matches += keywords[pattern];
+		matches += position;
+	});
+
+	dynamic_assert(AString("she@1 he@2 hers@2 ") == matches, "Error, MultiMatcher reported the wrong matches");
+	dynamic_assert(5 == matcher.patternCount() && 0 == matcher.count("") && 0 == matcher.count("xyz") && 3 == matcher.count("hishe"), "Error in MultiMatcher::count");
+
+	AMultiMatcher::Stream stream(matcher);
+	size_t first = stream.feed("us", [](size_t, size_t) {});
+	size_t position = 0;
+	size_t second = stream.feed("hers", [&](size_t pattern, size_t pos) { position += 3 == pattern ? pos : 0; });
+
+	dynamic_assert(0 == first && 3 == second && 2 == position, "Error, MultiMatcher::Stream missed a match across chunks");
+}
+
+/**
+ * Tests the class StringPool and the handles it returns, interning from multiple threads at once.
+ */
+static void TestStringPool()
+{
+	AStringPool pool;
+	AString host("backend-17.example.org");
+	AInternedString interned1 = pool.intern(host);
+	AInternedString interned2 = pool.intern("backend-17.example.org");
+	AInternedString interned3 = pool.intern(AStringView("backend-17.example.org:8080").substr(0, 21));
+
+	dynamic_assert(interned1 == interned2 && interned1.c_str() == interned2.c_str(), "Error, equal strings were interned twice");
+	dynamic_assert(interned1 != interned3 && AStringView("backend-17.example.or") == interned3, "Error, different strings share an interned string");
+	dynamic_assert(host == interned1.c_str() && host.length() == interned1.length() && interned1.c_str() != host.c_str(), "Error, the interned string is not a copy");
+	dynamic_assert(AInternedString() == pool.intern("") && 0 == AInternedString().c_str()[0] && 2 == pool.size(), "Error, the empty string was interned");
+	dynamic_assert(std::hash<AInternedString>()(interned1) == interned2.hash(), "Error in std::hash of InternedString");
+	dynamic_assert(interned1.hash() == AString("backend-17.example.org").hash() && AInternedString().hash() == AString("").hash() &&
+		pool.intern("").hash() == AString().hash(), "Error, the hash of InternedString differs from String::hash");
+
+	// Intern overlapping sets of strings from multiple threads, every thread has to receive the same handles
+	const size_t threadCount = 4;
+	const size_t stringCount = 16384;
+	std::vector<std::vector<AInternedString> > handles(threadCount, std::vector<AInternedString>(stringCount));
+	WStringPool widePool;
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		threads.push_back(std::thread([&, t]()
+		{
+			for (size_t i = 0; i < stringCount; i++)
+			{
+				// Every thread interns the strings in a different order
+				size_t index = (i * (2 * t + 1)) % stringCount;
+				char name[32];
+				snprintf(name, sizeof(name), "field-%zu", index);
+				handles[t][index] = pool.intern(name);
+			}
+		}));
+	}
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		threads[t].join();
+	}
+
+	bool handlesOk = true;
+	for (size_t i = 0; i < stringCount; i++)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "field-%zu", i);
+		handlesOk = handlesOk && AString(name) == handles[0][i].c_str();
+		for (size_t t = 1; t < threadCount; t++)
+		{
+			handlesOk = handlesOk && handles[0][i] == handles[t][i];
+		}
+	}
+
+	dynamic_assert(handlesOk, "Error, threads received different handles for the same string");
+	size_t memoryUsage = pool.memoryUsage();
+	for (size_t i = 0; i < stringCount; i++)
+	{
+		pool.intern(handles[1][i]);
+	}
+
+	dynamic_assert(stringCount + 2 == pool.size() && memoryUsage == pool.memoryUsage(), "Error, the pool did not deduplicate the strings");
+
+	// Long strings are stored in slabs of their own
+	WString longString(STRING_INTERN_SLAB_SIZE);
+	for (size_t i = 0; i < STRING_INTERN_SLAB_SIZE / 2; i++)
+	{
+		longString += L"x";
+	}
+	dynamic_assert(widePool.intern(longString) == widePool.intern(longString) && longString == widePool.intern(longString).c_str(), "Error, a long string was not interned");
+}
+
+/**
+ * Tests hashing, ordering and the use of strings as keys of standard containers.
+ */
+static void TestHash()
+{
+	// The hash only depends on the characters, not on their alignment or the type holding them
+	char buffer[256 + 8];
+	size_t state = 21;
+	for (size_t i = 0; i < sizeof(buffer); i++)
+	{
+		buffer[i] = static_cast<char>('a' + nextRandom(state) % 26);
+	}
+	bool consistent = true;
+	bool sensitive = true;
+	for (size_t length = 0; length <= 256; length++)
+	{
+		AStringView view(buffer, length);
+		AString str(view);
+		for (size_t offset = 1; offset < 8; offset++)
+		{
+			memmove(buffer + offset, buffer, length);
+			consistent = consistent && AStringView(buffer + offset, length).hash() == str.hash();
+			memmove(buffer, buffer + offset, length);
+		}
+		consistent = consistent && view.hash() == str.hash() && std::hash<AString>()(str) == str.hash() &&
+			std::hash<AStringView>()(view) == str.hash();
+
+		// Flipping a single bit of any character changes the hash
+		for (size_t i = 0; i < length; i += 1 + length / 16)
+		{
+			str.data()[i] ^= 1;
+			sensitive = sensitive && str.hash() != view.hash();
+			str.data()[i] ^= 1;
+		}
+	}
+	dynamic_assert(consistent, "Error, equal strings got different hashes");
+	dynamic_assert(sensitive, "Error, changing a character did not change the hash");
+	dynamic_assert(AString("ab").hash() != AString(AStringView("ab\0", 3)).hash(), "Error, the hash ignores the length");
+
+	AStringPool pool;
+	WStringPool widePool;
+	dynamic_assert(pool.intern("interned").hash() == AString("interned").hash() && widePool.intern(L"interned").hash() == WString(L"interned").hash(),
+		"Error, interned strings got different hashes");
+
+	// Similar keys do not collide
+	std::set<size_t> hashes;
+	const size_t keyCount = 10000;
+	for (size_t i = 0; i < keyCount; i++)
+	{
+		char key[32];
+		snprintf(key, sizeof(key), "key-%zu", i);
+		hashes.insert(AString(key).hash());
+	}
+	dynamic_assert(keyCount == hashes.size(), "Error, similar keys collided");
+
+	// Three-way comparison and ordering
+	AString a("a"), ab("ab"), b("b");
+	dynamic_assert(-1 == a.compare(ab) && 1 == b.compare(ab) && 0 == ab.compare(AString("ab")), "Error, compare returned a wrong ordering");
+	dynamic_assert(a < ab && ab < b && !(b < a) && a <= a && b > ab && b >= b && AStringView("ab") < AStringView("b"), "Error, a relational operator failed");
+
+	// Characters are ordered as unsigned values like std::string, so UTF-8 sorts after ASCII, also behind the vectors
+	AString umlaut("\xc3\xa4rger"), ascii("zebra");
+	dynamic_assert(1 == umlaut.compare(ascii) && -1 == ascii.compare(umlaut) && ascii < umlaut, "Error, compare ordered a non-ASCII byte as signed");
+	dynamic_assert(1 == umlaut.compare("zebra") && -1 == ascii.compare(umlaut.c_str()) && 0 == umlaut.compare(umlaut.c_str()),
+		"Error, compare with a c-string returned a wrong ordering");
+	for (size_t length = 1; length < 100; length++)
+	{
+		for (size_t index = 0; index < length; index += 7)
+		{
+			AString lower(std::string(length, 'x').c_str()), upper(lower.c_str());
+			upper.data()[index] = '\x80';
+			dynamic_assert(-1 == lower.compare(upper) && 1 == upper.compare(lower) && 0 == lower.compare(AString(lower.c_str())) &&
+				(std::string(lower.c_str()) < std::string(upper.c_str())) == (lower < upper), "Error, compare differs from std::string");
+			WString wideLower(std::wstring(length, L'x').c_str()), wideUpper(wideLower.c_str());
+			wideUpper.data()[index] = static_cast<wchar_t>(0xFFFF);
+			dynamic_assert(-1 == wideLower.compare(wideUpper) && 1 == wideUpper.compare(wideLower.c_str()), "Error, compare of wide strings returned a wrong ordering");
+		}
+	}
+
+	std::map<AString, int> ordered;
+	ordered[b] = 3;
+	ordered[ab] = 2;
+	ordered[a] = 1;
+	int expected = 1;
+	bool inOrder = true;
+	for (std::map<AString, int>::const_iterator it = ordered.begin(); it != ordered.end(); ++it)
+	{
+		inOrder = inOrder && expected++ == it->second;
+	}
+	dynamic_assert(inOrder, "Error, a map of strings is not ordered");
+
+	std::unordered_map<WString, int> unordered;
+	unordered[WString(L"first")] = 1;
+	unordered[WString(L"second")] = 2;
+	dynamic_assert(2 == unordered.size() && 2 == unordered[WString(L"second")] && unordered.end() == unordered.find(WString(L"third")),
+		"Error, a hash map of strings failed");
+
+	// Hashed strings cache the hash of the string
+	AString moved("hashed string");
+	AHashedString hashed(std::move(moved));
+	dynamic_assert(hashed.hash() == AString("hashed string").hash() && AString("hashed string") == hashed.c_str() && AStringView("hashed string") == hashed,
+		"Error, a hashed string got a wrong hash");
+	dynamic_assert(AHashedString().hash() == AString().hash() && 0 == AHashedString().length(), "Error, an empty hashed string failed");
+
+	std::unordered_set<AHashedString> keys;
+	keys.insert(hashed);
+	keys.insert(AHashedString(AStringView("other")));
+	dynamic_assert(2 == keys.size() && 1 == keys.count(AHashedString(AStringView("hashed string"))) && 0 == keys.count(AHashedString(AStringView("hashed"))),
+		"Error, a hash set of hashed strings failed");
+	dynamic_assert(AHashedString(AStringView("a")) < AHashedString(AStringView("b")), "Error, hashed strings are not ordered");
+}
+
+/**
+ * Tests strings sharing their dynamically allocated buffers using STRING_SHARED_BUFFER. Copies must share the buffer
+ * without allocating until one of them is modified, without the option every copy has a buffer of its own.
+ */
+static void TestSharedBuffer()
+{
+	char longTextA[] = "This text is too long for the SSO buffer";
+	AString original(longTextA);
+	size_t allocations = g_arrayAllocations;
+	AString copy1(original);
+	AString copy2;
+	copy2 = original;
+
+#if STRING_SHARED_BUFFER
+	dynamic_assert(allocations == g_arrayAllocations, "Error, copying a string allocated a buffer");
+	dynamic_assert(original.isShared() && copy1.c_str() == original.c_str() && copy2.c_str() == original.c_str(), "Error, copies do not share the buffer");
+
+	// Appending to a copy detaches it only
+	copy1.append(" appended");
+	dynamic_assert(copy1.c_str() != original.c_str() && copy2.c_str() == original.c_str() && !copy1.isShared(), "Error, append did not detach the buffer");
+	dynamic_assert(original == longTextA && copy1 == "This text is too long for the SSO buffer appended", "Error, append modified a shared buffer");
+
+	// Writing using data detaches the last copy
+	copy2.data()[0] = 't';
+	dynamic_assert(!original.isShared() && !copy2.isShared() && original == longTextA && copy2 == "this text is too long for the SSO buffer",
+		"Error, data did not detach the buffer");
+
+	AString copy3(original);
+	copy3.setLength(4);
+	dynamic_assert(copy3.c_str() != original.c_str() && 4 == copy3.length() && original == longTextA, "Error, setLength did not detach the buffer");
+
+	// A string with a buffer of its own keeps it
+	AString copy4(longTextA, 0, 0, 100);
+	const char* buffer = copy4.c_str();
+	copy4 = original;
+	dynamic_assert(buffer == copy4.c_str() && !original.isShared(), "Error, assigning replaced a buffer of a string");
+#else
+	dynamic_assert(!original.isShared() && copy1.c_str() != original.c_str() && copy2.c_str() != original.c_str() && allocations + 2 == g_arrayAllocations,
+		"Error, copies share the buffer without STRING_SHARED_BUFFER");
+#endif
+
+	// Strings viewing or appending their own shared buffers
+	AString copy5(original);
+	copy5.append(copy5);
+	AString copy6(original);
+	copy6.copy(AStringView(copy6).substr(5, 4));
+	AString copy7(original);
+	copy7.append(AStringView(copy7).substr(0, 4));
+	dynamic_assert(copy5.length() == 2 * original.length() && copy6 == "text" && copy7 == "This text is too long for the SSO bufferThis" && original == longTextA,
+		"Error, modifying a string using its own shared buffer failed");
+
+	// Move, swap and the allocators
+	WString wideOriginal(L"This text is too long for the SSO buffer");
+	WString wideCopy(wideOriginal);
+	WString wideMoved(std::move(wideCopy));
+	swap(wideMoved, wideCopy);
+	wideCopy += L"!";
+	dynamic_assert(wideOriginal == L"This text is too long for the SSO buffer" && wideCopy == L"This text is too long for the SSO buffer!", "Error, moving a shared WString failed");
+
+	typedef String<char, StringPoolAllocator<char> > PoolString;
+	PoolString poolOriginal(longTextA);
+	{
+		PoolString poolCopy(poolOriginal);
+		poolCopy += "!";
+	}
+	StringArena arena;
+	{
+		StringArena::Scope scope(arena);
+		String<char, StringArenaAllocator<char> > arenaOriginal(longTextA);
+		String<char, StringArenaAllocator<char> > arenaCopy(arenaOriginal);
+		arenaCopy += "!";
+		dynamic_assert(arenaOriginal == longTextA && poolOriginal == longTextA, "Error, a shared buffer of an allocator was modified");
+
+		// Arena buffers are not reference counted, so a copy gets its own buffer
+		String<char, StringArenaAllocator<char> > arenaShared(arenaOriginal);
+		dynamic_assert(arenaShared.c_str() != arenaOriginal.c_str() && !arenaShared.isShared(), "Error, a String shared an arena buffer");
+	}
+
+	// Threads modify their copies of a shared string concurrently
+	const size_t threadCount = 8;
+	AString config("route /api/v2/customers to backend-17.example.org");
+	std::vector<AString> results(threadCount);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		threads.push_back(std::thread([&config, &results, t]()
+		{
+			for (size_t i = 0; i < 1000; i++)
+			{
+				// Every second copy is modified, the last one as well
+				AString copy(config);
+				if (i & 1)
+				{
+					char suffix[] = { static_cast<char>('0' + t), 0 };
+					copy += suffix;
+				}
+				results[t] = copy;
+			}
+		}));
+	}
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		threads[t].join();
+	}
+	bool threadsOk = config == "route /api/v2/customers to backend-17.example.org";
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		char suffix[] = { static_cast<char>('0' + t), 0 };
+		threadsOk = threadsOk && results[t] == config + suffix;
+	}
+	dynamic_assert(threadsOk, "Error, threads modifying copies of a shared string interfered");
+}
+
+/**
+ * Tests a round trip of a UTF-8 string through a wide encoding.
+ * @param	utf8	Valid UTF-8 string
+ * @param	units	Expected count of code units of the wide string
+ * @return		true if the round trip reproduced the string, otherwise false
+ */
+template<class TWide>
+static bool RoundTripUtf(const AString& utf8, size_t units)
+{
+	String<TWide> wide;
+	AString back("stale");
+	return StringUtf::fromUtf8("stale contents which have to be replaced", wide) && StringUtf::fromUtf8(utf8, wide) && units == wide.length() && 0 == wide.c_str()[units] &&
+		StringUtf::toUtf8(wide, back) && back == utf8;
+}
+
+/**
+ * Tests the validating transcoding between UTF-8 and UTF-16 or UTF-32, the UTF-8 validation and the counting of code
+ * points.
+ */
+static void TestUtf()
+{
+	// Each piece has 4 code points in 10 bytes, the last one needs a surrogate pair in UTF-16
+	const char piece[] = "a\xC3\xBC\xE2\x82\xAC\xF0\x9F\x98\x80";
+	AString mixed;
+	AString ascii;
+	for (size_t i = 0; i < 100; i++)
+	{
+		mixed += piece;
+		ascii += "ASCII text converted 16 characters at a time ";
+		if (i % 7 == 0)
+		{
+			mixed += "followed by an ASCII run crossing the blocks";
+		}
+	}
+	size_t mixedAscii = 15 * 44;
+
+	dynamic_assert(StringUtf::validate(mixed) && StringUtf::validate(ascii) && StringUtf::validate(AString()), "Error, valid UTF-8 was rejected");
+	dynamic_assert(400 + mixedAscii == StringUtf::countCodePoints(mixed) && ascii.length() == StringUtf::countCodePoints(ascii),
+		"Error in StringUtf::countCodePoints");
+	dynamic_assert(RoundTripUtf<char16_t>(mixed, 500 + mixedAscii) && RoundTripUtf<char32_t>(mixed, 400 + mixedAscii) &&
+		RoundTripUtf<wchar_t>(mixed, (sizeof(wchar_t) == 2 ? 500 : 400) + mixedAscii), "Error in a UTF round trip of mixed text");
+	dynamic_assert(RoundTripUtf<char16_t>(ascii, ascii.length()) && RoundTripUtf<char32_t>(ascii, ascii.length()) && RoundTripUtf<char32_t>(AString(), 0),
+		"Error in a UTF round trip of ASCII text");
+
+	// Check the decoded code points
+	WString wide;
+	dynamic_assert(StringUtf::fromUtf8("Gr\xC3\xBC\xC3\x9F\xE2\x82\xAC", wide) && wide == L"Gr\x00FC\x00DF\x20AC", "Error, UTF-8 was decoded wrong");
+	AString utf8;
+	dynamic_assert(StringUtf::toUtf8(WString(L"\x20AC 5"), utf8) && utf8 == "\xE2\x82\xAC 5", "Error, UTF-8 was encoded wrong");
+
+	// Overlong, surrogate, too large, truncated and unexpected continuation sequences are invalid
+	const char* const invalid[] = { "\xC0\xAF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE2\x82", "a\x80", "\xFF" };
+	bool rejected = true;
+	for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+	{
+		AString text(ascii);
+		text += invalid[i];
+		rejected = rejected && !StringUtf::validate(text) && !StringUtf::fromUtf8(text, wide) && 0 == wide.length() && 0 == wide.c_str()[0];
+	}
+	dynamic_assert(rejected, "Error, invalid UTF-8 was accepted");
+
+	// Unpaired surrogates and code points above U+10FFFF are invalid
+	const char16_t unpaired[] = { 'a', 0xD800, 'b', 0 };
+	const char16_t reversed[] = { 0xDC00, 0xD800, 0 };
+	const char32_t tooLarge[] = { 'a', 0x110000, 0 };
+	const char32_t surrogate[] = { 0xD800, 0 };
+	dynamic_assert(!StringUtf::toUtf8(StringView<char16_t>(unpaired), utf8) && 0 == utf8.length() && !StringUtf::toUtf8(StringView<char16_t>(reversed), utf8) &&
+		!StringUtf::toUtf8(StringView<char32_t>(tooLarge), utf8) && !StringUtf::toUtf8(StringView<char32_t>(surrogate), utf8), "Error, an invalid wide string was accepted");
+}
+
+/**
+ * Tests the lazy concatenation of operator+ and String::concat, which allocate at most once, including pieces pointing
+ * into the target string.
+ */
+static void TestConcat()
+{
+	char longTextA[] = "This text is too long for the SSO buffer";
+	AString text(longTextA);
+	AString word("word");
+	AStringView view(longTextA, 4);
+
+	// Mixed pieces are copied once into a buffer of the combined length
+	size_t allocations = g_arrayAllocations;
+	AString astring1 = text + ' ' + word + ", " + view + ' ' + 42 + ' ' + -7 + ' ' + 0u;
+	dynamic_assert(allocations + 1 == g_arrayAllocations, "Error, a chain of operator+ allocated more than once");
+	dynamic_assert(astring1 == "This text is too long for the SSO buffer word, This 42 -7 0", "Error in a chain of operator+");
+
+	allocations = g_arrayAllocations;
+	AString astring2 = AString::concat(view, "|", word, '|', text, '|', -9223372036854775807LL - 1, '|', 18446744073709551615ULL);
+	dynamic_assert(allocations + 1 == g_arrayAllocations, "Error, concat allocated more than once");
+	dynamic_assert(astring2 == "This|word|This text is too long for the SSO buffer|-9223372036854775808|18446744073709551615", "Error in concat");
+
+	// Concatenations fitting into the SSO buffer do not allocate
+	const char* empty = nullptr;
+	allocations = g_arrayAllocations;
+	AString astring3 = "<" + word + empty + AStringView() + ">";
+	AString astring4 = view + word + static_cast<short>(-12);
+	dynamic_assert(allocations + (astring3.length() > AString::ssoCapacity() ? 1 : 0) + (astring4.length() > AString::ssoCapacity() ? 1 : 0) ==
+		g_arrayAllocations, "Error, a short concatenation allocated a buffer");
+	dynamic_assert(astring3 == "<word>" && astring4 == "Thisword-12" && AString::concat() == "", "Error in a short concatenation");
+
+	// Assigning reuses a buffer which is large enough, appending grows it once
+	AString astring5(longTextA, 0, 0, 256);
+	const char* buffer = astring5.c_str();
+	allocations = g_arrayAllocations;
+	astring5 = word + '-' + text;
+	astring5 += word + word + word + 12345;
+	dynamic_assert(allocations == g_arrayAllocations && buffer == astring5.c_str(), "Error, assigning a concatenation did not reuse the buffer");
+	dynamic_assert(astring5 == "word-This text is too long for the SSO bufferwordwordword12345", "Error in assigning a concatenation");
+	AString astring6(word);
+	allocations = g_arrayAllocations;
+	astring6 += text + text + text;
+	dynamic_assert(allocations + 1 == g_arrayAllocations && astring6.length() == 4 + 3 * text.length(), "Error, appending a concatenation allocated more than once");
+
+	// Pieces pointing into the target
+	AString astring7(text);
+	astring7 = "[" + astring7 + "]";
+	AString astring8(word);
+	astring8 = word + astring8 + AStringView(astring8).substr(1, 2);
+	AString astring9(text);
+	astring9 += astring9 + '|' + AStringView(astring9).substr(0, 4);
+	AString astring10(word);
+	astring10 += astring10 + astring10;
+	dynamic_assert(astring7 == "[This text is too long for the SSO buffer]" && astring8 == "wordwordor" && astring10 == "wordwordword",
+		"Error, a concatenation of the target changed its pieces");
+	dynamic_assert(astring9 == "This text is too long for the SSO bufferThis text is too long for the SSO buffer|This", "Error, appending a concatenation of the target changed its pieces");
+
+	// Rvalues keep reusing their buffers
+	AString astring11(word, 0, 0, 128);
+	allocations = g_arrayAllocations;
+	AString astring12 = std::move(astring11) + text + word;
+	dynamic_assert(allocations == g_arrayAllocations && astring12 == "wordThis text is too long for the SSO bufferword", "Error, operator+ of an rvalue did not reuse its buffer");
+
+	// Shared buffers are not modified
+	AString astring13(text);
+	AString astring14(astring13);
+	astring14 += word + 1;
+	astring13 = astring13 + astring14;
+	dynamic_assert(text == longTextA && astring14 == "This text is too long for the SSO bufferword1" &&
+		astring13 == "This text is too long for the SSO bufferThis text is too long for the SSO bufferword1", "Error, a concatenation modified a shared buffer");
+
+	// Wide strings
+	WString wstring1(L"wide");
+	WString wstring2 = wstring1 + L' ' + WStringView(L"view") + L" " + 1234567890123LL + L' ' + wstring1;
+	dynamic_assert(wstring2 == L"wide view 1234567890123 wide" && WString::concat(-1, L'x', wstring1) == L"-1xwide", "Error in a concatenation of WString");
+}
+
+/**
+ * Tests formatting and parsing numbers, String::format and that both do not allocate when the buffer suffices.
+ */
+static void TestNumber()
+{
+	// Integers are appended without allocating if they fit into the buffer
+	size_t allocations = g_arrayAllocations;
+	AString astring1("x=", 0, 0, 15);
+	astring1.appendInt(0);
+	astring1.appendInt(-42);
+	astring1.appendUInt(100);
+	AString astring2(static_cast<size_t>(64));
+	astring2.appendInt(-9223372036854775807LL - 1);
+	astring2.appendUInt(18446744073709551615ULL);
+	dynamic_assert(allocations + (AString::ssoCapacity() < 15 ? 1 : 0) + (AString::ssoCapacity() < 64 ? 1 : 0) == g_arrayAllocations,
+		"Error, appending an integer to a large enough buffer allocated");
+	AString astring3;
+	astring3.appendInt(9223372036854775807LL);
+	dynamic_assert(astring1 == "x=0-42100" && astring2 == "-922337203685477580818446744073709551615" && astring3 == "9223372036854775807", "Error in appendInt or appendUInt");
+
+	// Doubles are written in their shortest form
+	const double doubles[] = { 0.0, -0.0, 1.5, 0.1, 0.30000000000000004, 100.0, 1e20, 1e21, 123456.789, 0.000001, 1e-7,
+		-2.5e-10, 9007199254740992.0, 5e-324, 2.2250738585072014e-308, 1.7976931348623157e308, 1.0 / 0.0, -1.0 / 0.0 };
+	const char* texts[] = { "0", "-0", "1.5", "0.1", "0.30000000000000004", "100", "100000000000000000000", "1e+21",
+		"123456.789", "0.000001", "1e-7", "-2.5e-10", "9007199254740992", "5e-324", "2.2250738585072014e-308",
+		"1.7976931348623157e+308", "inf", "-inf" };
+	for (size_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); i++)
+	{
+		AString text;
+		text.appendDouble(doubles[i]);
+		double parsed = 1.0;
+		dynamic_assert(text == texts[i] && text.parseDouble(parsed) && memcmp(&parsed, &doubles[i], sizeof(double)) == 0, "Error in appendDouble");
+	}
+	AString nan;
+	nan.appendDouble(0.0 / 0.0);
+	double parsedNan = 0.0;
+	dynamic_assert(nan == "nan" && nan.parseDouble(parsedNan) && parsedNan != parsedNan, "Error, NaN is not written as nan");
+
+	// Random doubles parse back to themselves and the same text is parsed equally by strtod
+	size_t state = 1;
+	for (size_t run = 0; run < 20000; run++)
+	{
+		uint64_t bits = nextRandom(state);
+		double value;
+		memcpy(&value, &bits, sizeof(value));
+		if (value != value)
+		{
+			continue;
+		}
+		AString text;
+		text.appendDouble(value);
+		double parsed;
+		uint64_t parsedBits = 0, strtodBits = 0;
+		dynamic_assert(text.parseDouble(parsed), "Error, a formatted double was rejected");
+		memcpy(&parsedBits, &parsed, sizeof(parsed));
+		double converted = strtod(text.c_str(), nullptr);
+		memcpy(&strtodBits, &converted, sizeof(converted));
+		dynamic_assert(parsedBits == bits && strtodBits == bits, "Error, a formatted double did not parse back to itself");
+	}
+
+	// Random decimals with up to 800 digits are rounded like strtod
+	for (size_t run = 0; run < 20000; run++)
+	{
+		char text[1024];
+		size_t length = 0;
+		if (nextRandom(state) % 2)
+		{
+			text[length++] = '-';
+		}
+		size_t digits = 1 + nextRandom(state) % (run % 10 ? 25 : 800);
+		for (size_t i = 0; i < digits; i++)
+		{
+			text[length++] = static_cast<char>('0' + nextRandom(state) % 10);
+			if (i == digits / 3 && nextRandom(state) % 2)
+			{
+				text[length++] = '.';
+			}
+		}
+		length += snprintf(text + length, sizeof(text) - length, "e%d", static_cast<int>(nextRandom(state) % 700) - 350);
+		double parsed = 0.0;
+		double converted = strtod(text, nullptr);
+		dynamic_assert(AStringView(text, length).parseDouble(parsed) && memcmp(&parsed, &converted, sizeof(double)) == 0, "Error, a decimal was rounded differently than by strtod");
+	}
+
+	// Integers and doubles are parsed from whole strings only
+	int64_t integer = 1;
+	uint64_t unsignedInteger = 1;
+	double number = 1.0;
+	dynamic_assert(AString("-9223372036854775808").parseInt(integer) && integer == -9223372036854775807LL - 1, "Error in parseInt of the minimum value");
+	dynamic_assert(AStringView("+9223372036854775807").parseInt(integer) && integer == 9223372036854775807LL, "Error in parseInt of the maximum value");
+	dynamic_assert(AStringView("18446744073709551615").parseUInt(unsignedInteger) && unsignedInteger == 18446744073709551615ULL, "Error in parseUInt");
+	dynamic_assert(!AStringView("9223372036854775808").parseInt(integer) && !AStringView("-9223372036854775809").parseInt(integer) &&
+		!AStringView("18446744073709551616").parseUInt(unsignedInteger) && !AStringView("-1").parseUInt(unsignedInteger) &&
+		!AStringView("").parseInt(integer) && !AStringView("-").parseInt(integer) && !AStringView("1 ").parseInt(integer) &&
+		!AStringView("0x10").parseUInt(unsignedInteger) && integer == 9223372036854775807LL && unsignedInteger == 18446744073709551615ULL,
+		"Error, parseInt or parseUInt accepted an invalid integer");
+	dynamic_assert(AStringView("-.5").parseDouble(number) && number == -0.5 && AStringView("1E+2").parseDouble(number) && number == 100.0 &&
+		AStringView("Infinity").parseDouble(number) && number == 1.0 / 0.0 && AStringView("1e-400").parseDouble(number) && number == 0.0 &&
+		AStringView("1e99999999999").parseDouble(number) && number == 1.0 / 0.0, "Error in parseDouble");
+	number = 2.0;
+	dynamic_assert(!AStringView("").parseDouble(number) && !AStringView(".").parseDouble(number) && !AStringView("1e").parseDouble(number) &&
+		!AStringView("1.2.3").parseDouble(number) && !AStringView(" 1").parseDouble(number) && !AStringView("infinit").parseDouble(number) &&
+		!AStringView("1e+").parseDouble(number) && number == 2.0, "Error, parseDouble accepted an invalid double");
+
+	// Formatting replaces the placeholders and escaped braces without allocating for short results
+	AString word("word");
+	allocations = g_arrayAllocations;
+	AString astring4;
+	dynamic_assert(astring4.format("{}: {} {{{}}}", word, -3, 0.25) && astring4 == "word: -3 {0.25}", "Error in format");
+	dynamic_assert(allocations + (astring4.length() > AString::ssoCapacity() ? 1 : 0) == g_arrayAllocations, "Error, a short format allocated a buffer");
+	dynamic_assert(astring4.appendFormat(" {}", 'x') && astring4 == "word: -3 {0.25} x" && astring4.appendFormat("") && astring4.length() == 17, "Error in appendFormat");
+	dynamic_assert(!astring4.format("{}", 1, 2) && !astring4.format("{} {}", 1) && !astring4.format("{", 1) && !astring4.format("}") &&
+		!astring4.appendFormat("{x}", 1) && astring4 == "word: -3 {0.25} x", "Error, an invalid pattern changed the string");
+
+	// The pattern and the arguments may point into the target
+	AString astring5("This text is too long for the SSO buffer {}");
+	dynamic_assert(astring5.format(astring5, AStringView(astring5).substr(0, 4)) && astring5 == "This text is too long for the SSO buffer This", "Error, formatting the target changed its pattern");
+	AString astring6("{}-{}");
+	dynamic_assert(astring6.appendFormat(astring6, astring6, 1.5) && astring6 == "{}-{}{}-{}-1.5", "Error, appending a format of the target changed it");
+
+	// Wide strings
+	WString wstring1(L"n=");
+	wstring1.appendInt(-5);
+	wstring1.appendDouble(1e-10);
+	double wide = 0.0;
+	dynamic_assert(wstring1 == L"n=-51e-10" && WStringView(L"-1.25e3").parseDouble(wide) && wide == -1250.0, "Error in appending or parsing numbers of WString");
+	dynamic_assert(wstring1.format(L"{} {}", 7u, WStringView(L"x")) && wstring1 == L"7 x", "Error in format of WString");
+}
+
+/**
+ * Tests reading files into strings, mapping them, reading them line by line and writing strings to file descriptors.
+ */
+static void TestFile()
+{
+#if STRING_POSIX_IO
+	char path[] = "/tmp/StringTestXXXXXX";
+	int fd = mkstemp(path);
+	dynamic_assert(fd >= 0, "Error, the temporary file could not be created");
+
+	// Many views are written by several calls of writev
+	AString text("first line\n\nThis line is too long for the SSO buffer and for a chunk\nlast line without a newline");
+	std::vector<AStringView> views;
+	for (size_t i = 0; i < 100; i++)
+	{
+		views.push_back(AStringView());
+		views.push_back(AStringView(text));
+		views.push_back(AStringView("\n"));
+	}
+	dynamic_assert(StringFile::writeTo(fd, views.data(), views.size()) && text.writeTo(fd) && StringFile::writeTo(fd, views.data(), 0), "Error in writing to a file");
+	AString expected;
+	for (size_t i = 0; i < 100; i++)
+	{
+		expected += text;
+		expected += "\n";
+	}
+	expected += text;
+
+	// The whole file is read into a buffer of its size
+	AString content("This text is too long for the SSO buffer");
+	size_t allocations = g_arrayAllocations;
+	dynamic_assert(content.readFile(path) && content == expected, "Error in readFile");
+	dynamic_assert(allocations + 1 == g_arrayAllocations && content.capacity() < expected.length() + 64, "Error, readFile did not allocate once for the file size");
+	int pipeFds[2];
+	dynamic_assert(0 == pipe(pipeFds) && text.writeTo(pipeFds[1]) && 0 == close(pipeFds[1]), "Error in writing to a pipe");
+	char pipePath[32];
+	snprintf(pipePath, sizeof(pipePath), "/dev/fd/%d", pipeFds[0]);
+	AString piped;
+	dynamic_assert(piped.readFile(pipePath) && piped == text, "Error in readFile of a pipe, which has no known size");
+	close(pipeFds[0]);
+	AString missing("old");
+	dynamic_assert(!missing.readFile("/nonexistent/file") && missing.length() == 0, "Error, readFile of a missing file did not fail");
+
+	// The mapping views the same characters
+	MappedString mapped;
+	dynamic_assert(mapped.open(path) && AStringView(mapped) == expected, "Error in MappedString");
+	MappedString moved(std::move(mapped));
+	dynamic_assert(mapped.length() == 0 && moved.length() == expected.length() && !mapped.open("/nonexistent/file"), "Error in moving a MappedString");
+
+	// Lines are read across chunks of 16 bytes, the last line has no newline
+	for (int run = 0; run < 2; run++)
+	{
+		StringLineReader reader(16);
+		dynamic_assert(reader.open(path), "Error, StringLineReader could not open the file");
+		size_t lines = 0;
+		bool equal = true;
+		AString line;
+		AStringView view;
+		AStringView(expected).split('\n', [&](const AStringView& token)
+		{
+			bool read = run ? reader.next(line) : reader.next(view);
+			equal = equal && read && (run ? AStringView(line) : view) == token;
+			lines++;
+		});
+		dynamic_assert(equal && lines == 404 && !reader.next(view) && !reader.failed(), "Error in StringLineReader");
+	}
+
+	// Reading lines into a String reuses its capacity, the buffer of the reader only grows for long lines
+	StringLineReader reader;
+	int readFd = open(path, O_RDONLY);
+	reader.attach(readFd);
+	AString line(static_cast<size_t>(256));
+	AStringView view;
+	reader.next(view);
+	allocations = g_arrayAllocations;
+	size_t lines = 1;
+	while (reader.next(line))
+	{
+		lines++;
+	}
+	dynamic_assert(allocations == g_arrayAllocations && lines == 404 && line == "last line without a newline", "Error, StringLineReader allocated per line");
+	reader.close();
+	close(readFd);
+
+	// Empty files
+	dynamic_assert(0 == ftruncate(fd, 0) && content.readFile(path) && content.length() == 0 && mapped.open(path) && mapped.length() == 0 &&
+		reader.open(path) && !reader.next(view), "Error in reading an empty file");
+	close(fd);
+	unlink(path);
+#endif
+}
+
+/**
+ * Tests the parallel algorithms of StringParallel, which must return the results of the sequential ones. A pool with
+ * tiny chunks splits the inputs into many chunks, so matches, lines and UTF-8 sequences cross their boundaries.
+ */
+static void TestParallel()
+{
+	StringThreadPool pool(3, 64);
+	dynamic_assert(pool.concurrency() == 3 && pool.chunkSize() == 64 && StringThreadPool::shared().concurrency() >= 1, "Error in the parameters of StringThreadPool");
+
+	// Random text of few characters contains many overlapping occurrences
+	size_t state = 16;
+	const char* const needles[] = { "a", "aa", "aaa", "aba", "abab", "b\na", "\n", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "c", "" };
+	const char* const replacements[] = { "", "x", "xyz", "aa" };
+	bool equal = true;
+	for (size_t run = 0; run < 20; run++)
+	{
+		AString text;
+		size_t length = nextRandom(state) % 3000;
+		for (size_t i = 0; i < length; i++)
+		{
+			size_t value = nextRandom(state) % 16;
+			char c = value < 10 ? 'a' : (value < 15 ? 'b' : '\n');
+			text.append(AStringView(&c, 1));
+		}
+		for (size_t i = 0; i < sizeof(needles) / sizeof(needles[0]); i++)
+		{
+			AStringView needle(needles[i]);
+			equal = equal && StringParallel::find(AStringView(text), needle, pool) == AStringView(text).find(needle) &&
+				StringParallel::count(AStringView(text), needle, pool) == AStringView(text).count(needle);
+
+			// Replace from left to right like a sequential search does
+			AStringView replacement(replacements[run % 4]);
+			AString expected;
+			size_t pos = 0;
+			size_t count = 0;
+			for (size_t found = AStringView(text).find(needle); needle.length() && found != AStringView::NOT_FOUND;
+				found = AStringView(text).find(needle, pos))
+			{
+				expected.append(AStringView(text).substr(pos, found - pos));
+				expected.append(replacement);
+				pos = found + needle.length();
+				count++;
+			}
+			expected.append(AStringView(text).substr(pos));
+			AString replaced(text);
+			equal = equal && StringParallel::replaceAll(replaced, needle, replacement, pool) == count && replaced == expected &&
+				replaced.c_str()[replaced.length()] == 0;
+		}
+	}
+	dynamic_assert(equal, "Error, a parallel search or replacement differs from the sequential one");
+
+	// Chunks do not split UTF-8 sequences or surrogate pairs
+	const char piece[] = "a\xC3\xBC\xE2\x82\xAC\xF0\x9F\x98\x80";
+	AString mixed;
+	for (size_t i = 0; i < 300; i++)
+	{
+		mixed += piece;
+		mixed += i % 3 ? "Mixed Case\n" : "\n\n";
+	}
+	AString joined;
+	std::vector<AStringView> chunks(StringParallel::forEachChunk(AStringView(mixed), [&](size_t, const AStringView&) {}, pool));
+	dynamic_assert(chunks.size() > 4 && StringParallel::forEachChunk(AStringView(mixed), [&](size_t index, const AStringView& chunk)
+	{
+		chunks[index] = chunk;
+	}, pool) == chunks.size(), "Error, the UTF-8 text was not split into chunks");
+	bool valid = true;
+	for (size_t i = 0; i < chunks.size(); i++)
+	{
+		valid = valid && StringUtf::validate(chunks[i]);
+		joined.append(chunks[i]);
+	}
+	dynamic_assert(valid && joined == mixed, "Error, a chunk boundary splits a UTF-8 sequence");
+	String<char16_t> utf16;
+	dynamic_assert(StringUtf::fromUtf8(mixed, utf16), "Error in converting the text to UTF-16");
+	valid = true;
+	StringParallel::forEachChunk(StringView<char16_t>(utf16), [&](size_t, const StringView<char16_t>& chunk)
+	{
+		valid = valid && (!chunk.length() || 0xDC00 != (chunk.data()[0] & 0xFC00));
+	}, pool);
+	dynamic_assert(valid, "Error, a chunk boundary splits a surrogate pair");
+
+	// Only ASCII letters are converted
+	AString lower(mixed);
+	AString upper(mixed);
+	StringParallel::toLower(lower, pool);
+	StringParallel::toUpper(upper, pool);
+	AString expectedLower(mixed);
+	AString expectedUpper(mixed);
+	for (size_t i = 0; i < mixed.length(); i++)
+	{
+		char c = mixed.c_str()[i];
+		expectedLower.data()[i] = c >= 'A' && c <= 'Z' ? static_cast<char>(c + 32) : c;
+		expectedUpper.data()[i] = c >= 'a' && c <= 'z' ? static_cast<char>(c - 32) : c;
+	}
+	dynamic_assert(lower == expectedLower && upper == expectedUpper, "Error in the parallel case conversion");
+
+	// Lines keep empty lines and drop the empty one behind the last '\n'
+	for (size_t run = 0; run < 2; run++)
+	{
+		AStringView text = run ? AStringView(mixed).substr(0, mixed.length() - 1) : AStringView(mixed);
+		std::vector<AStringView> expected;
+		text.split('\n', [&](const AStringView& token)
+		{
+			expected.push_back(token);
+		});
+		if (expected.back().length() == 0)
+		{
+			expected.pop_back();
+		}
+		std::vector<AStringView> lines(1);
+		StringParallel::splitLines(text, lines, pool);
+		dynamic_assert(lines == expected, "Error in the parallel splitting into lines");
+	}
+
+	// Tasks may use the pool themselves
+	size_t counts[8] = { 0 };
+	pool.run(8, [&](size_t i)
+	{
+		counts[i] = StringParallel::count(AStringView(mixed), AStringView("Case"), pool);
+	});
+	dynamic_assert(counts[0] == 200 && counts[7] == 200, "Error in nested use of the pool");
+
+	// Hashes of many strings
+	std::vector<AString> strings;
+	for (size_t i = 0; i < 20000; i++)
+	{
+		strings.push_back(AString());
+		strings.back().appendUInt(nextRandom(state));
+	}
+	std::vector<size_t> hashes(strings.size());
+	StringParallel::hash(strings.data(), strings.size(), hashes.data(), pool);
+	StringParallel::hash(strings.data(), 0, hashes.data(), pool);
+	bool hashed = true;
+	for (size_t i = 0; i < strings.size(); i++)
+	{
+		hashed = hashed && hashes[i] == strings[i].hash();
+	}
+	dynamic_assert(hashed, "Error in hashing strings in parallel");
+}
+
+/**
+ * Tests the in-place editing methods insert, erase, replace, replaceAll, trim, reserve, shrinkToFit, toLower and
+ * toUpper, which must not allocate while the capacity suffices.
+ */
+static void TestEditing()
+{
+	AString str("middle");
+	str.insert(0, "front ");
+	str.insert(str.length(), AStringView(" back"));
+	str.insert(6, AStringView(str).substr(0, 6));
+	dynamic_assert(str == "front front middle back", "Error in insert");
+	str.erase(0, 6);
+	str.erase(12);
+	dynamic_assert(str == "front middle", "Error in erase");
+	str.replace(0, 5, AStringView("a string longer than the SSO buffer"));
+	str.replace(str.length() - 6, 100, AStringView("end"));
+	dynamic_assert(str == "a string longer than the SSO buffer end", "Error in replacing a range");
+	dynamic_assert(str.replace("string", "text") == 2 && str.replace("string", "text") == AString::NOT_FOUND && str.replace("", "x") == AString::NOT_FOUND &&
+		str == "a text longer than the SSO buffer end", "Error in replacing the first occurrence");
+
+	// Random replacements compared to building the result piece by piece, with and without spare capacity
+	size_t state = 17;
+	const char* const needles[] = { "a", "aa", "aba", "b", "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb" };
+	const char* const replacements[] = { "", "x", "xy", "xyz", "a much longer replacement", "aa" };
+	bool equal = true;
+	bool allocated = false;
+	for (size_t run = 0; run < 60; run++)
+	{
+		AString text;
+		size_t length = nextRandom(state) % 200;
+		for (size_t i = 0; i < length; i++)
+		{
+			text.append(nextRandom(state) % 3 ? "a" : "b");
+		}
+		AStringView needle(needles[run % 5]);
+		AStringView replacement(replacements[run % 6]);
+		AString expected;
+		size_t pos = 0;
+		size_t count = 0;
+		for (size_t found = text.find(needle); found != AString::NOT_FOUND; found = text.find(needle, pos))
+		{
+			expected.append(AStringView(text).substr(pos, found - pos));
+			expected.append(replacement);
+			pos = found + needle.length();
+			count++;
+		}
+		expected.append(AStringView(text).substr(pos));
+
+		AString replaced((AStringView(text)));
+		if (run % 2)
+		{
+			replaced.reserve(expected.length());
+		}
+		size_t allocations = g_arrayAllocations;
+		equal = equal && replaced.replaceAll(needle, replacement) == count && replaced == expected && replaced.c_str()[replaced.length()] == 0;
+		allocated = allocated || (run % 2 && allocations != g_arrayAllocations);
+	}
+	dynamic_assert(equal, "Error in replaceAll");
+	dynamic_assert(!allocated, "Error, replaceAll allocated although the capacity sufficed");
+	AString self("abcabc");
+	dynamic_assert(self.replaceAll(AStringView(self).substr(0, 3), AStringView(self)) == 2 && self == "abcabcabcabc" && self.replaceAll("", "x") == 0,
+		"Error in replaceAll with views into the string itself");
+
+	// Copies sharing the buffer keep their string
+	AString original("This text is too long for the SSO buffer");
+	AString copy(original);
+	copy.replaceAll("t", "T");
+	AString copy2(original);
+	copy2.replaceAll("t", "tt");
+	AString copy3(original);
+	copy3.insert(4, " new");
+	dynamic_assert(original == "This text is too long for the SSO buffer" && copy == "This TexT is Too long for The SSO buffer" &&
+		copy2 == "This ttextt is ttoo long for tthe SSO buffer" && copy3 == "This new text is too long for the SSO buffer", "Error in editing a copy");
+
+	// Trimming
+	AString trimmed(" \t\r\n text with spaces \v\f ");
+	trimmed.trim();
+	AString blank(" \t \n");
+	blank.trim();
+	AString untouched("x");
+	untouched.trim();
+	dynamic_assert(trimmed == "text with spaces" && blank.length() == 0 && untouched == "x", "Error in trim");
+
+	// Capacity
+	AString reserved;
+	size_t allocations = g_arrayAllocations;
+	reserved.reserve(1000);
+	dynamic_assert(allocations + 1 == g_arrayAllocations && reserved.capacity() >= 1000 && reserved.capacity() < 1100, "Error in reserve");
+	reserved.append("short");
+	reserved.shrinkToFit();
+	dynamic_assert(reserved == "short" && (reserved.length() <= AString::ssoCapacity() ? reserved.capacity() == AString::ssoCapacity() :
+		reserved.capacity() < 1000), "Error in shrinking to the SSO buffer");
+	AString shrunk(original);
+	shrunk.append(original);
+	shrunk.append(original);
+	shrunk.erase(original.length());
+	size_t capacity = shrunk.capacity();
+	shrunk.shrinkToFit();
+	dynamic_assert(shrunk == original && shrunk.capacity() < capacity && shrunk.capacity() >= original.length(), "Error in shrinkToFit");
+
+	// Case conversion of ASCII letters only
+	AString mixed("Mixed Case \xC3\x84 Text With Digits 0123 and [brackets] @ `");
+	mixed.toLower();
+	dynamic_assert(mixed == "mixed case \xC3\x84 text with digits 0123 and [brackets] @ `", "Error in toLower");
+	mixed.toUpper();
+	dynamic_assert(mixed == "MIXED CASE \xC3\x84 TEXT WITH DIGITS 0123 AND [BRACKETS] @ `", "Error in toUpper");
+	WString wide(L"Wide Text \x00C4");
+	wide.toUpper();
+	dynamic_assert(wide == L"WIDE TEXT \x00C4", "Error in toUpper of a wide string");
+
+	// Sanitizing log messages reuses the capacity of a single String
+	const char* const messages[] = { "  User Login password=secret ok\n", "\tDEBUG password=secret password=secret\r\n", "plain" };
+	AString message(static_cast<size_t>(256));
+	allocations = g_arrayAllocations;
+	for (size_t i = 0; i < 3; i++)
+	{
+		message.copy(messages[i]);
+		message.trim();
+		message.replaceAll("password=secret", "password=******");
+		message.replaceAll(" ", "  ");
+		message.toLower();
+	}
+	dynamic_assert(allocations == g_arrayAllocations && message == "plain", "Error, sanitizing log messages allocated");
+}
+
+/**
+ * Tests the instrumentation of String, which only counts using STRING_STATS.
+ */
+static void TestStats()
+{
+	StringStats::reset();
+	{
+		STRING_STATS_SITE("TestStats");
+		AString empty;
+		AString small("short");
+		AString large("This text is too long for the SSO buffer of every layout");
+		for (size_t i = 0; i < 100; i++)
+		{
+			large.append("0123456789");
+		}
+		AString inserted((AStringView(large)));
+		inserted.insert(0, AStringView(large));
+	}
+	StringStats::Snapshot stats = StringStats::snapshot();
+
+#if STRING_STATS
+	// The two strings on the heap were allocated and grown inside the site
+	const StringStats::Site* site = StringStats::sites();
+	dynamic_assert(site && 0 == strcmp(site->name(), "TestStats") && site->allocations() == stats.allocations, "Error, allocations were not attributed to the site");
+	dynamic_assert(stats.emptyStrings == 1 && stats.ssoStrings == 1 && stats.heapStrings == 2, "Error in the counts of destroyed strings");
+	dynamic_assert(stats.allocations >= 3 && stats.reallocations >= 2 && stats.allocations == stats.reallocations + 2,
+		"Error in the count of reallocations");
+	dynamic_assert(stats.copiedBytes > 1000 && site->copiedBytes() == stats.copiedBytes && site->reallocations() == stats.reallocations,
+		"Error in the copied bytes");
+	dynamic_assert(stats.shortLengths[0] == 1 && stats.shortLengths[5] == 1 && stats.buckets[11].strings == 1 && stats.buckets[12].heapStrings == 1,
+		"Error in the length histogram");
+	dynamic_assert(stats.buckets[11].heapLength == 1056 && stats.buckets[11].heapCapacity >= 1056, "Error in the capacity histogram");
+
+	// Resetting keeps the site registered
+	StringStats::reset();
+	stats = StringStats::snapshot();
+	dynamic_assert(StringStats::sites() == site && 0 == site->allocations() && 0 == stats.allocations && 0 == stats.heapStrings, "Error in reset");
+#else
+	dynamic_assert(0 == stats.allocations && 0 == stats.heapStrings && 0 == StringStats::sites(), "Error, strings were counted without STRING_STATS");
+#endif
+
+	// The report contains the sections
+	FILE* file = tmpfile();
+	dynamic_assert(file, "Error, could not create a temporary file");
+	StringStats::dump(file);
+	rewind(file);
+	char report[4096];
+	size_t length = fread(report, 1, sizeof(report) - 1, file);
+	report[length] = 0;
+	fclose(file);
+	dynamic_assert(strstr(report, "allocations") && strstr(report, "SSO capacity"), "Error in dump");
+}
+
+// Ten and a hundred keys with a common prefix, used for tables near the size limit
+#define FIXED_KEYS_10(PREFIX) makeFixedString(PREFIX "0"), makeFixedString(PREFIX "1"), makeFixedString(PREFIX "2"), \
+	makeFixedString(PREFIX "3"), makeFixedString(PREFIX "4"), makeFixedString(PREFIX "5"), makeFixedString(PREFIX "6"), \
+	makeFixedString(PREFIX "7"), makeFixedString(PREFIX "8"), makeFixedString(PREFIX "9")
+#define FIXED_KEYS_100(PREFIX) FIXED_KEYS_10(PREFIX "0"), FIXED_KEYS_10(PREFIX "1"), FIXED_KEYS_10(PREFIX "2"), \
+	FIXED_KEYS_10(PREFIX "3"), FIXED_KEYS_10(PREFIX "4"), FIXED_KEYS_10(PREFIX "5"), FIXED_KEYS_10(PREFIX "6"), \
+	FIXED_KEYS_10(PREFIX "7"), FIXED_KEYS_10(PREFIX "8"), FIXED_KEYS_10(PREFIX "9")
+
+/**
+ * Tests FixedString and FixedStringTable, mostly at compile time.
+ */
+static void TestFixedString()
+{
+	// Length, comparison, hash and concatenation are constant expressions
+	constexpr auto get = makeFixedString("GET");
+	constexpr auto post = makeFixedString("POST");
+	static_assert(get.length() == 3 && get[2] == 'T' && get.c_str()[3] == 0, "Error in length");
+	static_assert(get == makeFixedString("GET") && get != post && get < post && !(post < get), "Error in compare");
+	static_assert(get.compare(makeFixedString("GE")) > 0 && get.compare(makeFixedString("GETS")) < 0, "Error in compare of prefixes");
+	static_assert(makeFixedString("\xC3\xA4").compare(makeFixedString("z")) > 0, "Error in compare of non-ASCII characters");
+	static_assert(get.hash() == makeFixedString("GET").hash() && get.hash() != post.hash(), "Error in hash");
+	constexpr auto line = "<" + get + " /index.html " + makeFixedString("HTTP/1.1") + ">";
+	static_assert(line.length() == 26 && line[0] == '<' && line[1] == 'G' && line[25] == '>', "Error in concatenation");
+	static_assert(makeFixedString(u"\u00e4").length() == 1, "Error in length of wide characters");
+
+	// The hash matches the one of StringView for all character types
+	dynamic_assert(get.hash() == AStringView("GET").hash(), "Error, hash differs from StringView");
+	dynamic_assert(line.hash() == AStringView("<GET /index.html HTTP/1.1>").hash(), "Error, hash of concatenation differs from StringView");
+	dynamic_assert(makeFixedString(U"fixed").hash() == StringView<char32_t>(U"fixed", 5).hash(), "Error, hash of UTF-32 differs from StringView");
+
+	// Conversion to String and StringView
+	AString converted(line);
+	dynamic_assert(converted == "<GET /index.html HTTP/1.1>" && AStringView(get) == "GET", "Error in conversion");
+	AString concatenated;
+	concatenated = converted + get;
+	dynamic_assert(concatenated == "<GET /index.html HTTP/1.1>GET", "Error in concatenation with String");
+
+	// Perfect hash tables are built by the compiler
+	constexpr auto methods = makeFixedStringTable(get, post, makeFixedString("PUT"), makeFixedString("DELETE"),
+		makeFixedString("HEAD"), makeFixedString("OPTIONS"), makeFixedString(""));
+	typedef decltype(methods) Methods;
+	static_assert(methods.valid() && methods.size() == 7, "Error, no perfect hash found");
+	static_assert(methods.find(post) == 1 && methods.find(makeFixedString("OPTIONS")) == 5 && methods.find(makeFixedString("")) == 6,
+		"Error in find");
+	static_assert(methods.find(makeFixedString("PATCH")) == Methods::NOT_FOUND && methods.find(makeFixedString("GETS")) == Methods::NOT_FOUND,
+		"Error in find of missing keys");
+	static_assert(!makeFixedStringTable(get, post, get).valid(), "Error, duplicate keys were accepted");
+	for (size_t i = 0; i < methods.size(); i++)
+	{
+		dynamic_assert(methods.find(methods.key(i)) == i, "Error in find at runtime");
+	}
+	dynamic_assert(methods.find(AStringView("PATCH")) == Methods::NOT_FOUND && methods.find(AStringView("GE")) == Methods::NOT_FOUND &&
+		methods.find(AStringView("DELETE")) == 3, "Error in find of missing keys at runtime");
+
+	// Larger tables
+	constexpr auto keywords = makeFixedStringTable(makeFixedString("alignas"), makeFixedString("alignof"), makeFixedString("auto"),
+		makeFixedString("bool"), makeFixedString("break"), makeFixedString("case"), makeFixedString("catch"), makeFixedString("char"),
+		makeFixedString("class"), makeFixedString("const"), makeFixedString("constexpr"), makeFixedString("continue"),
+		makeFixedString("decltype"), makeFixedString("default"), makeFixedString("delete"), makeFixedString("do"),
+		makeFixedString("double"), makeFixedString("else"), makeFixedString("enum"), makeFixedString("explicit"),
+		makeFixedString("extern"), makeFixedString("false"), makeFixedString("float"), makeFixedString("for"),
+		makeFixedString("friend"), makeFixedString("goto"), makeFixedString("if"), makeFixedString("inline"), makeFixedString("int"),
+		makeFixedString("long"), makeFixedString("mutable"), makeFixedString("namespace"), makeFixedString("new"),
+		makeFixedString("noexcept"), makeFixedString("nullptr"), makeFixedString("operator"), makeFixedString("private"),
+		makeFixedString("protected"), makeFixedString("public"), makeFixedString("return"), makeFixedString("short"),
+		makeFixedString("signed"), makeFixedString("sizeof"), makeFixedString("static"), makeFixedString("struct"),
+		makeFixedString("switch"), makeFixedString("template"), makeFixedString("this"), makeFixedString("throw"),
+		makeFixedString("true"), makeFixedString("try"), makeFixedString("typedef"), makeFixedString("typename"),
+		makeFixedString("union"), makeFixedString("unsigned"), makeFixedString("using"), makeFixedString("virtual"),
+		makeFixedString("void"), makeFixedString("volatile"), makeFixedString("while"));
+	static_assert(keywords.valid() && keywords.size() == 60 && keywords.find(makeFixedString("while")) == 59, "Error in larger table");
+	std::set<AString> words;
+	for (size_t i = 0; i < keywords.size(); i++)
+	{
+		dynamic_assert(keywords.find(keywords.key(i)) == i, "Error in find in larger table");
+		words.insert(AString(keywords.key(i)));
+	}
+	dynamic_assert(words.size() == 60 && keywords.find(AStringView("whilst")) == decltype(keywords)::NOT_FOUND, "Error in keys of larger table");
+
+	// Hundreds of keys still fit into the default constexpr limits of the compilers
+	constexpr auto numbers = makeFixedStringTable(FIXED_KEYS_100("a"), FIXED_KEYS_100("b"), FIXED_KEYS_100("c"), FIXED_KEYS_100("d"),
+		FIXED_KEYS_100("e"));
+	static_assert(numbers.valid() && numbers.size() == 500 && numbers.find(makeFixedString("c42")) == 242 &&
+		numbers.find(makeFixedString("f00")) == decltype(numbers)::NOT_FOUND, "Error in table near the size limit");
+	for (size_t i = 0; i < numbers.size(); i++)
+		dynamic_assert(numbers.find(numbers.key(i)) == i, "Error in find in table near the size limit");
+}
+
 /**
  * Entry point for the test application. Runs all tests.
  * @param	argc	Count of command line parameters
@@ -237,6 +2290,25 @@ int main(int argc, char* argv[])
 	TestSetLengthAndSetCapacity();
 	TestCopyAndCompareAndOperators();
 	testAppend();
+	TestMoveSemantics();
+	TestLayout();
+	TestKernels();
+	TestAllocators();
+	TestRope();
+	TestStringView();
+	TestSearch();
+	TestMultiMatcher();
+	TestStringPool();
+	TestHash();
+	TestSharedBuffer();
+	TestUtf();
+	TestConcat();
+	TestNumber();
+	TestFile();
+	TestParallel();
+	TestEditing();
+	TestStats();
+	TestFixedString();
 
 	std::cout << "All tests done!" << std::endl;
     return 0;